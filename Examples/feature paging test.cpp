@@ -0,0 +1,184 @@
+/*
+Feature paging test on a ficticious map.
+
+Keyframes lay on a line, each one sharing a mappoint with the next one.
+After paging out with the camera on the first keyframe, ORB-SLAM2 reads features by observation index on mappoints of the local map.
+Dummymap's MapPoint::UpdateNormalAndDepth and MapPoint::ComputeDistinctiveDescriptors throw if those features were paged out.
+Global bundle adjustment and relocalization reach every keyframe: while they may run, every keyframe must be paged in.
+*/
+
+#include <Osmap.h>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace cv;
+using namespace ORB_SLAM2;
+
+#define N_KEYFRAMES 6	// Number of fake KeyFrames in map, 20 units apart
+#define N_FEATURES 10	// Number of fake features in each KeyFrame
+
+unsigned int MapPoint::nNextId = 0;
+unsigned int KeyFrame::nNextId = 0;
+
+// Camera pose at x
+Mat poseAt(float x){
+	Mat Tcw = Mat::eye(4, 4, CV_32F);
+	Tcw.at<float>(0,3) = -x;
+	return Tcw;
+}
+
+/*
+ * Keyframe i shares mappoint i with keyframe i+1, on its last and first feature.  The last keyframe shares nothing.
+ */
+void generateDummyMap(System& system, vector<KeyFrame*> &keyframes, vector<MapPoint*> &mappoints){
+	Map *pMap = new Map;
+	for(int i=0; i<N_KEYFRAMES; i++){
+		KeyFrame *pKF = new KeyFrame(NULL);
+		pKF->mnId = i;
+		pKF->N = N_FEATURES;
+		pKF->mK = Mat::eye(3,3,CV_32F);
+		pKF->Tcw = poseAt(20*i);
+		pKF->mGrid.assign(1, vector<vector<size_t> >(1));
+		pKF->mDescriptors = Mat::zeros(N_FEATURES, 32, CV_8UC1);
+		for(int j=0; j<N_FEATURES; j++){
+			pKF->mvKeysUn.push_back(KeyPoint(i, j, 31, 0, 0, j%8));
+			pKF->mGrid[0][0].push_back(j);
+		}
+		pKF->mvpMapPoints.resize(N_FEATURES, NULL);
+		pMap->mspKeyFrames.insert(pKF);
+		keyframes.push_back(pKF);
+	}
+
+	for(int i=0; i<N_KEYFRAMES-2; i++){
+		MapPoint *pMP = new MapPoint(NULL);
+		pMP->mnId = i;
+		pMP->mWorldPos = Mat::zeros(3, 1, CV_32F);
+		pMP->mDescriptor = Mat::zeros(1, 32, CV_8UC1);
+		pMP->mpRefKF = keyframes[i+1];
+		keyframes[i  ]->mvpMapPoints[N_FEATURES-1] = pMP;
+		keyframes[i+1]->mvpMapPoints[0] = pMP;
+		pMP->AddObservation(keyframes[i], N_FEATURES-1);
+		pMP->AddObservation(keyframes[i+1], 0);
+		pMap->mspMapPoints.insert(pMP);
+		mappoints.push_back(pMP);
+	}
+
+	KeyFrame::nNextId = N_KEYFRAMES;
+	MapPoint::nNextId = N_KEYFRAMES-2;
+	pMap->mnMaxKFid = N_KEYFRAMES - 1;
+
+	system.mpMap = pMap;
+	system.mpKeyFrameDatabase = new KeyFrameDatabase;
+}
+
+/*
+ * Global bundle adjustment reads the keypoint of every observation of every mappoint.
+ * Returns false if any of them was paged out.
+ */
+bool globalBundleAdjustment(vector<MapPoint*> &mappoints){
+	try{
+		for(MapPoint *pMP : mappoints)
+			for(auto &observation : pMP->mObservations)
+				observation.first->mvKeysUn.at(observation.second);
+	} catch(out_of_range &e){
+		cout << "Global bundle adjustment read paged out features" << endl;
+		return false;
+	}
+	return true;
+}
+
+/*
+ * Relocalization matches descriptors of every candidate keyframe, any keyframe in the map.
+ * Returns false if any keyframe has its features paged out.
+ */
+bool relocalization(vector<KeyFrame*> &keyframes){
+	for(KeyFrame *pKF : keyframes)
+		if(pKF->mDescriptors.rows != pKF->N || pKF->mvKeysUn.size() != (size_t)pKF->N){
+			cout << "Relocalization missed keyframe " << pKF->mnId << endl;
+			return false;
+		}
+	return true;
+}
+
+/*
+ * main arguments:
+ *
+ * 1º argument: page file name.  Defaults to exampleDummyMap.pages.
+ */
+int main(int argc, char **argv){
+	System system;
+	vector<KeyFrame*> keyframes;
+	vector<MapPoint*> mappoints;
+	generateDummyMap(system, keyframes, mappoints);
+
+	system.mpTracker->mbOnlyTracking = true;	// Localization mode
+	system.mpTracker->mState = Tracking::OK;
+	Osmap osmap(system);
+	osmap.pageOpen(argc == 1? "exampleDummyMap.pages" : argv[1]);
+
+	/*
+	 * Camera on keyframe 0.  Keyframes 1 and 2 are far, but two observations away: pinned.
+	 * Keyframe 3 is three observations away, keyframes 4 and 5 aren't reachable: paged out.
+	 */
+	int nPaged = osmap.pageUpdate(poseAt(0));
+	cout << "Keyframes paged out: " << nPaged << endl;
+	bool ok = nPaged == 3;
+	for(int i=0; i<N_KEYFRAMES; i++){
+		bool resident = keyframes[i]->mvKeysUn.size() == N_FEATURES;
+		cout << "Keyframe " << i << (resident? " resident" : " paged out") << endl;
+		ok = ok && resident == (i < 3);
+	}
+
+	// Local map of keyframe 0: its covisible keyframe 1, and their mappoints 0 and 1
+	try{
+		for(int i=0; i<2; i++){
+			mappoints[i]->UpdateNormalAndDepth();
+			mappoints[i]->ComputeDistinctiveDescriptors();
+		}
+	} catch(out_of_range &e){
+		cout << e.what() << " read paged out features" << endl;
+		ok = false;
+	}
+
+	// Camera moves to keyframe 3: paged in synchronously, with keyframe 4.  Keyframe 0 is paged out, keyframe 5 stays paged out.
+	nPaged = osmap.pageUpdate(poseAt(60));
+	cout << "Keyframes paged out after moving: " << nPaged << endl;
+	ok = ok && nPaged == 2;
+	for(int i=0; i<N_KEYFRAMES; i++)
+		ok = ok && (keyframes[i]->mDescriptors.rows == N_FEATURES) == (i > 0 && i < 5);
+
+	// Local map of keyframe 3: its covisible keyframes 2 and 4, and their mappoints 1, 2 and 3
+	try{
+		for(int i=1; i<4; i++){
+			mappoints[i]->UpdateNormalAndDepth();
+			mappoints[i]->ComputeDistinctiveDescriptors();
+		}
+	} catch(out_of_range &e){
+		cout << e.what() << " read paged out features" << endl;
+		ok = false;
+	}
+
+	// Loop closing launches global bundle adjustment: every keyframe paged in
+	system.mpLoopCloser->mbRunningGBA = true;
+	nPaged = osmap.pageUpdate(poseAt(60));
+	ok = ok && nPaged == 0 && globalBundleAdjustment(mappoints);
+	system.mpLoopCloser->mbRunningGBA = false;
+
+	// Tracking lost, TrackMonocular returns an empty pose: every keyframe paged in before relocalization
+	ok = ok && osmap.pageUpdate(poseAt(60)) == 2;
+	system.mpTracker->mState = Tracking::LOST;
+	nPaged = osmap.pageUpdate(Mat());
+	ok = ok && nPaged == 0 && relocalization(keyframes);
+	system.mpTracker->mState = Tracking::OK;
+
+	// Leaving localization mode: local mapping and loop closing resume, every keyframe paged in
+	ok = ok && osmap.pageUpdate(poseAt(60)) == 2;
+	system.mpTracker->mbOnlyTracking = false;
+	nPaged = osmap.pageUpdate(poseAt(60));
+	ok = ok && nPaged == 0 && globalBundleAdjustment(mappoints) && relocalization(keyframes);
+
+	osmap.pageClose();
+	cout << (ok? "Feature paging test passed" : "Feature paging test FAILED") << endl;
+	return ok? 0 : 1;
+}
@@ -0,0 +1,119 @@
+/*
+Load time benchmark on ficticious maps of growing size.
+
+Each map is generated, saved and loaded again with every available codec, reporting files size and load time.
+Like the save and load map test, it must be compiled with OSMAP_DUMMY_MAP symbol defined.
+Define OSMAP_LZ4 and OSMAP_ZSTD, and link liblz4 and libzstd, to benchmark those codecs.
+*/
+
+#include <Osmap.h>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+
+using namespace std;
+using namespace cv;
+using namespace ORB_SLAM2;
+
+unsigned int MapPoint::nNextId = 0;
+unsigned int KeyFrame::nNextId = 0;
+
+
+/*
+ * Generates a map with nMappoints mappoints and nKeyframes keyframes, each one with nFeatures features.
+ * Mappoint ids are sparse, like in a map with culled mappoints.
+ */
+void generateDummyMap(System& system, int nMappoints, int nKeyframes, int nFeatures){
+	Map *pMap = new Map;
+	vector<MapPoint*> mappoints;
+
+	unsigned char dataDescriptor[32];
+	for(int i=0; i<32; i++) dataDescriptor[i] = i;
+	Mat descriptorModel = Mat(1, 32, CV_8UC1, dataDescriptor);
+
+	// Generate MapPoints
+	for(int i=0; i<nMappoints; i++){
+		MapPoint *pMP = new MapPoint(NULL);
+		pMP->mnId = 3*i + 1;
+		pMP->mWorldPos = Mat(3, 1, CV_32F);
+		pMP->mWorldPos.at<float>(0,0) = rand() % 1000;
+		pMP->mWorldPos.at<float>(1,0) = rand() % 1000;
+		pMP->mWorldPos.at<float>(2,0) = rand() % 1000;
+		pMP->mDescriptor = descriptorModel;
+		pMap->mspMapPoints.insert(pMP);
+		mappoints.push_back(pMP);
+	}
+
+	// Generate KeyFrames, each one observing mappoints scattered along the map
+	for(int i=0; i<nKeyframes; i++){
+		KeyFrame *pKF = new KeyFrame(NULL);
+		pKF->mnId = 2*i;
+		pKF->N = nFeatures;
+		pKF->mK  = Mat::eye(3,3,CV_32F);
+		pKF->Tcw = Mat::eye(4,4,CV_32F);
+		for(int j=0; j<nFeatures; j++){
+			pKF->mvKeysUn.push_back(KeyPoint(rand() % 640, rand() % 480, 0, rand() % 360, 0, rand() % 8));
+			pKF->mDescriptors.push_back(descriptorModel);
+			pKF->mvpMapPoints.push_back(mappoints[rand() % nMappoints]);
+		}
+		pMap->mspKeyFrames.insert(pKF);
+	}
+
+	KeyFrame::nNextId = 2*nKeyframes;
+	pMap->mnMaxKFid = 2*(nKeyframes-1);
+
+	system.mpMap = pMap;
+	system.mpKeyFrameDatabase = new KeyFrameDatabase;
+}
+
+/*
+ * Size of a file in bytes, 0 if it doesn't exist.
+ */
+long fileSize(string filename){
+	ifstream file(filename, ifstream::binary | ifstream::ate);
+	return file? (long)file.tellg() : 0;
+}
+
+/*
+ * main arguments:
+ *
+ * 1º argument: number of maps to benchmark, each one doubling the size of the previous one.  Defaults to 4.
+ * 2º argument: options, a number.  Defaults to 0.
+ * 3º argument: threads, see Osmap::threads.  Defaults to 1.
+ */
+int main(int argc, char **argv){
+	int nMaps = argc>1? atoi(argv[1]) : 4;
+	int nMappoints = 10000, nKeyframes = 100, nFeatures = 500;
+
+	for(int i=0; i<nMaps; i++, nMappoints *= 2, nKeyframes *= 2){
+		System system;
+		generateDummyMap(system, nMappoints, nKeyframes, nFeatures);
+
+		Osmap osmap(system);
+		int options = argc>2? stoi(argv[2]) : 0;
+		osmap.threads = argc>3? atoi(argv[3]) : 1;
+
+		// The same map is saved and loaded with each codec
+		for(int codec = Osmap::NO_CODEC; codec < Osmap::CODECS_SIZE; codec++){
+			if(!Osmap::codecAvailable((Osmap::Codecs)codec)) continue;
+			osmap.options = options;
+			osmap.options.set(Osmap::NO_SET_BAD);
+			osmap.options.set(Osmap::NO_DEPURATION);
+			osmap.codec = (Osmap::Codecs)codec;
+
+			osmap.mapSave("benchmarkMap");
+			long size = osmap.options[Osmap::SINGLE_FILE]? fileSize("benchmarkMap.osmap") :
+				fileSize("benchmarkMap.yaml") + fileSize("benchmarkMap.mappoints") + fileSize("benchmarkMap.keyframes") + fileSize("benchmarkMap.features");
+
+			auto start = chrono::steady_clock::now();
+			osmap.mapLoad(osmap.options[Osmap::SINGLE_FILE]? "benchmarkMap.osmap" : "benchmarkMap.yaml", true);
+			chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+			cout << endl << "Mappoints: " << nMappoints << ", keyframes: " << nKeyframes << ", features: " << nKeyframes*nFeatures
+				 << ", codec: " << codec << ", size: " << size << " bytes, load time: " << elapsed.count() << " s" << endl << endl;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,243 @@
+/*
+Round trip test of the compact encodings on a ficticious map.
+
+The map is saved with QUANTIZED, DENSE_IDS, POSE_DELTAS, DESCRIPTOR_RESIDUALS, BOW and KEYFRAME_DATABASE options, and loaded back.
+Loaded ids are the saved ones renumbered in id order from 0, poses and positions are within the quantization error,
+descriptors, bags of words and the keyframe database's inverted index are exact.
+*/
+
+#include <Osmap.h>
+#include <iostream>
+#include <cmath>
+
+using namespace std;
+using namespace cv;
+using namespace ORB_SLAM2;
+
+#define N_MAPPOINTS 50	// Number of fake MapPoints in map
+#define N_KEYFRAMES 12	// Number of fake KeyFrames in map
+#define N_FEATURES 19	// Number of fake features in each KeyFrame
+#define N_WORDS 40		// Number of words in the fake vocabulary
+
+unsigned int MapPoint::nNextId = 0;
+unsigned int KeyFrame::nNextId = 0;
+
+// Deterministic descriptor bytes
+Mat descriptor(int seed){
+	Mat d(1, 32, CV_8UC1);
+	for(int k=0; k<32; k++)
+		d.at<uchar>(0,k) = (seed*131 + k*29 + (seed*k)%7) & 0xFF;
+	return d;
+}
+
+// Vocabulary words and weights, needed by BOW and KEYFRAME_DATABASE fingerprints
+void generateVocabulary(ORBVocabulary &vocabulary){
+	for(int i=0; i<N_WORDS; i++){
+		vocabulary.words.push_back(descriptor(1000 + i));
+		vocabulary.weights.push_back(1.0 / (1 + i%7));
+	}
+}
+
+/*
+ * Ids have gaps, so DENSE_IDS renumbers them.  Keyframes move along a curve, turning around the z axis.
+ * Every other feature observes a mappoint, with its descriptor equal to the mappoint's one or a few bits away, so residuals are both empty and not.
+ */
+void generateDummyMap(System& system, const ORBVocabulary &vocabulary){
+	Map *pMap = new Map;
+	KeyFrameDatabase *pDatabase = new KeyFrameDatabase;
+
+	vector<MapPoint*> mappoints;
+	for(int i=0; i<N_MAPPOINTS; i++){
+		MapPoint *pMP = new MapPoint(NULL);
+		pMP->mnId = 3*i + 1;
+		pMP->mnVisible = 10 + i;
+		pMP->mnFound = 5 + i;
+		pMP->mWorldPos = Mat(3, 1, CV_32F);
+		pMP->mWorldPos.at<float>(0,0) = 10*cos(i*0.3);
+		pMP->mWorldPos.at<float>(1,0) = 0.1*i - 2;
+		pMP->mWorldPos.at<float>(2,0) = 10*sin(i*0.3) + 5;
+		pMP->mDescriptor = descriptor(i);
+		pMap->mspMapPoints.insert(pMP);
+		mappoints.push_back(pMP);
+	}
+
+	for(int i=0; i<N_KEYFRAMES; i++){
+		KeyFrame *pKF = new KeyFrame(NULL);
+		pKF->mnId = 2*i + 3;
+		pKF->mTimeStamp = 0.5*i;
+		pKF->N = N_FEATURES;
+		pKF->mK = Mat::eye(3,3,CV_32F);
+		float angle = 0.1*i, c = cos(angle), s = sin(angle);
+		pKF->Tcw = Mat::eye(4,4,CV_32F);
+		pKF->Tcw.at<float>(0,0) = c;  pKF->Tcw.at<float>(0,1) = -s;
+		pKF->Tcw.at<float>(1,0) = s;  pKF->Tcw.at<float>(1,1) = c;
+		pKF->Tcw.at<float>(0,3) = -0.7*i;
+		pKF->Tcw.at<float>(1,3) = 0.05*i*i;
+		pKF->Tcw.at<float>(2,3) = 1.3;
+
+		for(int j=0; j<N_FEATURES; j++){
+			MapPoint *pMP = j%2? NULL : mappoints[(i*5 + j) % N_MAPPOINTS];
+			Mat featureDescriptor = pMP? pMP->mDescriptor.clone() : descriptor(100*i + j + N_MAPPOINTS);
+			if(pMP && j%4 == 2)
+				featureDescriptor.at<uchar>(0, j) ^= 0x11;
+			pKF->mvKeysUn.push_back(KeyPoint(10 + 31.3*j, 20 + 7.7*i, 31, 12.5*j, 0, j%8));
+			pKF->mDescriptors.push_back(featureDescriptor);
+			pKF->mvpMapPoints.push_back(pMP);
+
+			// Bag of words: one word per feature, two words per node
+			unsigned int word = (7*i + 3*j) % N_WORDS;
+			pKF->mBowVec[word] += vocabulary.weights[word];
+			pKF->mFeatVec[word/2].push_back(j);
+		}
+		pMap->mspKeyFrames.insert(pKF);
+		pDatabase->add(pKF);
+	}
+
+	KeyFrame::nNextId = 2*N_KEYFRAMES + 3;
+	MapPoint::nNextId = 3*N_MAPPOINTS + 1;
+	pMap->mnMaxKFid = 2*N_KEYFRAMES + 1;
+
+	system.mpMap = pMap;
+	system.mpKeyFrameDatabase = pDatabase;
+}
+
+// Like OsmapKeyFrameDatabase, only for casting, to read the protected inverted file
+class KeyFrameDatabaseReader: public KeyFrameDatabase{
+public:
+	using KeyFrameDatabase::mvInvertedFile;
+};
+
+/*
+ * Map content by dense id, the position in id order, to compare with the loaded map.
+ */
+struct Snapshot{
+	vector<Mat> positions, mappointDescriptors, poses, descriptors;
+	vector<vector<int> > observations;	// Dense id of each feature's mappoint, -1 if none
+	vector<DBoW2::BowVector> bows;
+	vector<DBoW2::FeatureVector> featureVectors;
+	vector<vector<int> > invertedFile;	// Dense ids of keyframes of each word, in the database order
+};
+
+Snapshot snapshot(System &system){
+	Snapshot snapshot;
+	map<unsigned int, MapPoint*> mappoints;
+	map<unsigned int, KeyFrame*> keyframes;
+	for(auto pMP : system.mpMap->mspMapPoints) mappoints[pMP->mnId] = pMP;
+	for(auto pKF : system.mpMap->mspKeyFrames) keyframes[pKF->mnId] = pKF;
+	map<MapPoint*, int> mappointDenseIds;
+	map<KeyFrame*, int> keyframeDenseIds;
+
+	for(auto &mappoint : mappoints){
+		mappointDenseIds[mappoint.second] = snapshot.positions.size();
+		snapshot.positions.push_back(mappoint.second->mWorldPos.clone());
+		snapshot.mappointDescriptors.push_back(mappoint.second->mDescriptor.clone());
+	}
+	for(auto &keyframe : keyframes){
+		KeyFrame *pKF = keyframe.second;
+		keyframeDenseIds[pKF] = snapshot.poses.size();
+		snapshot.poses.push_back(pKF->Tcw.clone());
+		snapshot.descriptors.push_back(pKF->mDescriptors.clone());
+		snapshot.observations.emplace_back();
+		for(auto pMP : pKF->mvpMapPoints)
+			snapshot.observations.back().push_back(pMP? mappointDenseIds[pMP] : -1);
+		snapshot.bows.push_back(pKF->mBowVec);
+		snapshot.featureVectors.push_back(pKF->mFeatVec);
+	}
+	for(auto &keyframesOfWord : static_cast<KeyFrameDatabaseReader*>(system.mpKeyFrameDatabase)->mvInvertedFile){
+		snapshot.invertedFile.emplace_back();
+		for(auto pKF : keyframesOfWord)
+			snapshot.invertedFile.back().push_back(keyframeDenseIds.count(pKF)? keyframeDenseIds[pKF] : -1);
+	}
+	// Trailing empty words aren't saved
+	while(!snapshot.invertedFile.empty() && snapshot.invertedFile.back().empty())
+		snapshot.invertedFile.pop_back();
+	return snapshot;
+}
+
+// Maximum absolute difference between two float matrices of the same size, infinity if sizes differ
+float difference(const Mat &a, const Mat &b){
+	if(a.rows != b.rows || a.cols != b.cols)
+		return INFINITY;
+	float d = 0;
+	for(int i=0; i<a.rows; i++)
+		for(int j=0; j<a.cols; j++)
+			d = max(d, fabs(a.at<float>(i,j) - b.at<float>(i,j)));
+	return d;
+}
+
+// Byte per byte equality of two descriptor matrices
+bool equal(const Mat &a, const Mat &b){
+	if(a.rows != b.rows || a.cols != b.cols)
+		return false;
+	for(int i=0; i<a.rows; i++)
+		for(int j=0; j<a.cols; j++)
+			if(a.at<uchar>(i,j) != b.at<uchar>(i,j))
+				return false;
+	return true;
+}
+
+/*
+ * main arguments:
+ *
+ * 1º argument: file name.  Defaults to exampleDummyMap.
+ */
+int main(int argc, char **argv){
+	ORBVocabulary vocabulary;
+	generateVocabulary(vocabulary);
+	System system;
+	system.mpTracker->mCurrentFrame.mpORBvocabulary = &vocabulary;
+	generateDummyMap(system, vocabulary);
+
+	Osmap osmap(system);
+	string filename = argc == 1? "exampleDummyMap" : argv[1];
+	for(int option : {Osmap::QUANTIZED, Osmap::DENSE_IDS, Osmap::POSE_DELTAS, Osmap::DESCRIPTOR_RESIDUALS, Osmap::BOW, Osmap::KEYFRAME_DATABASE, Osmap::NO_SET_BAD, Osmap::NO_DEPURATION})
+		osmap.options.set(option);
+
+	// Quantization errors of this map, the tolerance of poses and positions
+	osmap.getMapPointsFromMap();
+	osmap.getKeyFramesFromMap();
+	osmap.getBoundingBox();
+	OsmapQuantizationError error = osmap.quantizationError();
+	osmap.clearVectors();
+	cout << "Quantization errors: position " << error.position << ", pose " << error.pose << endl;
+
+	Snapshot saved = snapshot(system);
+	osmap.mapSave(filename);
+	osmap.mapLoad(filename + ".yaml", true);
+	Snapshot loaded = snapshot(system);
+
+	// Ids, renumbered from 0 without gaps
+	bool ok = loaded.positions.size() == N_MAPPOINTS && loaded.poses.size() == N_KEYFRAMES;
+	unsigned int id = 0;
+	for(auto pMP : system.mpMap->mspMapPoints) id = max(id, pMP->mnId);
+	ok = ok && id == N_MAPPOINTS - 1;
+	id = 0;
+	for(auto pKF : system.mpMap->mspKeyFrames) id = max(id, pKF->mnId);
+	ok = ok && id == N_KEYFRAMES - 1;
+	cout << "Ids " << (ok? "renumbered" : "differ") << endl;
+
+	// Positions and poses within quantization errors, descriptors exact
+	float positionDifference = 0, poseDifference = 0;
+	bool descriptorsEqual = true;
+	for(size_t i=0; ok && i<N_MAPPOINTS; i++){
+		positionDifference = max(positionDifference, difference(saved.positions[i], loaded.positions[i]));
+		descriptorsEqual = descriptorsEqual && equal(saved.mappointDescriptors[i], loaded.mappointDescriptors[i]);
+	}
+	for(size_t i=0; ok && i<N_KEYFRAMES; i++){
+		poseDifference = max(poseDifference, difference(saved.poses[i], loaded.poses[i]));
+		descriptorsEqual = descriptorsEqual && equal(saved.descriptors[i], loaded.descriptors[i]);
+	}
+	cout << "Differences: position " << positionDifference << ", pose " << poseDifference << endl;
+	ok = ok && positionDifference <= error.position*1.001 + 1e-6 && poseDifference <= error.pose*1.001 + 1e-6;
+	ok = ok && descriptorsEqual && saved.observations == loaded.observations;
+	cout << "Descriptors and observations " << (descriptorsEqual && saved.observations == loaded.observations? "equal" : "differ") << endl;
+
+	// Bags of words and keyframe database exact
+	bool bowEqual = saved.bows == loaded.bows && saved.featureVectors == loaded.featureVectors;
+	bool databaseEqual = saved.invertedFile == loaded.invertedFile;
+	cout << "Bags of words " << (bowEqual? "equal" : "differ") << ", keyframe database " << (databaseEqual? "equal" : "differ") << endl;
+	ok = ok && bowEqual && databaseEqual;
+
+	cout << (ok? "Round trip test passed" : "Round trip test FAILED") << endl;
+	return ok? 0 : 1;
+}
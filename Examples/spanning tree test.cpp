@@ -0,0 +1,109 @@
+/*
+Spanning tree repair test on a ficticious map.
+
+Keyframes 1 and 2 are each other's parent, a cycle, and keyframe 3 hangs from keyframe 2.
+Keyframe 1 is covisible with keyframe 0, the root, and keyframes 1, 2 and 3 are covisible in a chain.
+After saving with the COVISIBILITY option and loading, every keyframe must hang from keyframe 0.
+*/
+
+#include <Osmap.h>
+#include <iostream>
+#include <algorithm>
+
+using namespace std;
+using namespace cv;
+using namespace ORB_SLAM2;
+
+#define N_KEYFRAMES 4	// Number of fake KeyFrames in map
+
+unsigned int MapPoint::nNextId = 0;
+unsigned int KeyFrame::nNextId = 0;
+
+// Symmetric covisibility connection
+void link(KeyFrame *pKF1, KeyFrame *pKF2, int weight){
+	pKF1->mConnectedKeyFrameWeights[pKF2] = weight;
+	pKF2->mConnectedKeyFrameWeights[pKF1] = weight;
+}
+
+void generateDummyMap(System& system){
+	Map *pMap = new Map;
+
+	MapPoint *pMP = new MapPoint(NULL);
+	pMP->mnId = 0;
+	pMP->mWorldPos = Mat::zeros(3, 1, CV_32F);
+	pMP->mDescriptor = Mat::zeros(1, 32, CV_8UC1);
+	pMap->mspMapPoints.insert(pMP);
+
+	vector<KeyFrame*> keyframes;
+	for(int i=0; i<N_KEYFRAMES; i++){
+		KeyFrame *pKF = new KeyFrame(NULL);
+		pKF->mnId = i;
+		pKF->N = 1;
+		pKF->mK = Mat::eye(3,3,CV_32F);
+		pKF->Tcw = Mat::eye(4,4,CV_32F);
+		pKF->mvKeysUn.push_back(KeyPoint(i, i, 31, 0, 0, 0));
+		pKF->mDescriptors = Mat::zeros(1, 32, CV_8UC1);
+		pKF->mvpMapPoints.push_back(pMP);
+		pMap->mspKeyFrames.insert(pKF);
+		keyframes.push_back(pKF);
+	}
+
+	link(keyframes[0], keyframes[1], 30);
+	link(keyframes[1], keyframes[2], 20);
+	link(keyframes[2], keyframes[3], 10);
+	// Connections ordered by weight, as UpdateConnections does
+	for(KeyFrame *pKF : keyframes){
+		vector<pair<int, KeyFrame*> > connections;
+		for(auto &connection : pKF->mConnectedKeyFrameWeights)
+			connections.push_back(make_pair(connection.second, connection.first));
+		sort(connections.rbegin(), connections.rend());
+		for(auto &connection : connections){
+			pKF->mvpOrderedConnectedKeyFrames.push_back(connection.second);
+			pKF->mvOrderedWeights.push_back(connection.first);
+		}
+	}
+
+	// Parent cycle, and a chain hanging from it
+	keyframes[1]->mpParent = keyframes[2];
+	keyframes[2]->mpParent = keyframes[1];
+	keyframes[3]->mpParent = keyframes[2];
+
+	KeyFrame::nNextId = N_KEYFRAMES;
+	MapPoint::nNextId = 1;
+	pMap->mnMaxKFid = N_KEYFRAMES - 1;
+
+	system.mpMap = pMap;
+	system.mpKeyFrameDatabase = new KeyFrameDatabase;
+}
+
+/*
+ * main arguments:
+ *
+ * 1º argument: file name.  Defaults to exampleDummyMap.
+ */
+int main(int argc, char **argv){
+	System system;
+	generateDummyMap(system);
+
+	Osmap osmap(system);
+	string filename = argc == 1? "exampleDummyMap" : argv[1];
+	osmap.options.set(Osmap::COVISIBILITY);
+	osmap.options.set(Osmap::NO_SET_BAD);
+	osmap.options.set(Osmap::NO_DEPURATION);
+	osmap.mapSave(filename);
+	osmap.mapLoad(filename + ".yaml", true);
+
+	// Every keyframe's parents chain must end in keyframe 0, the only root
+	bool ok = system.mpMap->mspKeyFrames.size() == N_KEYFRAMES;
+	for(KeyFrame *pKF : system.mpMap->mspKeyFrames){
+		KeyFrame *pRoot = pKF;
+		int steps = 0;
+		while(pRoot->mpParent && steps++ <= N_KEYFRAMES)
+			pRoot = pRoot->mpParent;
+		cout << "Keyframe " << pKF->mnId << ", parent " << (pKF->mpParent? (int)pKF->mpParent->mnId : -1) << ", root " << (pRoot->mpParent? -1 : (int)pRoot->mnId) << endl;
+		ok = ok && !pRoot->mpParent && pRoot->mnId == 0;
+	}
+
+	cout << (ok? "Spanning tree test passed" : "Spanning tree test FAILED") << endl;
+	return ok? 0 : 1;
+}
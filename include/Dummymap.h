@@ -23,14 +23,39 @@
 
 #include <set>
 #include <map>
+#include <vector>
+#include <list>
+#include <mutex>
+#include <stdexcept>
 #include <opencv2/core.hpp>
 
+/*
+ * Bag of words as in DBoW2: word values by word id, and features' indices by vocabulary node id.
+ */
+namespace DBoW2{
+class BowVector: public std::map<unsigned int, double>{};
+class FeatureVector: public std::map<unsigned int, std::vector<unsigned int> >{};
+}
+
 namespace ORB_SLAM2{
 
 class KeyFrame;
 class Map;
 class Osmap;
 
+/*
+ * Vocabulary with words and weights, only as fingerprinted by Osmap.
+ */
+class ORBVocabulary{
+public:
+  std::vector<cv::Mat> words;
+  std::vector<double> weights;
+
+  unsigned int size() const {return words.size();}
+  cv::Mat getWord(unsigned int i) const {return words[i];}
+  double getWordWeight(unsigned int i) const {return weights[i];}
+};
+
 class MapPoint{
 public:
   static unsigned int nNextId;
@@ -41,13 +66,17 @@ public:
   int mnFound=0;
   cv::Mat mDescriptor;
   KeyFrame *mpRefKF = NULL;
+  cv::Mat mNormalVector;
+  float mfMinDistance = 0;
+  float mfMaxDistance = 0;
   std::map<KeyFrame*,size_t> mObservations;
   Map *mpMap = NULL;
 
   MapPoint(Osmap*){};
-  void AddObservation(KeyFrame*, size_t){}
+  void AddObservation(KeyFrame *pKF, size_t idx){mObservations[pKF] = idx;}
   void SetBadFlag(){}
-  void UpdateNormalAndDepth(){}
+  void UpdateNormalAndDepth();
+  void ComputeDistinctiveDescriptors();
 };
 
 class KeyFrame{
@@ -71,15 +100,34 @@ public:
   std::vector<std::vector<std::vector<size_t> > > mGrid;
   std::map<KeyFrame*, int> mConnectedKeyFrameWeights;
   std::vector<KeyFrame*> mvpOrderedConnectedKeyFrames;
+  DBoW2::BowVector mBowVec;
+  DBoW2::FeatureVector mFeatVec;
+  std::vector<int> mvOrderedWeights;
+  bool mbFirstConnection = true;
 
   KeyFrame(Osmap*){};
   void ComputeBoW(){}
   void SetPose(cv::Mat){}
   void UpdateConnections(){}
   void SetBadFlag(){}
-  void ChangeParent(KeyFrame *pKF){}
+  void ChangeParent(KeyFrame *pKF){mpParent = pKF;}
 };
 
+/*
+ * As in ORB-SLAM2, these read keyframes' features by observation index: the reference keyframe's keypoint, and every observing keyframe's descriptor.
+ * Reading released features throws std::out_of_range.
+ */
+inline void MapPoint::UpdateNormalAndDepth(){
+  if(mpRefKF && mObservations.count(mpRefKF))
+    mpRefKF->mvKeysUn.at(mObservations[mpRefKF]);
+}
+
+inline void MapPoint::ComputeDistinctiveDescriptors(){
+  for(auto &observation : mObservations)
+    if(!observation.first->mbBad && (int)observation.second >= observation.first->mDescriptors.rows)
+      throw std::out_of_range("MapPoint::ComputeDistinctiveDescriptors");
+}
+
 
 class Map{
 public:
@@ -91,11 +139,27 @@ public:
 
 class KeyFrameDatabase{
 public:
-	void add(KeyFrame *pKF){}
-	void clear(){}
+	void add(KeyFrame *pKF){
+		for(auto &word : pKF->mBowVec){
+			if(mvInvertedFile.size() <= word.first) mvInvertedFile.resize(word.first + 1);
+			mvInvertedFile[word.first].push_back(pKF);
+		}
+	}
+	void clear(){mvInvertedFile.clear();}
+protected:
+	std::vector<std::list<KeyFrame*> > mvInvertedFile;
+	std::mutex mMutex;
 };
 
-class Frame{};
+class Frame{
+public:
+  ORBVocabulary *mpORBvocabulary = NULL;
+};
+
+class Tracking{
+public:
+	enum eTrackingState{SYSTEM_NOT_READY=-1, NO_IMAGES_YET=0, NOT_INITIALIZED=1, OK=2, LOST=3};
+};
 
 class System{
 public:
@@ -106,8 +170,14 @@ public:
 	public:
 		Frame mCurrentFrame;
 		int mState = 0;
+		bool mbOnlyTracking = false;
 		void Reset(){};
-	} *mpTracker;
+	} *mpTracker = new Tracker;
+	class LoopCloser{
+	public:
+		bool mbRunningGBA = false;
+		bool isRunningGBA(){return mbRunningGBA;};
+	} *mpLoopCloser = new LoopCloser;
 	class DummyClasses{
 	public:
 		void RequestStop(){};
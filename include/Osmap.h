@@ -25,8 +25,13 @@
 #include <set>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <bitset>
 #include <iterator>
+#include <functional>
+#include <future>
+#include <string>
 #include "osmap.pb.h"
 #include <set>
 #include <opencv2/core/core.hpp>
@@ -81,6 +86,125 @@ public:
 	friend class Osmap;
 };
 
+/**
+ * Wrapped KeyFrameDatabase to let Osmap access its inverted index without modifying KeyFrameDatabase code.
+ * This class is only used for casting.
+ */
+class OsmapKeyFrameDatabase: public KeyFrameDatabase{
+public:
+	friend class Osmap;
+};
+
+
+
+/**
+ * Read only memory map of a whole file, used to parse map files without copying them through stream buffers.
+ * The file is mapped on construction with a sequential access hint, and unmapped on destruction.
+ */
+class OsmapMappedFile{
+public:
+	/** First byte of the mapped file.  NULL if the file couldn't be mapped or is empty. */
+	const char *data = NULL;
+
+	/** File size in bytes. */
+	size_t size = 0;
+
+	/** Whether the file was opened.  An empty file is opened, but not mapped. */
+	bool isOpen = false;
+
+	OsmapMappedFile(const std::string &filename);
+	~OsmapMappedFile();
+	OsmapMappedFile(const OsmapMappedFile&) = delete;
+	OsmapMappedFile &operator=(const OsmapMappedFile&) = delete;
+};
+
+/**
+ * Entry of the section table in a single file map container, see option SINGLE_FILE.
+ * Offset and length locate the section's payload in the container, so any section can be read without reading the others.
+ */
+struct OsmapSection{
+	uint32_t type;		/*!< One of Osmap::SectionTypes. */
+	uint32_t codec;		/*!< Payload encoding.  0 is the plain section, as it would be saved in its own file. */
+	uint64_t offset;	/*!< Payload position in bytes, from the beginning of the container. */
+	uint64_t length;	/*!< Payload size in bytes. */
+};
+
+/**
+ * Maximum absolute errors QUANTIZED option introduces in a map, see Osmap::quantizationError.
+ */
+struct OsmapQuantizationError{
+	float position = 0;	/*!< Mappoints' coordinates, in map units. */
+	float pose = 0;		/*!< Keyframes' pose elements. */
+	float keypoint = 0;	/*!< Keypoints' coordinates, in pixels. */
+	float angle = 0;	/*!< Keypoints' angles, in degrees. */
+};
+
+/**
+ * Keyframe's features record in the page file, see Osmap::pageUpdate.
+ * Keypoints and descriptors don't change after keyframe creation, so a keyframe's record is written once, the first time it is paged out.
+ */
+struct OsmapPage{
+	uint64_t offset = 0;	/*!< Record position in the page file. */
+	uint32_t size = 0;		/*!< Record size in bytes, 0 if not written yet. */
+	bool paged = false;		/*!< Whether features are released from memory. */
+	std::future<std::string> loading;	/*!< Record being read to page features in, not valid if not loading. */
+};
+
+/**
+ * Spatial tile of a map saved with TILED option, see Osmap::getTiles.
+ * Its cell is the cube from (x, y, z)*tileSize to (x+1, y+1, z+1)*tileSize in world coordinates.
+ * Offsets and lengths locate the tile in the mappoints, keyframes and features sections, in this order.
+ */
+struct OsmapTile{
+	int x = 0, y = 0, z = 0;			/*!< Cell coordinates. */
+	uint64_t offset[3] = {0, 0, 0};		/*!< Tile position in each section, in bytes.  Tiles are one after another, in the index order. */
+	uint64_t length[3] = {0, 0, 0};		/*!< Tile size in each section, in bytes. */
+	bool selected = true;				/*!< Whether mapLoad loads it. */
+	std::vector<OsmapMapPoint*> mappoints;	/*!< Saving only: mappoints in the cell, and mappoints elsewhere observed by keyframes in the cell, in id order. */
+	std::vector<OsmapKeyFrame*> keyframes;	/*!< Saving only: keyframes whose camera center is in the cell, in id order. */
+};
+
+/**
+ * Covisibility graph edges and spanning tree parent of a loaded keyframe, with COVISIBILITY option.
+ * Kept by id until every keyframe is loaded, see Osmap::linkConnections.
+ */
+struct OsmapConnections{
+	std::vector<unsigned int> ids;	/*!< Covisible keyframes' ids, by descending weight. */
+	std::vector<int> weights;		/*!< Their weights. */
+	unsigned int parentId = 0;		/*!< Parent's id plus 1, 0 if none. */
+};
+
+/**
+ * Wall and CPU clocks reading, taken on construction.  Start of a phase, see Osmap::phaseEnd.
+ */
+struct OsmapClock{
+	double wallTime;	/*!< Steady clock, in seconds. */
+	double cpuTime;		/*!< Process CPU time, every thread's, in seconds. */
+	OsmapClock();
+};
+
+/**
+ * Time and counters of a mapSave or mapLoad phase, see Osmap::stats.
+ * A phase run many times, like once per features block, adds up in one entry.  Phases run by many threads at once add up their threads' wall times.
+ */
+struct OsmapPhase{
+	std::string name;		/*!< Section and step, like "mappoints serialize", "features parse" or "rebuild links". */
+	double wallTime = 0;	/*!< Elapsed seconds. */
+	double cpuTime = 0;		/*!< Process CPU seconds while the phase ran.  Phases running concurrently, like sections saved by many threads, count each other's CPU time. */
+	uint64_t objects = 0;	/*!< Mappoints, keyframes, features or words processed, 0 if the phase doesn't count them. */
+	uint64_t bytes = 0;		/*!< Bytes written, read, parsed or compressed, 0 if the phase doesn't count them. */
+	unsigned int runs = 0;	/*!< Times the phase ran. */
+};
+
+/**
+ * Statistics of the last mapSave or mapLoad, see Osmap::stats.
+ */
+struct OsmapStats{
+	std::vector<OsmapPhase> phases;	/*!< In the order they first ended. */
+	double wallTime = 0;	/*!< Whole mapSave or mapLoad call, in seconds. */
+	double cpuTime = 0;		/*!< Process CPU seconds in the whole call. */
+	uint64_t bytes = 0;		/*!< Map size in bytes as stored, written or read. */
+};
 
 
 /**
@@ -92,6 +216,23 @@ public:
 #define FEATURES_MESSAGE_LIMIT 1000000
 #endif
 
+/**
+ * OSMAP_CHUNK_SIZE is the size in bytes of the chunks a section is split into for compression, see Osmap::codec.
+ * Chunks are compressed and decompressed independently, many at once if threads property is not 1.
+ * This constant can be defined elsewhere before this point, or else is defined here.
+ */
+#ifndef OSMAP_CHUNK_SIZE
+#define OSMAP_CHUNK_SIZE (1<<20)
+#endif
+
+/**
+ * zstd compression level used by ZSTD_CODEC.  Higher levels compress better and slower, decompression speed is about the same.
+ * This constant can be defined elsewhere before this point, or else is defined here.
+ */
+#ifndef OSMAP_ZSTD_LEVEL
+#define OSMAP_ZSTD_LEVEL 3
+#endif
+
 using namespace std;
 using namespace cv;
 
@@ -209,9 +350,70 @@ public:
 	  NO_SET_BAD,		/*!< Avoids bad mappoints and keyframe detection while rebuilding the map, right after load.  Used with dummy maps examples to prevent anomally detection, because dummy maps have incomplete class implementations. */
 	  NO_APPEND_FOUND_MAPPOINTS,	/*!< On depuration process before save, avoids adding to the map any found good mappoint erroneously deleted from map. */
 
+	  // Encoding
+	  COLUMNAR_FEATURES,	/*!< Saves features in columns, one packed array per property and one blob for all descriptors in a keyframe, instead of one message per feature.  Smaller features file, faster to save and load. */
+
+	  // Container
+	  SINGLE_FILE,		/*!< Saves the whole map, header included, in one filename.osmap container instead of four files.  mapLoad recognizes the container by its .osmap extension. */
+
+	  // Lossy
+	  QUANTIZED,		/*!< Saves positions, poses and keypoints quantized: positions as fixed point relative to the map bounding box, keypoints coordinates in 1/16 pixel, angles in 8 bits.  Maximum errors are reported in the yaml header.  Meant for localization only maps. */
+
+	  // Ids
+	  DENSE_IDS,		/*!< Renumbers mappoints and keyframes in id order from 0, without gaps.  Ids are implicit, features refer to mappoints by position, timestamps and loop edges are delta coded.  Loaded map has the new ids. */
+
+	  // Poses
+	  QUATERNION_POSES,	/*!< Saves keyframes' rotations as unit quaternions: 7 values per pose instead of 12.  Loaded rotations are orthonormal. */
+	  POSE_DELTAS,		/*!< Saves each pose as the difference from the previous keyframe's pose, in id order.  Lossless, it pays off along continuous trajectories, specially with QUATERNION_POSES and QUANTIZED. */
+
+	  // Descriptors
+	  DESCRIPTOR_RESIDUALS,	/*!< Saves descriptors of features with mappoint as their XOR with the mappoint descriptor, only its nonzero bytes.  Lossless, unlike NO_FEATURES_DESCRIPTORS.  Compresses further with a codec. */
+
+	  // Incremental
+	  JOURNAL,			/*!< Following mapSave calls on the same map append only what changed to a journal file, see journalSave.  Every journalCompaction saves the whole map is saved again.  Not compatible with DENSE_IDS. */
+
+	  // Spatial
+	  TILED,			/*!< Partitions keyframes and mappoints in cubic tiles of tileSize side, each tile saved on its own, so mapLoad can load only the tiles around a position.  Features are saved delimited.  Not compatible with DENSE_IDS, POSE_DELTAS nor JOURNAL. */
+
+	  // Graph
+	  COVISIBILITY,		/*!< Saves keyframes' covisibility graph and spanning tree parent, restored on loading instead of rebuilt with UpdateConnections.  Edges weaker than covisibilityThreshold are not saved, except each keyframe's strongest one, saved on both keyframes. */
+
+	  // Bag of words
+	  BOW,				/*!< Saves keyframes' bag of words, mBowVec and mFeatVec, with a fingerprint of the vocabulary.  Loading restores them instead of calling ComputeBoW, unless the vocabulary differs.  Ignored with ONLY_MAPPOINTS_FEATURES, which renumbers features. */
+
+	  // Mappoints
+	  NORMAL_AND_DEPTH,	/*!< Saves mappoints' normal, depth range and reference keyframe, restored on loading instead of computed with UpdateNormalAndDepth. */
+
+	  // Keyframe database
+	  KEYFRAME_DATABASE,	/*!< Saves the keyframe database's inverted index in its own section, loaded in bulk instead of adding keyframes one by one, unless the vocabulary differs.  Not compatible with TILED. */
+
 	  OPTIONS_SIZE	// /*!< Number of options.  Not an option. */
   };
 
+  /**
+   * Sections of a map, as typed in a single file container's section table.
+   * Each section has the same content as the file it replaces.
+   */
+  enum SectionTypes {
+	  HEADER_SECTION = 1,	/*!< yaml header. */
+	  MAPPOINTS_SECTION,	/*!< Same as mappoints file. */
+	  KEYFRAMES_SECTION,	/*!< Same as keyframes file. */
+	  FEATURES_SECTION,		/*!< Same as features file. */
+	  DATABASE_SECTION		/*!< Same as keyframe database file, KEYFRAME_DATABASE option. */
+  };
+
+  /**
+   * Compression codecs for mappoints, keyframes and features, see codec property.
+   * Each codec is available only if osmap is compiled with its symbol defined (OSMAP_LZ4, OSMAP_ZSTD) and linked to its library.
+   */
+  enum Codecs {
+	  NO_CODEC,		/*!< Plain protocol buffers, the default. */
+	  LZ4_CODEC,	/*!< LZ4, fast compression and very fast decompression.  Needs OSMAP_LZ4. */
+	  ZSTD_CODEC,	/*!< zstd, better ratio than LZ4 with fast decompression.  Needs OSMAP_ZSTD. */
+
+	  CODECS_SIZE	// /*!< Number of codecs.  Not a codec. */
+  };
+
   /**
   Set of chosen options for serializing.  User must set options prior to saving a map.  Loading a map should reflect in this property the saved map options.
   */
@@ -262,18 +464,164 @@ public:
    */
   vector<OsmapMapPoint*> vectorMapPoints;
 
+  /**
+   * Index from MapPoint::mnId to the mappoint in vectorMapPoints, used by getMapPoint.
+   * It is a dense table indexed by id when ids are compact (see indexMapPoints).  It is built right after loading mappoints, and cleared with clearVectors.
+   */
+  vector<OsmapMapPoint*> mapPointsDenseIndex;
+
+  /**
+   * Same index as mapPointsDenseIndex, used instead of it when ids are too sparse for a dense table.
+   * At most one of both indices is populated.
+   */
+  unordered_map<unsigned int, OsmapMapPoint*> mapPointsHashIndex;
+
   /**
    * Buffer where map's keyframes are stored in ascending id order, to save them to file in this order.
    * This vector is set in mapSave, and it's left ontouched for user interest.
    */
   vector<OsmapKeyFrame*> vectorKeyFrames;
 
+  /**
+   * Index in vectorKeyFrames of the keyframe found in the last getKeyFrame call.
+   */
+  size_t lastKeyFrameIdx = 0;
+
 
   /**
    * Whether or not print on console info for debuging.
    */
   bool verbose = false;
 
+  /**
+   * Number of threads used to save and load the map.  1, the default, processes everything in the calling thread.  0 uses one thread per hardware core.
+   * It is not saved in the map file.
+   */
+  unsigned int threads = 1;
+
+  /**
+   * Codec used by mapSave to compress mappoints, keyframes and features.  It is saved in the yaml header, and mapLoad sets it to the loaded map's codec.
+   * Each section is split in chunks of OSMAP_CHUNK_SIZE bytes, compressed independently, below the delimited form of the features file.
+   * Each chunk is written as its uncompressed size and its compressed size, both uint32 little endian, followed by the compressed bytes.
+   */
+  Codecs codec = NO_CODEC;
+
+  /**
+   * Map bounding box, minimum x, y, z and then maximum x, y, z of mappoints' positions.
+   * Set by mapSave and read by mapLoad only with QUANTIZED option, whose positions are relative to it.  It is saved in the yaml header.
+   */
+  float boundingBox[6] = {0, 0, 0, 0, 0, 0};
+
+  /**
+   * JOURNAL option: number of incremental saves appended to the journal before mapSave saves the whole map again, folding the journal into it.
+   */
+  int journalCompaction = 16;
+
+  /**
+   * JOURNAL option: journal file of the last map saved or loaded, where mapSave appends.  Empty if there is none.
+   */
+  string journalFilename;
+
+  /**
+   * JOURNAL option: incremental saves in journalFilename.
+   */
+  int journalEntries = 0;
+
+  /**
+   * JOURNAL option: ids greater than the greatest mappoint and keyframe ids at the last save.  Objects from these ids on are new.
+   */
+  unsigned int mapPointWatermark = 0, keyFrameWatermark = 0;
+
+  /**
+   * JOURNAL option: fingerprints of mappoints, keyframes and features by id at the last save, see journalFingerprint.
+   * ORB-SLAM2 objects have no dirty flags, a different fingerprint tells an object changed.
+   */
+  unordered_map<unsigned int, size_t> mapPointFingerprints, keyFrameFingerprints, featuresFingerprints;
+
+  /**
+   * Feature pager: keyframes farther than this from the camera have their features paged out, see pageUpdate.  In map units.
+   */
+  float pageOutDistance = 10;
+
+  /**
+   * Feature pager: paged out keyframes closer than this to the camera have their features paged in.
+   * Less than pageOutDistance, so keyframes in between are not paged back and forth.
+   */
+  float pageInDistance = 8;
+
+  /**
+   * Feature pager: page file, opened by pageOpen.  Descriptor -1 if closed.
+   */
+  string pageFilename;
+  int pageFileDescriptor = -1;
+  uint64_t pageFileSize = 0;
+
+  /**
+   * Feature pager: page of every keyframe paged out at least once.
+   */
+  unordered_map<KeyFrame*, OsmapPage> pages;
+
+  /**
+   * TILED option: side of the cubic tiles, in map units.  mapLoad sets it to the loaded map's one.
+   */
+  float tileSize = 10;
+
+  /**
+   * TILED option: tile index.  getTiles builds it on saving, mapLoad reads it from the yaml header.  Temporary, cleared like vectorMapPoints.
+   */
+  vector<OsmapTile> tiles;
+
+  /**
+   * TILED option: mapLoad loads only tiles closer than loadRadius to loadSeed, a 3x1 position.  Every tile if loadRadius is negative.
+   * Set by the mapLoad overload with seed and radius.
+   */
+  Mat loadSeed;
+  float loadRadius = -1;
+
+  /**
+   * COVISIBILITY option: covisibility edges with less shared mappoints than this are not saved, except each keyframe's strongest one, saved on both keyframes.
+   * 0 saves the whole graph.  ORB-SLAM2 graph has no edges under 15, so lower values save it whole too.
+   */
+  int covisibilityThreshold = 0;
+
+  /**
+   * COVISIBILITY option: loaded graph of each keyframe, until rebuild links it.
+   */
+  unordered_map<KeyFrame*, OsmapConnections> keyFrameConnections;
+
+  /**
+   * NORMAL_AND_DEPTH option: loaded mappoints with normal and depth range restored, and their reference keyframe's id plus 1, until rebuild links it.
+   */
+  unordered_map<MapPoint*, unsigned int> mapPointRefKeyFrameIds;
+
+  /**
+   * BOW option: whether the loading map's bag of words were computed with the actual vocabulary, so they can be restored.
+   */
+  bool vocabularyMatches = false;
+
+  /**
+   * KEYFRAME_DATABASE option: whether the keyframe database was loaded, so rebuild doesn't add keyframes to it.
+   */
+  bool keyFrameDatabaseLoaded = false;
+
+  /**
+   * Keyframes already rebuilt while loading features, see featuresLoadAndRebuild.  rebuild skips their keyframe stages.
+   */
+  unordered_set<KeyFrame*> keyFramesRebuilt;
+
+  /**
+   * Time and counters of each phase of the last mapSave or mapLoad, reset at the beginning of each call.
+   * Phases are depuration, ordering vectors, each section's serialize, compress and write on saving,
+   * each section's decompress, parse and deserialize on loading, and each rebuild step.
+   */
+  OsmapStats stats;
+
+  /**
+   * Optional callback, called every time a phase ends with its statistics so far.  Phases timed apart in a thread, like the keyframes in featuresLoadAndRebuild, call it once per thread.
+   * It can be called from any thread saving or loading the map, one call at a time.  It must not call mapSave nor mapLoad.
+   */
+  function<void(const OsmapPhase&)> progress;
+
   /**
   Only constructor, the only way to set the orb-slam2 map.
   */
@@ -296,6 +644,19 @@ public:
   MapLoad doesn't use those vector.
 
   If features number exceed an arbitrary maximum, in order to avoid size related protocol buffer problems,  mapSave limit the size of protocol buffer's messages saving features file in delimited form, using Kendon Varda writeDelimitedTo function.
+
+  If threads property is not 1, mappoints, keyframes and features files are serialized and written concurrently.  The yaml header is completed after all of them.
+
+  With SINGLE_FILE option the map is saved to filename.osmap, a container with this layout, all numbers in little endian:
+  - fixed header: magic "OSMP", format version, number of sections and a reserved zero, 4 bytes each
+  - section table: one OsmapSection per section, 24 bytes each
+  - sections' payloads, one after another: mappoints, keyframes, features and the yaml header last
+  Sections are written sequentially, and the section table is written at the end.
+
+  Mappoints, keyframes and features are compressed with codec property, if it is not NO_CODEC.
+
+  With JOURNAL option, once a map is saved or loaded, following saves with the same name only append to basefilename.journal what changed since the previous save (see journalSave).
+  After journalCompaction such saves the whole map is saved again, and the journal is emptied.
   */
   void mapSave(string basefilename, bool pauseThreads = true);
 
@@ -314,9 +675,171 @@ public:
   - other files' names
 
   Before calling this method, threads must be paused.
+
+  If threads property is not 1, mappoints, keyframes and features files are parsed concurrently.  Then they are deserialized in that order, as each one depends on the previous ones.
+
+  A file with .osmap extension is loaded as a single file container (see mapSave).  It is memory mapped, and each section is parsed in place from its slice.
+
+  A map saved with JOURNAL option is loaded with its journal replayed on it, before rebuilding.
+
+  A map saved with TILED option is loaded only from the tiles selected in its index, see the mapLoad overload with seed and radius.
   */
   void mapLoad(string yamlFilename, bool noSetBad = false, bool pauseThreads = true);
 
+  /**
+  TILED option: loads only the part of the map within a radius of a position, from the tiles whose cell is closer than radius to seed.
+  Load time and memory depend on the loaded area, not on the whole map.
+
+  Observations crossing tiles are kept: each tile also has the mappoints its keyframes observe in other tiles, and mappoints in loaded tiles observed only from tiles not loaded are left out.
+  Loop edges to keyframes not loaded are dropped.  Ids are kept, and new ones continue after the whole map's.
+  Saving the part with the same name replaces the whole map.
+
+  A map saved without TILED option is loaded whole.
+
+  @param seed 3x1 float position in world coordinates, like a camera center.
+  @param radius in map units.
+  */
+  void mapLoad(string yamlFilename, const Mat &seed, float radius, bool noSetBad = false, bool pauseThreads = true);
+
+  /**
+   * JOURNAL option: appends to a journal file the mappoints, keyframes and features created, modified or erased since the last save.
+   * vectorMapPoints and vectorKeyFrames must be populated in ascending id order.
+   * @param filename journal file, usually journalFilename.
+   * @returns number of objects appended, -1 if error.
+   */
+  int journalSave(string filename);
+
+  /**
+   * JOURNAL option: replays a journal file on the just loaded vectorMapPoints and vectorKeyFrames, before rebuilding the map.
+   * @param filename journal file.
+   * @returns number of incremental saves replayed, 0 if there is no journal.
+   */
+  int journalLoad(string filename);
+
+  /**
+   * JOURNAL option: updates fingerprints and watermarks to the content of vectorMapPoints and vectorKeyFrames.
+   * @param entry changed and erased objects since the last fingerprints are added to this journal entry.  NULL to only set fingerprints, like after saving the whole map.
+   */
+  void journalFingerprints(SerializedJournalEntry *entry);
+
+  /**
+   * JOURNAL option: fingerprint of the fields a journal entry serializes that change after the object is created.
+   * Keypoints, descriptors, K and timestamps don't change, objects with new ids are told by the watermarks.
+   * Mappoint: position, visible and found counters, and descriptor.
+   */
+  size_t journalFingerprint(const OsmapMapPoint &mappoint);
+
+  /**
+   * JOURNAL option: keyframe fingerprint, on its pose and loop edges.  See journalFingerprint(const OsmapMapPoint&).
+   */
+  size_t journalFingerprint(const OsmapKeyFrame &keyframe);
+
+  /**
+   * JOURNAL option: keyframe's features fingerprint, on the mappoints they observe.  See journalFingerprint(const OsmapMapPoint&).
+   */
+  size_t journalFeaturesFingerprint(const OsmapKeyFrame &keyframe);
+
+  /**
+   * JOURNAL option: options used to serialize journal entries: ids, K and full precision in every object, features in row form.
+   */
+  bitset<32> getJournalOptions();
+
+  /**
+   * BOW option: fingerprint of the vocabulary keyframes use, a hash of its words and their weights.
+   * It takes some tens of milliseconds on a million words vocabulary, once per save or load.
+   * @returns 0 if there is no vocabulary.
+   */
+  uint64_t vocabularyFingerprint();
+
+  /**
+   * Feature pager: opens a page file for pageUpdate to page keyframes' features out, and in.  Any existing file is rewritten.
+   * @param filename page file, like "map.pages".
+   * @returns false if the file couldn't be created.
+   */
+  bool pageOpen(string filename);
+
+  /**
+   * Feature pager: pages features out and in, as the camera moves.  To be called from time to time while tracking, with the pager opened.
+   *
+   * Keyframes farther than pageOutDistance from the camera have their keypoints, descriptors, BoW feature vector and grid released,
+   * after saving keypoints and descriptors to the page file as a SerializedKeyframeFeatures message.
+   * mvpMapPoints stays in memory, because mappoints' observations index it and ORB-SLAM2 threads update it.
+   *
+   * ORB-SLAM2 reads features by observation index on keyframes reached through mappoints, so some keyframes are pinned in memory:
+   * those near the camera, and those two mappoint observations away from them, covering the local map and local bundle adjustment.
+   * Pinned keyframes are paged in right away, synchronously.
+   * Other paged out keyframes closer than pageOutDistance are read from the page file asynchronously, and their features restored in a later call.
+   *
+   * Local mapping, loop closing with its global bundle adjustment, and relocalization reach any keyframe,
+   * so features are paged out only in localization mode, with local mapping stopped, no global bundle adjustment running and tracking not lost.
+   * Otherwise every keyframe is paged in, even with an empty Tcw, so it must be called after every TrackMonocular while tracking is lost.
+   * Localization mode inserts no keyframes, so loop closing detects no loops while pages are out.
+   * Call pageInAll before leaving localization mode.
+   * Pages are kept by keyframe: close the pager before resetting the system.  mapLoad discards them.
+   *
+   * @param Tcw camera pose, usually the one returned by System::TrackMonocular.  Empty when tracking is lost.
+   * @returns number of keyframes paged out.
+   */
+  int pageUpdate(const Mat &Tcw);
+
+  /**
+   * Feature pager: pages in every paged out keyframe, synchronously.  mapSave calls it, to save every feature.
+   */
+  void pageInAll();
+
+  /**
+   * Feature pager: pages in every paged out keyframe, and closes and removes the page file.
+   */
+  void pageClose();
+
+  /**
+   * Feature pager: saves the keyframe's features to the page file if not already there, and releases them.
+   * @returns false if the record couldn't be written.  Features are kept.
+   */
+  bool pageOut(OsmapKeyFrame *pKF, OsmapPage &page);
+
+  /**
+   * Feature pager: restores keyframe's features from its page file record.
+   */
+  void pageIn(OsmapKeyFrame *pKF, OsmapPage &page, const string &record);
+
+  /**
+   * Feature pager: reads a record from the page file.  Thread safe.
+   */
+  string pageRead(const OsmapPage &page);
+
+  /**
+   * TILED option: partitions vectorKeyFrames and vectorMapPoints in tiles, by keyframes' camera centers and mappoints' positions.
+   * A tile also has the mappoints observed by its keyframes, wherever they are, so every tile's features find their mappoints.
+   * Tiles are ordered by cell.
+   */
+  void getTiles();
+
+  /**
+   * TILED option: saves a section tile by tile, each tile compressed on its own with codec, and sets tiles' lengths in that section.
+   * Features are saved delimited.
+   * @param file section output.
+   * @param type MAPPOINTS_SECTION, KEYFRAMES_SECTION or FEATURES_SECTION.
+   * @returns number of objects saved, -1 if error.
+   */
+  int tilesSave(ostream &file, SectionTypes type);
+
+  /**
+   * TILED option: the selected tiles' mappoints, parsed as a single message, are sorted by id and mappoints repeated in several tiles are removed.
+   */
+  void mergeTiles(SerializedMappointArray &serializedMappointArray);
+
+  /**
+   * TILED option: the selected tiles' keyframes, parsed as a single message, are sorted by id and their loop edges to keyframes not loaded removed.
+   */
+  void mergeTiles(SerializedKeyframeArray &serializedKeyframeArray);
+
+  /**
+   * TILED option: deletes mappoints in vectorMapPoints not observed by any keyframe in vectorKeyFrames, after loading part of a map.
+   * @returns number of mappoints deleted.
+   */
+  int eraseUnobservedMapPoints();
+
   /**
    * Save the content of vectorMapPoints to file like "map.mappoints".
    * @param filename full name of the file to be created and saved.
@@ -327,12 +850,25 @@ public:
    */
   int MapPointsSave(string filename);
 
+  /**
+   * Save the content of vectorMapPoints to an already open stream, like a single file container.
+   * @param file binary output stream, where the mappoints section is written from the current position.
+   * @returns number of mappoints serialized.  -1 if error.
+   */
+  int MapPointsSave(ostream &file);
+
   /**
    * Load the content of a "map.mappoints" file to vectorMapPoints.
    * @param filename full name of the file to open.
    */
   int MapPointsLoad(string filename);
 
+  /**
+   * Deserialize an already parsed mappoints file to vectorMapPoints, and index them.
+   * @param serializedMappointArray parsed content of a "map.mappoints" file.
+   */
+  int MapPointsLoad(const SerializedMappointArray &serializedMappointArray);
+
   /**
    * Save the content of vectorKeyFrames to file like "map.keyframes".
    * Need
@@ -343,24 +879,202 @@ public:
    */
   int KeyFramesSave(string filename);
 
+  /**
+   * Save the content of vectorKeyFrames to an already open stream, like a single file container.
+   * @param file binary output stream, where the keyframes section is written from the current position.
+   * @returns number of keyframes serialized.  -1 if error.
+   */
+  int KeyFramesSave(ostream &file);
+
   /**
    * Load the content of a "map.keyframes" file to vectorKeyFrames.
    * @param filename full name of the file to open.
    */
   int KeyFramesLoad(string filename);
 
+  /**
+   * Deserialize an already parsed keyframes file to vectorKeyFrames.
+   * @param serializedKeyFrameArray parsed content of a "map.keyframes" file.
+   */
+  int KeyFramesLoad(const SerializedKeyframeArray &serializedKeyFrameArray);
+
   /**
    * Save KeyFrane's features of vectorKeyFrames to file, usually "map.features".
    * @param filename full name of the file to be created and saved.
+   *
+   * In delimited form, if threads property is not 1, blocks are serialized concurrently by worker threads, and written in order by the calling thread.
    */
   int featuresSave(string filename);
 
+  /**
+   * Save KeyFrane's features of vectorKeyFrames to an already open stream, like a single file container.
+   * @param file binary output stream, where the features section is written from the current position.
+   * @returns number of features serialized.  -1 if error.
+   */
+  int featuresSave(ostream &file);
+
+  /**
+   * KEYFRAME_DATABASE option: save the keyframe database's inverted index to an already open stream, like a single file container.
+   * Only keyframes in vectorKeyFrames are saved.
+   * @param file binary output stream, where the database section is written from the current position.
+   * @returns number of words serialized.  -1 if error.
+   */
+  int keyFrameDatabaseSave(ostream &file);
+
+  /**
+   * Sets FEATURES_FILE_DELIMITED or FEATURES_FILE_NOT_DELIMITED option, the form featuresSave will use, unless one of them is already set.
+   * Delimited form is chosen if features exceed FEATURES_MESSAGE_LIMIT.
+   * mapSave invokes it before saving sections concurrently, so options are not modified while being read.
+   */
+  void chooseFeaturesFileForm();
+
   /**
    * Load the content of a "map.features" file and applies it to vectorKeyFrames.
    * @param filename full name of the file to open.
    */
   int featuresLoad(string filename);
 
+  /**
+   * Load a features section from memory and applies it to vectorKeyFrames.
+   * In delimited form each message is deserialized right after being parsed.
+   * @param data first byte of the section, usually in a memory mapped file.
+   * @param size size in bytes of the section.
+   */
+  int featuresLoad(const char *data, size_t size);
+
+  /**
+   * Deserialize an already parsed features file and applies it to vectorKeyFrames.
+   * @param serializedFeatures parsed content of a "map.features" file, one element per delimited message.
+   */
+  int featuresLoad(const vector<SerializedKeyframeFeaturesArray> &serializedFeatures);
+
+  /**
+   * Load a delimited features section from memory, rebuilding each keyframe as soon as its features are deserialized.
+   * A pipeline of three overlapping stages: a reader thread parses blocks, worker threads deserialize features and run rebuildKeyFrame,
+   * and the calling thread runs linkKeyFrame in file order.  Keyframes and mappoints must be loaded, and the features file in ascending keyframe id order.
+   * Keyframes without features in the file are rebuilt and linked by the calling thread too, between the streamed ones, so every keyframe is linked in mnId order.
+   * The reader holds at most two parsed blocks, so memory doesn't grow with the features file.  Rebuilt keyframes are added to keyFramesRebuilt.
+   * @param data first byte of the section, usually in a memory mapped file.
+   * @param size size in bytes of the section.
+   * @returns number of features loaded.
+   */
+  int featuresLoadAndRebuild(const char *data, size_t size);
+
+  /**
+   * Parse a whole features file, in delimited form or not according to options.
+   * Unlike featuresLoad, which deserializes each delimited message right after reading it, this keeps all the messages in memory.
+   * @param filename full name of the file to open.
+   * @param serializedFeatures output, one element per delimited message, or only one element if the file is not delimited.
+   * @returns true if ok, false if error.
+   */
+  bool featuresParse(string filename, vector<SerializedKeyframeFeaturesArray> &serializedFeatures);
+
+  /**
+   * Parse a whole features section from memory, like featuresParse(string, vector<SerializedKeyframeFeaturesArray>&) does with a file.
+   * @param data first byte of the section, usually in a memory mapped file.
+   * @param size size in bytes of the section.
+   * @param serializedFeatures output, one element per delimited message, or only one element if the section is not delimited.
+   * @returns true if ok, false if error.
+   */
+  bool featuresParse(const char *data, size_t size, vector<SerializedKeyframeFeaturesArray> &serializedFeatures);
+
+  /**
+   * Parse a file consisting on a single protocol buffers message, like mappoints and keyframes files.
+   * The file is memory mapped and parsed in place.
+   * @param filename full name of the file to open.
+   * @param message output message.
+   * @returns true if ok, false if error.
+   */
+  bool parseFile(string filename, google::protobuf::MessageLite &message);
+
+  /**
+   * Parse a single protocol buffers message from memory, usually a memory mapped file.
+   * Size is not limited by protocol buffers default total bytes limit.
+   * @param data first byte of the serialized message.
+   * @param size size in bytes of the serialized message.
+   * @param message output message.
+   * @returns true if ok, false if error.
+   */
+  bool parse(const char *data, size_t size, google::protobuf::MessageLite &message);
+
+  /**
+   * Parse the next message of a delimited sequence in memory, as written by writeDelimitedTo.
+   * Unlike readDelimitedFrom, the total size of the sequence is not limited.
+   * @param data start of the delimited sequence, usually a memory mapped file.
+   * @param size size in bytes of the delimited sequence.
+   * @param offset position in data of the next message's size prefix.  It is advanced past the parsed message, and left unchanged if error.
+   * @param message output message.  It is cleared before parsing.
+   * @returns true if ok, false at the end of the sequence or if error.  Offset is less than size only if error.
+   */
+  bool parseDelimited(const char *data, size_t size, size_t &offset, google::protobuf::MessageLite &message);
+
+  /**
+   * Write the fixed header and the section table of a single file container, at the current position of the stream.
+   * mapSave writes them twice: first as a placeholder at the beginning of the container, and again at the end, when sections' offsets and lengths are known.
+   * @param file binary output stream.
+   * @param sectionTable one entry per section.
+   */
+  void writeContainerHeader(ostream &file, const vector<OsmapSection> &sectionTable);
+
+  /**
+   * Read and validate the fixed header and the section table of a single file container.
+   * @param data first byte of the container, usually a memory mapped file.
+   * @param size size in bytes of the container.
+   * @param sectionTable output, one entry per section.
+   * @returns true if ok, false if it is not a valid container, or if any section exceeds the container.
+   */
+  bool readContainerHeader(const char *data, size_t size, vector<OsmapSection> &sectionTable);
+
+  /**
+   * Compress a serialized section with codec property, and write it in chunks.
+   * Chunks are compressed concurrently if threads property is not 1, and written in order.
+   * @param raw serialized section.
+   * @param file binary output stream.
+   * @returns true if ok, false if error.
+   */
+  bool compress(const string &raw, ostream &file);
+
+  /**
+   * Decompress a section written by compress.  Chunks are decompressed concurrently if threads property is not 1.
+   * @param data first byte of the compressed section, usually in a memory mapped file.
+   * @param size size in bytes of the compressed section.
+   * @param sectionCodec codec the section was compressed with.
+   * @param raw output, the serialized section.
+   * @returns true if ok, false if error or if the codec is not available.
+   */
+  bool decompress(const char *data, size_t size, Codecs sectionCodec, string &raw);
+
+  /**
+   * Whether a codec was compiled in.
+   */
+  static bool codecAvailable(Codecs codec);
+
+  /**
+   * Sets boundingBox from the positions of map's mappoints.
+   */
+  void getBoundingBox();
+
+  /**
+   * Maximum errors QUANTIZED option introduces in vectorMapPoints and vectorKeyFrames, i.e. differences between the map in memory and the same map saved and loaded.
+   * boundingBox must be set.  mapSave reports them on console and in the yaml header.
+   */
+  OsmapQuantizationError quantizationError();
+
+  /**
+   * Quantization used by QUANTIZED option.  Each quantize function has its dequantize inverse.
+   * - positions: 21 bits fixed point per axis relative to boundingBox, packed in a uint64
+   * - poses: rotation elements or quaternion components in 2^-19 units, translation elements in units of the positions' resolution
+   * - keypoints: coordinates in 1/16 pixel, angle in 1/256 turn
+   */
+  uint64_t quantizePosition(const Mat &position);
+  void dequantizePosition(uint64_t quantized, Mat &position);
+  int32_t quantizePoseElement(float element, bool translation);
+  float dequantizePoseElement(int32_t quantized, bool translation);
+  static int32_t quantizeKeypointCoordinate(float coordinate);
+  static float dequantizeKeypointCoordinate(int32_t quantized);
+  static uint32_t quantizeAngle(float angle);
+  static float dequantizeAngle(uint32_t quantized);
+
   /**
    * Populate vectorMapPoints with MapPoints from Map.mspMapPoints.
    * This is done as the first step to save mappoints.
@@ -421,27 +1135,55 @@ public:
    *
    * How rebuild works:
    *
-   *  - Loops on every keyframe:
+   *  - Keyframe-local stages on every keyframe, distributed over threads (see rebuildKeyFrame):
    * 		- ComputeBOW, building BOW vectors from descriptors
    * 		- Builds many pose matrices from pose
    * 		- Builds the grid
-   * 		- Adds to KeyFrameDatabase
+   *  - Loops on every keyframe in mnId order:
+   * 		- Adds to KeyFrameDatabase, unless it was loaded with KEYFRAME_DATABASE option
    * 		- Builds its mappoints observations
-   * 		- UpdateConnections, building the spaning tree and the covisibility graph
+   * 		- UpdateConnections, building the spaning tree and the covisibility graph, or linkConnections if they were saved with COVISIBILITY option
    *  - Sets KeyFrame::nNextId
    *  - Retries UpdateConnections on isolated keyframes.
    *  - Sets bad keyframes remaining isolated (avoided with noSetBad argument true)
    *  - Sets map.mvpKeyFrameOrigins
-   *  - Travels keyframes looking for orphans, trying to assign a parent, thus including them in the spanning tree.
+   *  - Traverses the covisibility graph from the root once, assigning a parent to every keyframe it reaches out of the spanning tree, orphans and keyframes hanging from parent cycles, thus including them in the tree.  Reports components unreachable from the root.
    *  - Loops on every mappoint:
    * 		- Sets bad mappoints without observations (avoided with noSetBad argument true)
-   * 		- Sets mpRefKF
-   * 		- UpdateNormalAndDepth, setting mNormalVector, mfMinDistance, mfMaxDistance
+   * 		- Sets mpRefKF, the saved one with NORMAL_AND_DEPTH option
+   *  - UpdateNormalAndDepth on every mappoint, distributed over threads, setting mNormalVector, mfMinDistance, mfMaxDistance.  Skipped on mappoints restored with NORMAL_AND_DEPTH option.
    *  - Sets MapPoint::nNextId
    *
+   * Only order dependent steps (observations, UpdateConnections and spanning tree) run serially.
+   * Keyframes in keyFramesRebuilt, already rebuilt by featuresLoadAndRebuild, skip the keyframe stages and the mnId order loop.
    */
   void rebuild(bool noSetBad = false);
 
+  /**
+   * Keyframe-local rebuild stages: BoW vectors, pose matrices and features grid.
+   * It only writes on the given keyframe, so rebuild runs it concurrently on different keyframes.
+   * @param pKF KeyFrame to rebuild, with its features already deserialized.
+   */
+  void rebuildKeyFrame(OsmapKeyFrame *pKF);
+
+  /**
+   * Keyframe stages that depend on the keyframes before it: adds it to the keyframe database, its observations to its mappoints,
+   * and builds its covisibility graph and parent with UpdateConnections or linkConnections.  Keyframes must be linked in mnId order.
+   */
+  void linkKeyFrame(OsmapKeyFrame *pKF);
+
+  /**
+   * Rebuilds the keyframe grid, mGrid, which indexes keypoints by their position.  Part of rebuildKeyFrame, also used paging features in.
+   */
+  void rebuildGrid(OsmapKeyFrame *pKF);
+
+  /**
+   * COVISIBILITY option: restores keyframe's covisibility graph and parent from keyFrameConnections, instead of UpdateConnections.
+   * Edges to keyframes not loaded are skipped.  Part of rebuild, keyframes must be loaded.
+   * @returns false if the keyframe has no saved graph.
+   */
+  bool linkConnections(OsmapKeyFrame *pKF);
+
 
 
   /**
@@ -466,19 +1208,56 @@ public:
   void getVectorKFromKeyframes();
 
   /**
-  Looks for a mappoint by its id in the map.
+  Builds the mappoint id index from vectorMapPoints, so getMapPoint resolves ids in constant time.
+  A dense table is used if the greatest id is no more than 4 times the number of mappoints, a hash map otherwise.
+  Invoked by MapPointsLoad.  It must be invoked again if vectorMapPoints is modified by other means.
+  */
+  void indexMapPoints();
+
+  /**
+  Looks for a mappoint by its id in vectorMapPoints.
+  It uses the index built by indexMapPoints, or a linear search if there is no index.
   @param id Id of the MapPoint to look for.
   @returns a pointer to the MapPoint with the given id, or NULL if not found.
   */
   MapPoint *getMapPoint(unsigned int id);
 
+  /**
+   * Mappoint a loaded feature refers to, as saved in SerializedFeature::mappoint_id.
+   * With DENSE_IDS option it is the position in vectorMapPoints plus one, taken directly.  Otherwise it is the id, looked up with getMapPoint.
+   * @returns a pointer to the MapPoint, or NULL if 0 or not found.
+   */
+  MapPoint *getFeatureMapPoint(unsigned int mappointId);
+
+  /**
+   * DENSE_IDS option: position plus one of a mappoint in vectorMapPoints, as saved features refer to it.
+   * vectorMapPoints must be in ascending id order, as mapSave leaves it.
+   * @returns position plus one, or 0 if the mappoint is not in vectorMapPoints.
+   */
+  unsigned int getMapPointDenseId(const MapPoint *pMP);
+
+  /**
+   * DENSE_IDS option: position of a keyframe in vectorKeyFrames, which is its saved id.
+   * vectorKeyFrames must be in ascending id order, as mapSave leaves it.
+   * @returns position, or -1 if the keyframe is not in vectorKeyFrames.
+   */
+  int getKeyFrameDenseId(const KeyFrame *pKF);
+
+  /**
+   * DESCRIPTOR_RESIDUALS option, on save: descriptor a feature's descriptor is coded against, the one of its mappoint if it is saved too.
+   * vectorMapPoints must be in ascending id order, as mapSave leaves it.
+   * @returns the mappoint descriptor, 32 bytes, or NULL if the feature descriptor must be saved whole.
+   */
+  const uchar *getDescriptorReference(const MapPoint *pMP);
+
 
   /**
-  Looks for a KeyFrame id in the map.
-  Keyframes are usually stored in ascending id order.  This function will be more probably called in the same way, so it is optimized for this expected behaviour.  It uses itLastKF.
+  Looks for a KeyFrame id in vectorKeyFrames.
+  Keyframes are stored in ascending id order.  This function will be more probably called in the same way, so it is optimized for this expected behaviour:
+  it first tests the keyframe found in the last call and the next one (lastKeyFrameIdx), and falls back to a binary search.
   @param id Id of the KeyFrame to look for.
   @returns a pointer to the KeyFrame with the given id, or NULL if not found.
-  Used only in Osmap::deserialize(const SerializedKeyframeFeatures&).
+  Used in every deserialization path: loop edges in Osmap::deserialize(const SerializedKeyframe&), and Osmap::deserialize(const SerializedKeyframeFeatures&).
   */
   OsmapKeyFrame *getKeyFrame(unsigned int id);
 
@@ -489,6 +1268,38 @@ public:
    */
   int countFeatures();
 
+  /**
+   * Number of threads to use, according to threads property.
+   */
+  unsigned int getThreads();
+
+  /**
+   * Runs task(i) for every i in [0, n), distributed over getThreads() threads, the calling one included.
+   * Each i is run exactly once, in no particular order.  It returns after every task finished.
+   */
+  void parallelFor(size_t n, const function<void(size_t)> &task);
+
+  /**
+   * Adds the time since start and the counters to the phase with the given name in stats, creating it if it's new, and calls progress.
+   * Thread safe.
+   * @param name phase name.
+   * @param start clocks read when the phase started.
+   * @param objects objects processed in this run.
+   * @param bytes bytes processed in this run.
+   */
+  void phaseEnd(const string &name, const OsmapClock &start, uint64_t objects = 0, uint64_t bytes = 0);
+
+  /**
+   * Adds a phase run by other means, like many short runs accumulated in a thread, to the phase with its name in stats.  Thread safe.
+   */
+  void phaseAdd(const OsmapPhase &phase);
+
+  /**
+   * Sets stats whole call times, at the end of mapSave and mapLoad.
+   * @param start clocks read when the call started.
+   */
+  void statsEnd(const OsmapClock &start);
+
 
 
   // Protocol buffer messages serialization for orb-slam2 objects
@@ -557,17 +1368,32 @@ public:
 
   /**
   Serialize a 4x4 float Mat representing a pose in homogeneous coordinates.
-  Exactly 12 float required.
+  Exactly 12 float required, or 7 (quaternion and translation) with QUATERNION_POSES option.
   */
   void serialize(const Mat&, SerializedPose*);
 
 
   /**
   Reconstruct a 4x4 float Mat representing a pose in homogeneous coordinates.
-  Exactly 12 float required.
+  Exactly 12 float required, or 7 (quaternion and translation) with QUATERNION_POSES option, whose rotation is rebuilt orthonormal.
   */
   void deserialize(const SerializedPose&, Mat&);
 
+  /**
+  POSE_DELTAS option: replaces an already serialized pose by the differences of its values with the previous keyframe's ones.
+  @param serializedPose pose serialized by serialize(const Mat&, SerializedPose*), replaced by its deltas.
+  @param previous values of the previous pose, updated to these ones.  Empty for the first keyframe.
+  */
+  void serializePoseDelta(SerializedPose &serializedPose, vector<int32_t> &previous);
+
+  /**
+  POSE_DELTAS option: reconstruct a pose from its differences with the previous keyframe's one.
+  @param serializedPose differences, as serialized by serializePoseDelta.
+  @param previous values of the previous pose, updated to these ones.  Empty for the first keyframe.
+  @param m output pose.
+  */
+  void deserializePoseDelta(const SerializedPose &serializedPose, vector<int32_t> &previous, Mat &m);
+
 
   // Position vector ====================================================================================================
 
@@ -618,6 +1444,11 @@ public:
   */
   OsmapMapPoint *deserialize(const SerializedMappoint& serializedMappoint);
 
+  /**
+  Fills an existing MapPoint from optional message fields.  Used to update mappoints replaying a journal.
+  */
+  void deserialize(const SerializedMappoint& serializedMappoint, OsmapMapPoint *pMappoint);
+
   /**
   Serialized array of MapPoints.
   The serialized message can be saved to an exclusive file, or be appended to a multiobject file.
@@ -654,6 +1485,11 @@ public:
   */
   OsmapKeyFrame *deserialize(const SerializedKeyframe&);
 
+  /**
+  Fills an existing KeyFrame from optional fields.  Used to update keyframes replaying a journal.  Loop edges are added to the existing ones.
+  */
+  void deserialize(const SerializedKeyframe&, OsmapKeyFrame *pKeyframe);
+
   /**
   Serialized array of KeyFrames.  This can make a file, or be appended to a multiobject file.
   KeyFrames will be serialized in ascending id order.
@@ -692,8 +1528,58 @@ public:
   */
   OsmapKeyFrame *deserialize(const SerializedKeyframeFeatures&);
 
+  /**
+  Puts all KeyPoints, MapPoints* and descriptors in their respective containters of the provided KeyFrame.
+  It only writes on that keyframe, so it can be run concurrently on different keyframes.
+  @param SerializedKeyframeFeatures Object to be deserialized.
+  @param pKF KeyFrame whose id is keyframe_id.
+  */
+  void deserialize(const SerializedKeyframeFeatures&, OsmapKeyFrame *pKF);
+
+  /**
+  Serialize all features observed by a KeyFrame in columnar form, used with COLUMNAR_FEATURES option.
+  Keypoints properties go to packed arrays, and descriptors to a single blob.
+  @param keyframe KeyFrame owner of the features.
+  @param serializedKeyframeColumnarFeatures Message destination of serialization.
+  */
+  void serialize(const OsmapKeyFrame &keyframe, SerializedKeyframeColumnarFeatures *serializedKeyframeColumnarFeatures);
+
+  /**
+  Retrieves all features belonging to one keyframe from columnar form.
+  Descriptors are copied in bulk to mDescriptors.
+  It only writes on that keyframe, so it can be run concurrently on different keyframes.
+  @param serializedKeyframeColumnarFeatures Object to be deserialized.
+  @param pKF KeyFrame whose id is keyframe_id.
+  */
+  void deserialize(const SerializedKeyframeColumnarFeatures &serializedKeyframeColumnarFeatures, OsmapKeyFrame *pKF);
+
+  /**
+   * BOW option: serializes keyframe's mBowVec and mFeatVec, ids delta coded.
+   */
+  void serialize(const OsmapKeyFrame &keyframe, SerializedBow *serializedBow);
+
+  /**
+   * BOW option: restores keyframe's mBowVec and mFeatVec.
+   * Features must be deserialized first, node features out of range leave both vectors empty for rebuild to compute them.
+   */
+  void deserialize(const SerializedBow &serializedBow, OsmapKeyFrame *pKF);
+
+  /**
+   * KEYFRAME_DATABASE option: serializes the keyframe database's inverted index, words and keyframes ids delta coded.
+   * @returns number of words serialized.
+   */
+  int serialize(SerializedKeyframeDatabase *serializedDatabase);
+
+  /**
+   * KEYFRAME_DATABASE option: replaces the keyframe database's inverted index with the loaded one, word lists built concurrently.
+   * Keyframes must be loaded, ids of keyframes not loaded are skipped.
+   * @returns number of words loaded, -1 if the serialized index is inconsistent, or has words out of the vocabulary, and the database was left untouched.
+   */
+  int deserialize(const SerializedKeyframeDatabase &serializedDatabase);
+
   /**
    * Serialize all keyframe's features from provided keyframes container, to the specified serialization object.
+   * Per feature form is used, or columnar form with COLUMNAR_FEATURES option.
    * @param vKF vector of KeyFrames to save, usually vectorKeyFrames member order by mnId.
    * @param serializedKeyframeFeaturesArray output serialization object.
    */
@@ -701,6 +1587,8 @@ public:
 
   /**
    * Retrieves all keyframe's features from the specified serialization object to vectorKeyframe.
+   * Both per feature and columnar forms are retrieved.
+   * Keyframes are distributed over threads if threads property is not 1.
    */
   int deserialize(const SerializedKeyframeFeaturesArray&);
 
@@ -1,97 +1,111 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: osmap.proto
 
-#ifndef PROTOBUF_INCLUDED_osmap_2eproto
-#define PROTOBUF_INCLUDED_osmap_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_osmap_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_osmap_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_osmap_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_osmap_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_osmap_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_osmap_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_osmap_2eproto;
+class SerializedBow;
+struct SerializedBowDefaultTypeInternal;
+extern SerializedBowDefaultTypeInternal _SerializedBow_default_instance_;
 class SerializedDescriptor;
-class SerializedDescriptorDefaultTypeInternal;
+struct SerializedDescriptorDefaultTypeInternal;
 extern SerializedDescriptorDefaultTypeInternal _SerializedDescriptor_default_instance_;
 class SerializedFeature;
-class SerializedFeatureDefaultTypeInternal;
+struct SerializedFeatureDefaultTypeInternal;
 extern SerializedFeatureDefaultTypeInternal _SerializedFeature_default_instance_;
+class SerializedJournalEntry;
+struct SerializedJournalEntryDefaultTypeInternal;
+extern SerializedJournalEntryDefaultTypeInternal _SerializedJournalEntry_default_instance_;
 class SerializedK;
-class SerializedKDefaultTypeInternal;
+struct SerializedKDefaultTypeInternal;
 extern SerializedKDefaultTypeInternal _SerializedK_default_instance_;
 class SerializedKArray;
-class SerializedKArrayDefaultTypeInternal;
+struct SerializedKArrayDefaultTypeInternal;
 extern SerializedKArrayDefaultTypeInternal _SerializedKArray_default_instance_;
 class SerializedKeyframe;
-class SerializedKeyframeDefaultTypeInternal;
+struct SerializedKeyframeDefaultTypeInternal;
 extern SerializedKeyframeDefaultTypeInternal _SerializedKeyframe_default_instance_;
 class SerializedKeyframeArray;
-class SerializedKeyframeArrayDefaultTypeInternal;
+struct SerializedKeyframeArrayDefaultTypeInternal;
 extern SerializedKeyframeArrayDefaultTypeInternal _SerializedKeyframeArray_default_instance_;
+class SerializedKeyframeColumnarFeatures;
+struct SerializedKeyframeColumnarFeaturesDefaultTypeInternal;
+extern SerializedKeyframeColumnarFeaturesDefaultTypeInternal _SerializedKeyframeColumnarFeatures_default_instance_;
+class SerializedKeyframeDatabase;
+struct SerializedKeyframeDatabaseDefaultTypeInternal;
+extern SerializedKeyframeDatabaseDefaultTypeInternal _SerializedKeyframeDatabase_default_instance_;
 class SerializedKeyframeFeatures;
-class SerializedKeyframeFeaturesDefaultTypeInternal;
+struct SerializedKeyframeFeaturesDefaultTypeInternal;
 extern SerializedKeyframeFeaturesDefaultTypeInternal _SerializedKeyframeFeatures_default_instance_;
 class SerializedKeyframeFeaturesArray;
-class SerializedKeyframeFeaturesArrayDefaultTypeInternal;
+struct SerializedKeyframeFeaturesArrayDefaultTypeInternal;
 extern SerializedKeyframeFeaturesArrayDefaultTypeInternal _SerializedKeyframeFeaturesArray_default_instance_;
 class SerializedKeypoint;
-class SerializedKeypointDefaultTypeInternal;
+struct SerializedKeypointDefaultTypeInternal;
 extern SerializedKeypointDefaultTypeInternal _SerializedKeypoint_default_instance_;
 class SerializedMappoint;
-class SerializedMappointDefaultTypeInternal;
+struct SerializedMappointDefaultTypeInternal;
 extern SerializedMappointDefaultTypeInternal _SerializedMappoint_default_instance_;
 class SerializedMappointArray;
-class SerializedMappointArrayDefaultTypeInternal;
+struct SerializedMappointArrayDefaultTypeInternal;
 extern SerializedMappointArrayDefaultTypeInternal _SerializedMappointArray_default_instance_;
 class SerializedPose;
-class SerializedPoseDefaultTypeInternal;
+struct SerializedPoseDefaultTypeInternal;
 extern SerializedPoseDefaultTypeInternal _SerializedPose_default_instance_;
 class SerializedPosition;
-class SerializedPositionDefaultTypeInternal;
+struct SerializedPositionDefaultTypeInternal;
 extern SerializedPositionDefaultTypeInternal _SerializedPosition_default_instance_;
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::SerializedBow* Arena::CreateMaybeMessage<::SerializedBow>(Arena*);
 template<> ::SerializedDescriptor* Arena::CreateMaybeMessage<::SerializedDescriptor>(Arena*);
 template<> ::SerializedFeature* Arena::CreateMaybeMessage<::SerializedFeature>(Arena*);
+template<> ::SerializedJournalEntry* Arena::CreateMaybeMessage<::SerializedJournalEntry>(Arena*);
 template<> ::SerializedK* Arena::CreateMaybeMessage<::SerializedK>(Arena*);
 template<> ::SerializedKArray* Arena::CreateMaybeMessage<::SerializedKArray>(Arena*);
 template<> ::SerializedKeyframe* Arena::CreateMaybeMessage<::SerializedKeyframe>(Arena*);
 template<> ::SerializedKeyframeArray* Arena::CreateMaybeMessage<::SerializedKeyframeArray>(Arena*);
+template<> ::SerializedKeyframeColumnarFeatures* Arena::CreateMaybeMessage<::SerializedKeyframeColumnarFeatures>(Arena*);
+template<> ::SerializedKeyframeDatabase* Arena::CreateMaybeMessage<::SerializedKeyframeDatabase>(Arena*);
 template<> ::SerializedKeyframeFeatures* Arena::CreateMaybeMessage<::SerializedKeyframeFeatures>(Arena*);
 template<> ::SerializedKeyframeFeaturesArray* Arena::CreateMaybeMessage<::SerializedKeyframeFeaturesArray>(Arena*);
 template<> ::SerializedKeypoint* Arena::CreateMaybeMessage<::SerializedKeypoint>(Arena*);
@@ -99,41 +113,53 @@ template<> ::SerializedMappoint* Arena::CreateMaybeMessage<::SerializedMappoint>
 template<> ::SerializedMappointArray* Arena::CreateMaybeMessage<::SerializedMappointArray>(Arena*);
 template<> ::SerializedPose* Arena::CreateMaybeMessage<::SerializedPose>(Arena*);
 template<> ::SerializedPosition* Arena::CreateMaybeMessage<::SerializedPosition>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // ===================================================================
 
-class SerializedDescriptor : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedDescriptor) */ {
+class SerializedDescriptor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedDescriptor) */ {
  public:
-  SerializedDescriptor();
-  virtual ~SerializedDescriptor();
+  inline SerializedDescriptor() : SerializedDescriptor(nullptr) {}
+  ~SerializedDescriptor() override;
+  explicit PROTOBUF_CONSTEXPR SerializedDescriptor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedDescriptor(const SerializedDescriptor& from);
-
-  inline SerializedDescriptor& operator=(const SerializedDescriptor& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedDescriptor(SerializedDescriptor&& from) noexcept
     : SerializedDescriptor() {
     *this = ::std::move(from);
   }
 
+  inline SerializedDescriptor& operator=(const SerializedDescriptor& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedDescriptor& operator=(SerializedDescriptor&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedDescriptor& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedDescriptor& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedDescriptor* internal_default_instance() {
     return reinterpret_cast<const SerializedDescriptor*>(
                &_SerializedDescriptor_default_instance_);
@@ -141,109 +167,160 @@ class SerializedDescriptor : public ::google::protobuf::Message /* @@protoc_inse
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(SerializedDescriptor* other);
   friend void swap(SerializedDescriptor& a, SerializedDescriptor& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedDescriptor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedDescriptor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedDescriptor* New() const final {
-    return CreateMaybeMessage<SerializedDescriptor>(NULL);
-  }
-
-  SerializedDescriptor* New(::google::protobuf::Arena* arena) const final {
+  SerializedDescriptor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedDescriptor>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedDescriptor& from);
-  void MergeFrom(const SerializedDescriptor& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedDescriptor& from) {
+    SerializedDescriptor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedDescriptor* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedDescriptor";
   }
+  protected:
+  explicit SerializedDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kBlockFieldNumber = 1,
+  };
   // repeated fixed32 block = 1;
   int block_size() const;
+  private:
+  int _internal_block_size() const;
+  public:
   void clear_block();
-  static const int kBlockFieldNumber = 1;
-  ::google::protobuf::uint32 block(int index) const;
-  void set_block(int index, ::google::protobuf::uint32 value);
-  void add_block(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_block(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_block() const;
+  void _internal_add_block(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_block();
+  public:
+  uint32_t block(int index) const;
+  void set_block(int index, uint32_t value);
+  void add_block(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       block() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_block();
 
   // @@protoc_insertion_point(class_scope:SerializedDescriptor)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > block_;
-  mutable int _block_cached_byte_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > block_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedPose : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedPose) */ {
+class SerializedPose final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedPose) */ {
  public:
-  SerializedPose();
-  virtual ~SerializedPose();
+  inline SerializedPose() : SerializedPose(nullptr) {}
+  ~SerializedPose() override;
+  explicit PROTOBUF_CONSTEXPR SerializedPose(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedPose(const SerializedPose& from);
-
-  inline SerializedPose& operator=(const SerializedPose& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedPose(SerializedPose&& from) noexcept
     : SerializedPose() {
     *this = ::std::move(from);
   }
 
+  inline SerializedPose& operator=(const SerializedPose& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedPose& operator=(SerializedPose&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedPose& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedPose& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedPose* internal_default_instance() {
     return reinterpret_cast<const SerializedPose*>(
                &_SerializedPose_default_instance_);
@@ -251,109 +328,234 @@ class SerializedPose : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(SerializedPose* other);
   friend void swap(SerializedPose& a, SerializedPose& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedPose* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedPose* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedPose* New() const final {
-    return CreateMaybeMessage<SerializedPose>(NULL);
-  }
-
-  SerializedPose* New(::google::protobuf::Arena* arena) const final {
+  SerializedPose* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedPose>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedPose& from);
-  void MergeFrom(const SerializedPose& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedPose& from) {
+    SerializedPose::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedPose* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedPose";
   }
+  protected:
+  explicit SerializedPose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kElementFieldNumber = 1,
+    kQuantizedFieldNumber = 2,
+    kQuaternionFieldNumber = 3,
+    kDeltaFieldNumber = 4,
+  };
   // repeated float element = 1;
   int element_size() const;
+  private:
+  int _internal_element_size() const;
+  public:
   void clear_element();
-  static const int kElementFieldNumber = 1;
+  private:
+  float _internal_element(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_element() const;
+  void _internal_add_element(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_element();
+  public:
   float element(int index) const;
   void set_element(int index, float value);
   void add_element(float value);
-  const ::google::protobuf::RepeatedField< float >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
       element() const;
-  ::google::protobuf::RepeatedField< float >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_element();
 
+  // repeated sint32 quantized = 2;
+  int quantized_size() const;
+  private:
+  int _internal_quantized_size() const;
+  public:
+  void clear_quantized();
+  private:
+  int32_t _internal_quantized(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_quantized() const;
+  void _internal_add_quantized(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_quantized();
+  public:
+  int32_t quantized(int index) const;
+  void set_quantized(int index, int32_t value);
+  void add_quantized(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      quantized() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_quantized();
+
+  // repeated float quaternion = 3;
+  int quaternion_size() const;
+  private:
+  int _internal_quaternion_size() const;
+  public:
+  void clear_quaternion();
+  private:
+  float _internal_quaternion(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_quaternion() const;
+  void _internal_add_quaternion(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_quaternion();
+  public:
+  float quaternion(int index) const;
+  void set_quaternion(int index, float value);
+  void add_quaternion(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      quaternion() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_quaternion();
+
+  // repeated sint32 delta = 4;
+  int delta_size() const;
+  private:
+  int _internal_delta_size() const;
+  public:
+  void clear_delta();
+  private:
+  int32_t _internal_delta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_delta() const;
+  void _internal_add_delta(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_delta();
+  public:
+  int32_t delta(int index) const;
+  void set_delta(int index, int32_t value);
+  void add_delta(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_delta();
+
   // @@protoc_insertion_point(class_scope:SerializedPose)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< float > element_;
-  mutable int _element_cached_byte_size_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > element_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > quantized_;
+    mutable std::atomic<int> _quantized_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > quaternion_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > delta_;
+    mutable std::atomic<int> _delta_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedPosition : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedPosition) */ {
+class SerializedPosition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedPosition) */ {
  public:
-  SerializedPosition();
-  virtual ~SerializedPosition();
+  inline SerializedPosition() : SerializedPosition(nullptr) {}
+  ~SerializedPosition() override;
+  explicit PROTOBUF_CONSTEXPR SerializedPosition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedPosition(const SerializedPosition& from);
-
-  inline SerializedPosition& operator=(const SerializedPosition& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedPosition(SerializedPosition&& from) noexcept
     : SerializedPosition() {
     *this = ::std::move(from);
   }
 
+  inline SerializedPosition& operator=(const SerializedPosition& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedPosition& operator=(SerializedPosition&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedPosition& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedPosition& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedPosition* internal_default_instance() {
     return reinterpret_cast<const SerializedPosition*>(
                &_SerializedPosition_default_instance_);
@@ -361,116 +563,180 @@ class SerializedPosition : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(SerializedPosition* other);
   friend void swap(SerializedPosition& a, SerializedPosition& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedPosition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedPosition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedPosition* New() const final {
-    return CreateMaybeMessage<SerializedPosition>(NULL);
-  }
-
-  SerializedPosition* New(::google::protobuf::Arena* arena) const final {
+  SerializedPosition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedPosition>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedPosition& from);
-  void MergeFrom(const SerializedPosition& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedPosition& from) {
+    SerializedPosition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedPosition* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedPosition";
   }
+  protected:
+  explicit SerializedPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kQuantizedFieldNumber = 4,
+    kZFieldNumber = 3,
+  };
   // float x = 1;
   void clear_x();
-  static const int kXFieldNumber = 1;
   float x() const;
   void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
 
   // float y = 2;
   void clear_y();
-  static const int kYFieldNumber = 2;
   float y() const;
   void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
+
+  // fixed64 quantized = 4;
+  void clear_quantized();
+  uint64_t quantized() const;
+  void set_quantized(uint64_t value);
+  private:
+  uint64_t _internal_quantized() const;
+  void _internal_set_quantized(uint64_t value);
+  public:
 
   // float z = 3;
   void clear_z();
-  static const int kZFieldNumber = 3;
   float z() const;
   void set_z(float value);
+  private:
+  float _internal_z() const;
+  void _internal_set_z(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedPosition)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    uint64_t quantized_;
+    float z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKeypoint : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKeypoint) */ {
+class SerializedKeypoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeypoint) */ {
  public:
-  SerializedKeypoint();
-  virtual ~SerializedKeypoint();
+  inline SerializedKeypoint() : SerializedKeypoint(nullptr) {}
+  ~SerializedKeypoint() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeypoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedKeypoint(const SerializedKeypoint& from);
-
-  inline SerializedKeypoint& operator=(const SerializedKeypoint& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedKeypoint(SerializedKeypoint&& from) noexcept
     : SerializedKeypoint() {
     *this = ::std::move(from);
   }
 
+  inline SerializedKeypoint& operator=(const SerializedKeypoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedKeypoint& operator=(SerializedKeypoint&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKeypoint& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeypoint& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedKeypoint* internal_default_instance() {
     return reinterpret_cast<const SerializedKeypoint*>(
                &_SerializedKeypoint_default_instance_);
@@ -478,123 +744,213 @@ class SerializedKeypoint : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(SerializedKeypoint* other);
   friend void swap(SerializedKeypoint& a, SerializedKeypoint& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedKeypoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeypoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKeypoint* New() const final {
-    return CreateMaybeMessage<SerializedKeypoint>(NULL);
-  }
-
-  SerializedKeypoint* New(::google::protobuf::Arena* arena) const final {
+  SerializedKeypoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedKeypoint>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedKeypoint& from);
-  void MergeFrom(const SerializedKeypoint& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeypoint& from) {
+    SerializedKeypoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedKeypoint* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeypoint";
   }
+  protected:
+  explicit SerializedKeypoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPtxFieldNumber = 1,
+    kPtyFieldNumber = 2,
+    kAngleFieldNumber = 3,
+    kOctaveFieldNumber = 4,
+    kQuantizedptxFieldNumber = 5,
+    kQuantizedptyFieldNumber = 6,
+    kQuantizedangleFieldNumber = 7,
+  };
   // float ptx = 1;
   void clear_ptx();
-  static const int kPtxFieldNumber = 1;
   float ptx() const;
   void set_ptx(float value);
+  private:
+  float _internal_ptx() const;
+  void _internal_set_ptx(float value);
+  public:
 
   // float pty = 2;
   void clear_pty();
-  static const int kPtyFieldNumber = 2;
   float pty() const;
   void set_pty(float value);
+  private:
+  float _internal_pty() const;
+  void _internal_set_pty(float value);
+  public:
 
   // float angle = 3;
   void clear_angle();
-  static const int kAngleFieldNumber = 3;
   float angle() const;
   void set_angle(float value);
+  private:
+  float _internal_angle() const;
+  void _internal_set_angle(float value);
+  public:
 
   // float octave = 4;
   void clear_octave();
-  static const int kOctaveFieldNumber = 4;
   float octave() const;
   void set_octave(float value);
+  private:
+  float _internal_octave() const;
+  void _internal_set_octave(float value);
+  public:
+
+  // sint32 quantizedptx = 5;
+  void clear_quantizedptx();
+  int32_t quantizedptx() const;
+  void set_quantizedptx(int32_t value);
+  private:
+  int32_t _internal_quantizedptx() const;
+  void _internal_set_quantizedptx(int32_t value);
+  public:
+
+  // sint32 quantizedpty = 6;
+  void clear_quantizedpty();
+  int32_t quantizedpty() const;
+  void set_quantizedpty(int32_t value);
+  private:
+  int32_t _internal_quantizedpty() const;
+  void _internal_set_quantizedpty(int32_t value);
+  public:
+
+  // uint32 quantizedangle = 7;
+  void clear_quantizedangle();
+  uint32_t quantizedangle() const;
+  void set_quantizedangle(uint32_t value);
+  private:
+  uint32_t _internal_quantizedangle() const;
+  void _internal_set_quantizedangle(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedKeypoint)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float ptx_;
-  float pty_;
-  float angle_;
-  float octave_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float ptx_;
+    float pty_;
+    float angle_;
+    float octave_;
+    int32_t quantizedptx_;
+    int32_t quantizedpty_;
+    uint32_t quantizedangle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedK : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedK) */ {
+class SerializedK final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedK) */ {
  public:
-  SerializedK();
-  virtual ~SerializedK();
+  inline SerializedK() : SerializedK(nullptr) {}
+  ~SerializedK() override;
+  explicit PROTOBUF_CONSTEXPR SerializedK(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedK(const SerializedK& from);
-
-  inline SerializedK& operator=(const SerializedK& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedK(SerializedK&& from) noexcept
     : SerializedK() {
     *this = ::std::move(from);
   }
 
+  inline SerializedK& operator=(const SerializedK& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedK& operator=(SerializedK&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedK& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedK& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedK* internal_default_instance() {
     return reinterpret_cast<const SerializedK*>(
                &_SerializedK_default_instance_);
@@ -602,123 +958,180 @@ class SerializedK : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(SerializedK* other);
   friend void swap(SerializedK& a, SerializedK& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedK* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedK* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedK* New() const final {
-    return CreateMaybeMessage<SerializedK>(NULL);
-  }
-
-  SerializedK* New(::google::protobuf::Arena* arena) const final {
+  SerializedK* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedK>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedK& from);
-  void MergeFrom(const SerializedK& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedK& from) {
+    SerializedK::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedK* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedK";
   }
+  protected:
+  explicit SerializedK(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFxFieldNumber = 1,
+    kFyFieldNumber = 2,
+    kCxFieldNumber = 3,
+    kCyFieldNumber = 4,
+  };
   // float fx = 1;
   void clear_fx();
-  static const int kFxFieldNumber = 1;
   float fx() const;
   void set_fx(float value);
+  private:
+  float _internal_fx() const;
+  void _internal_set_fx(float value);
+  public:
 
   // float fy = 2;
   void clear_fy();
-  static const int kFyFieldNumber = 2;
   float fy() const;
   void set_fy(float value);
+  private:
+  float _internal_fy() const;
+  void _internal_set_fy(float value);
+  public:
 
   // float cx = 3;
   void clear_cx();
-  static const int kCxFieldNumber = 3;
   float cx() const;
   void set_cx(float value);
+  private:
+  float _internal_cx() const;
+  void _internal_set_cx(float value);
+  public:
 
   // float cy = 4;
   void clear_cy();
-  static const int kCyFieldNumber = 4;
   float cy() const;
   void set_cy(float value);
+  private:
+  float _internal_cy() const;
+  void _internal_set_cy(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedK)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float fx_;
-  float fy_;
-  float cx_;
-  float cy_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float fx_;
+    float fy_;
+    float cx_;
+    float cy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKArray : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKArray) */ {
+class SerializedKArray final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKArray) */ {
  public:
-  SerializedKArray();
-  virtual ~SerializedKArray();
+  inline SerializedKArray() : SerializedKArray(nullptr) {}
+  ~SerializedKArray() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKArray(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedKArray(const SerializedKArray& from);
-
-  inline SerializedKArray& operator=(const SerializedKArray& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedKArray(SerializedKArray&& from) noexcept
     : SerializedKArray() {
     *this = ::std::move(from);
   }
 
+  inline SerializedKArray& operator=(const SerializedKArray& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedKArray& operator=(SerializedKArray&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKArray& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKArray& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedKArray* internal_default_instance() {
     return reinterpret_cast<const SerializedKArray*>(
                &_SerializedKArray_default_instance_);
@@ -726,108 +1139,156 @@ class SerializedKArray : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(SerializedKArray* other);
   friend void swap(SerializedKArray& a, SerializedKArray& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedKArray* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKArray* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKArray* New() const final {
-    return CreateMaybeMessage<SerializedKArray>(NULL);
-  }
-
-  SerializedKArray* New(::google::protobuf::Arena* arena) const final {
+  SerializedKArray* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedKArray>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedKArray& from);
-  void MergeFrom(const SerializedKArray& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKArray& from) {
+    SerializedKArray::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedKArray* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKArray";
   }
+  protected:
+  explicit SerializedKArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kKFieldNumber = 1,
+  };
   // repeated .SerializedK k = 1;
   int k_size() const;
+  private:
+  int _internal_k_size() const;
+  public:
   void clear_k();
-  static const int kKFieldNumber = 1;
   ::SerializedK* mutable_k(int index);
-  ::google::protobuf::RepeatedPtrField< ::SerializedK >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedK >*
       mutable_k();
+  private:
+  const ::SerializedK& _internal_k(int index) const;
+  ::SerializedK* _internal_add_k();
+  public:
   const ::SerializedK& k(int index) const;
   ::SerializedK* add_k();
-  const ::google::protobuf::RepeatedPtrField< ::SerializedK >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedK >&
       k() const;
 
   // @@protoc_insertion_point(class_scope:SerializedKArray)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::SerializedK > k_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedK > k_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedMappoint : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedMappoint) */ {
+class SerializedMappoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedMappoint) */ {
  public:
-  SerializedMappoint();
-  virtual ~SerializedMappoint();
+  inline SerializedMappoint() : SerializedMappoint(nullptr) {}
+  ~SerializedMappoint() override;
+  explicit PROTOBUF_CONSTEXPR SerializedMappoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedMappoint(const SerializedMappoint& from);
-
-  inline SerializedMappoint& operator=(const SerializedMappoint& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedMappoint(SerializedMappoint&& from) noexcept
     : SerializedMappoint() {
     *this = ::std::move(from);
   }
 
+  inline SerializedMappoint& operator=(const SerializedMappoint& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedMappoint& operator=(SerializedMappoint&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedMappoint& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedMappoint& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedMappoint* internal_default_instance() {
     return reinterpret_cast<const SerializedMappoint*>(
                &_SerializedMappoint_default_instance_);
@@ -835,142 +1296,266 @@ class SerializedMappoint : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(SerializedMappoint* other);
   friend void swap(SerializedMappoint& a, SerializedMappoint& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedMappoint* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedMappoint* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedMappoint* New() const final {
-    return CreateMaybeMessage<SerializedMappoint>(NULL);
-  }
-
-  SerializedMappoint* New(::google::protobuf::Arena* arena) const final {
+  SerializedMappoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedMappoint>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedMappoint& from);
-  void MergeFrom(const SerializedMappoint& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedMappoint& from) {
+    SerializedMappoint::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedMappoint* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedMappoint";
   }
+  protected:
+  explicit SerializedMappoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNormalFieldNumber = 6,
+    kPositionFieldNumber = 2,
+    kBriefdescriptorFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kVisibleFieldNumber = 3,
+    kFoundFieldNumber = 4,
+    kMindistanceFieldNumber = 7,
+    kMaxdistanceFieldNumber = 8,
+    kRefkeyframeidFieldNumber = 9,
+  };
+  // repeated float normal = 6;
+  int normal_size() const;
+  private:
+  int _internal_normal_size() const;
+  public:
+  void clear_normal();
+  private:
+  float _internal_normal(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_normal() const;
+  void _internal_add_normal(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_normal();
+  public:
+  float normal(int index) const;
+  void set_normal(int index, float value);
+  void add_normal(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      normal() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_normal();
+
   // .SerializedPosition position = 2;
   bool has_position() const;
-  void clear_position();
-  static const int kPositionFieldNumber = 2;
   private:
-  const ::SerializedPosition& _internal_position() const;
+  bool _internal_has_position() const;
   public:
+  void clear_position();
   const ::SerializedPosition& position() const;
-  ::SerializedPosition* release_position();
+  PROTOBUF_NODISCARD ::SerializedPosition* release_position();
   ::SerializedPosition* mutable_position();
   void set_allocated_position(::SerializedPosition* position);
+  private:
+  const ::SerializedPosition& _internal_position() const;
+  ::SerializedPosition* _internal_mutable_position();
+  public:
+  void unsafe_arena_set_allocated_position(
+      ::SerializedPosition* position);
+  ::SerializedPosition* unsafe_arena_release_position();
 
   // .SerializedDescriptor briefdescriptor = 5;
   bool has_briefdescriptor() const;
-  void clear_briefdescriptor();
-  static const int kBriefdescriptorFieldNumber = 5;
   private:
-  const ::SerializedDescriptor& _internal_briefdescriptor() const;
+  bool _internal_has_briefdescriptor() const;
   public:
+  void clear_briefdescriptor();
   const ::SerializedDescriptor& briefdescriptor() const;
-  ::SerializedDescriptor* release_briefdescriptor();
+  PROTOBUF_NODISCARD ::SerializedDescriptor* release_briefdescriptor();
   ::SerializedDescriptor* mutable_briefdescriptor();
   void set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor);
-
+  private:
+  const ::SerializedDescriptor& _internal_briefdescriptor() const;
+  ::SerializedDescriptor* _internal_mutable_briefdescriptor();
+  public:
+  void unsafe_arena_set_allocated_briefdescriptor(
+      ::SerializedDescriptor* briefdescriptor);
+  ::SerializedDescriptor* unsafe_arena_release_briefdescriptor();
+
   // uint32 id = 1;
   void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::uint32 id() const;
-  void set_id(::google::protobuf::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // float visible = 3;
   void clear_visible();
-  static const int kVisibleFieldNumber = 3;
   float visible() const;
   void set_visible(float value);
+  private:
+  float _internal_visible() const;
+  void _internal_set_visible(float value);
+  public:
 
   // float found = 4;
   void clear_found();
-  static const int kFoundFieldNumber = 4;
   float found() const;
   void set_found(float value);
+  private:
+  float _internal_found() const;
+  void _internal_set_found(float value);
+  public:
+
+  // float mindistance = 7;
+  void clear_mindistance();
+  float mindistance() const;
+  void set_mindistance(float value);
+  private:
+  float _internal_mindistance() const;
+  void _internal_set_mindistance(float value);
+  public:
+
+  // float maxdistance = 8;
+  void clear_maxdistance();
+  float maxdistance() const;
+  void set_maxdistance(float value);
+  private:
+  float _internal_maxdistance() const;
+  void _internal_set_maxdistance(float value);
+  public:
+
+  // uint32 refkeyframeid = 9;
+  void clear_refkeyframeid();
+  uint32_t refkeyframeid() const;
+  void set_refkeyframeid(uint32_t value);
+  private:
+  uint32_t _internal_refkeyframeid() const;
+  void _internal_set_refkeyframeid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedMappoint)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::SerializedPosition* position_;
-  ::SerializedDescriptor* briefdescriptor_;
-  ::google::protobuf::uint32 id_;
-  float visible_;
-  float found_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > normal_;
+    ::SerializedPosition* position_;
+    ::SerializedDescriptor* briefdescriptor_;
+    uint32_t id_;
+    float visible_;
+    float found_;
+    float mindistance_;
+    float maxdistance_;
+    uint32_t refkeyframeid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedMappointArray : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedMappointArray) */ {
+class SerializedMappointArray final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedMappointArray) */ {
  public:
-  SerializedMappointArray();
-  virtual ~SerializedMappointArray();
+  inline SerializedMappointArray() : SerializedMappointArray(nullptr) {}
+  ~SerializedMappointArray() override;
+  explicit PROTOBUF_CONSTEXPR SerializedMappointArray(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedMappointArray(const SerializedMappointArray& from);
-
-  inline SerializedMappointArray& operator=(const SerializedMappointArray& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedMappointArray(SerializedMappointArray&& from) noexcept
     : SerializedMappointArray() {
     *this = ::std::move(from);
   }
 
+  inline SerializedMappointArray& operator=(const SerializedMappointArray& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedMappointArray& operator=(SerializedMappointArray&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedMappointArray& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedMappointArray& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedMappointArray* internal_default_instance() {
     return reinterpret_cast<const SerializedMappointArray*>(
                &_SerializedMappointArray_default_instance_);
@@ -978,108 +1563,156 @@ class SerializedMappointArray : public ::google::protobuf::Message /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(SerializedMappointArray* other);
   friend void swap(SerializedMappointArray& a, SerializedMappointArray& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedMappointArray* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedMappointArray* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedMappointArray* New() const final {
-    return CreateMaybeMessage<SerializedMappointArray>(NULL);
-  }
-
-  SerializedMappointArray* New(::google::protobuf::Arena* arena) const final {
+  SerializedMappointArray* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedMappointArray>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedMappointArray& from);
-  void MergeFrom(const SerializedMappointArray& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedMappointArray& from) {
+    SerializedMappointArray::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedMappointArray* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedMappointArray";
   }
+  protected:
+  explicit SerializedMappointArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMappointFieldNumber = 1,
+  };
   // repeated .SerializedMappoint mappoint = 1;
   int mappoint_size() const;
+  private:
+  int _internal_mappoint_size() const;
+  public:
   void clear_mappoint();
-  static const int kMappointFieldNumber = 1;
   ::SerializedMappoint* mutable_mappoint(int index);
-  ::google::protobuf::RepeatedPtrField< ::SerializedMappoint >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >*
       mutable_mappoint();
+  private:
+  const ::SerializedMappoint& _internal_mappoint(int index) const;
+  ::SerializedMappoint* _internal_add_mappoint();
+  public:
   const ::SerializedMappoint& mappoint(int index) const;
   ::SerializedMappoint* add_mappoint();
-  const ::google::protobuf::RepeatedPtrField< ::SerializedMappoint >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >&
       mappoint() const;
 
   // @@protoc_insertion_point(class_scope:SerializedMappointArray)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::SerializedMappoint > mappoint_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint > mappoint_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKeyframe : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframe) */ {
+class SerializedKeyframe final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframe) */ {
  public:
-  SerializedKeyframe();
-  virtual ~SerializedKeyframe();
+  inline SerializedKeyframe() : SerializedKeyframe(nullptr) {}
+  ~SerializedKeyframe() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframe(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedKeyframe(const SerializedKeyframe& from);
-
-  inline SerializedKeyframe& operator=(const SerializedKeyframe& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedKeyframe(SerializedKeyframe&& from) noexcept
     : SerializedKeyframe() {
     *this = ::std::move(from);
   }
 
+  inline SerializedKeyframe& operator=(const SerializedKeyframe& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedKeyframe& operator=(SerializedKeyframe&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKeyframe& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframe& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedKeyframe* internal_default_instance() {
     return reinterpret_cast<const SerializedKeyframe*>(
                &_SerializedKeyframe_default_instance_);
@@ -1087,156 +1720,331 @@ class SerializedKeyframe : public ::google::protobuf::Message /* @@protoc_insert
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(SerializedKeyframe* other);
   friend void swap(SerializedKeyframe& a, SerializedKeyframe& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedKeyframe* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKeyframe* New() const final {
-    return CreateMaybeMessage<SerializedKeyframe>(NULL);
-  }
-
-  SerializedKeyframe* New(::google::protobuf::Arena* arena) const final {
+  SerializedKeyframe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedKeyframe>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedKeyframe& from);
-  void MergeFrom(const SerializedKeyframe& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframe& from) {
+    SerializedKeyframe::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedKeyframe* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframe";
   }
+  protected:
+  explicit SerializedKeyframe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLoopedgesidsFieldNumber = 5,
+    kLoopedgesdeltasFieldNumber = 8,
+    kCovisibleidsFieldNumber = 9,
+    kCovisibleweightsFieldNumber = 10,
+    kPoseFieldNumber = 2,
+    kKmatrixFieldNumber = 3,
+    kIdFieldNumber = 1,
+    kKindexFieldNumber = 4,
+    kTimestampFieldNumber = 6,
+    kTimestampdeltaFieldNumber = 7,
+    kParentidFieldNumber = 11,
+  };
   // repeated uint32 loopedgesids = 5;
   int loopedgesids_size() const;
+  private:
+  int _internal_loopedgesids_size() const;
+  public:
   void clear_loopedgesids();
-  static const int kLoopedgesidsFieldNumber = 5;
-  ::google::protobuf::uint32 loopedgesids(int index) const;
-  void set_loopedgesids(int index, ::google::protobuf::uint32 value);
-  void add_loopedgesids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_loopedgesids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_loopedgesids() const;
+  void _internal_add_loopedgesids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_loopedgesids();
+  public:
+  uint32_t loopedgesids(int index) const;
+  void set_loopedgesids(int index, uint32_t value);
+  void add_loopedgesids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       loopedgesids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_loopedgesids();
 
+  // repeated uint32 loopedgesdeltas = 8;
+  int loopedgesdeltas_size() const;
+  private:
+  int _internal_loopedgesdeltas_size() const;
+  public:
+  void clear_loopedgesdeltas();
+  private:
+  uint32_t _internal_loopedgesdeltas(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_loopedgesdeltas() const;
+  void _internal_add_loopedgesdeltas(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_loopedgesdeltas();
+  public:
+  uint32_t loopedgesdeltas(int index) const;
+  void set_loopedgesdeltas(int index, uint32_t value);
+  void add_loopedgesdeltas(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      loopedgesdeltas() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_loopedgesdeltas();
+
+  // repeated uint32 covisibleids = 9;
+  int covisibleids_size() const;
+  private:
+  int _internal_covisibleids_size() const;
+  public:
+  void clear_covisibleids();
+  private:
+  uint32_t _internal_covisibleids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_covisibleids() const;
+  void _internal_add_covisibleids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_covisibleids();
+  public:
+  uint32_t covisibleids(int index) const;
+  void set_covisibleids(int index, uint32_t value);
+  void add_covisibleids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      covisibleids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_covisibleids();
+
+  // repeated uint32 covisibleweights = 10;
+  int covisibleweights_size() const;
+  private:
+  int _internal_covisibleweights_size() const;
+  public:
+  void clear_covisibleweights();
+  private:
+  uint32_t _internal_covisibleweights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_covisibleweights() const;
+  void _internal_add_covisibleweights(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_covisibleweights();
+  public:
+  uint32_t covisibleweights(int index) const;
+  void set_covisibleweights(int index, uint32_t value);
+  void add_covisibleweights(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      covisibleweights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_covisibleweights();
+
   // .SerializedPose pose = 2;
   bool has_pose() const;
-  void clear_pose();
-  static const int kPoseFieldNumber = 2;
   private:
-  const ::SerializedPose& _internal_pose() const;
+  bool _internal_has_pose() const;
   public:
+  void clear_pose();
   const ::SerializedPose& pose() const;
-  ::SerializedPose* release_pose();
+  PROTOBUF_NODISCARD ::SerializedPose* release_pose();
   ::SerializedPose* mutable_pose();
   void set_allocated_pose(::SerializedPose* pose);
+  private:
+  const ::SerializedPose& _internal_pose() const;
+  ::SerializedPose* _internal_mutable_pose();
+  public:
+  void unsafe_arena_set_allocated_pose(
+      ::SerializedPose* pose);
+  ::SerializedPose* unsafe_arena_release_pose();
 
   // .SerializedK kmatrix = 3;
   bool has_kmatrix() const;
-  void clear_kmatrix();
-  static const int kKmatrixFieldNumber = 3;
   private:
-  const ::SerializedK& _internal_kmatrix() const;
+  bool _internal_has_kmatrix() const;
   public:
+  void clear_kmatrix();
   const ::SerializedK& kmatrix() const;
-  ::SerializedK* release_kmatrix();
+  PROTOBUF_NODISCARD ::SerializedK* release_kmatrix();
   ::SerializedK* mutable_kmatrix();
   void set_allocated_kmatrix(::SerializedK* kmatrix);
+  private:
+  const ::SerializedK& _internal_kmatrix() const;
+  ::SerializedK* _internal_mutable_kmatrix();
+  public:
+  void unsafe_arena_set_allocated_kmatrix(
+      ::SerializedK* kmatrix);
+  ::SerializedK* unsafe_arena_release_kmatrix();
 
   // uint32 id = 1;
   void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::uint32 id() const;
-  void set_id(::google::protobuf::uint32 value);
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
 
   // uint32 kindex = 4;
   void clear_kindex();
-  static const int kKindexFieldNumber = 4;
-  ::google::protobuf::uint32 kindex() const;
-  void set_kindex(::google::protobuf::uint32 value);
+  uint32_t kindex() const;
+  void set_kindex(uint32_t value);
+  private:
+  uint32_t _internal_kindex() const;
+  void _internal_set_kindex(uint32_t value);
+  public:
 
   // double timestamp = 6;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 6;
   double timestamp() const;
   void set_timestamp(double value);
+  private:
+  double _internal_timestamp() const;
+  void _internal_set_timestamp(double value);
+  public:
+
+  // sint64 timestampdelta = 7;
+  void clear_timestampdelta();
+  int64_t timestampdelta() const;
+  void set_timestampdelta(int64_t value);
+  private:
+  int64_t _internal_timestampdelta() const;
+  void _internal_set_timestampdelta(int64_t value);
+  public:
+
+  // uint32 parentid = 11;
+  void clear_parentid();
+  uint32_t parentid() const;
+  void set_parentid(uint32_t value);
+  private:
+  uint32_t _internal_parentid() const;
+  void _internal_set_parentid(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedKeyframe)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > loopedgesids_;
-  mutable int _loopedgesids_cached_byte_size_;
-  ::SerializedPose* pose_;
-  ::SerializedK* kmatrix_;
-  ::google::protobuf::uint32 id_;
-  ::google::protobuf::uint32 kindex_;
-  double timestamp_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > loopedgesids_;
+    mutable std::atomic<int> _loopedgesids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > loopedgesdeltas_;
+    mutable std::atomic<int> _loopedgesdeltas_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > covisibleids_;
+    mutable std::atomic<int> _covisibleids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > covisibleweights_;
+    mutable std::atomic<int> _covisibleweights_cached_byte_size_;
+    ::SerializedPose* pose_;
+    ::SerializedK* kmatrix_;
+    uint32_t id_;
+    uint32_t kindex_;
+    double timestamp_;
+    int64_t timestampdelta_;
+    uint32_t parentid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKeyframeArray : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeArray) */ {
+class SerializedKeyframeArray final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeArray) */ {
  public:
-  SerializedKeyframeArray();
-  virtual ~SerializedKeyframeArray();
+  inline SerializedKeyframeArray() : SerializedKeyframeArray(nullptr) {}
+  ~SerializedKeyframeArray() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframeArray(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedKeyframeArray(const SerializedKeyframeArray& from);
-
-  inline SerializedKeyframeArray& operator=(const SerializedKeyframeArray& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedKeyframeArray(SerializedKeyframeArray&& from) noexcept
     : SerializedKeyframeArray() {
     *this = ::std::move(from);
   }
 
+  inline SerializedKeyframeArray& operator=(const SerializedKeyframeArray& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedKeyframeArray& operator=(SerializedKeyframeArray&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKeyframeArray& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframeArray& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedKeyframeArray* internal_default_instance() {
     return reinterpret_cast<const SerializedKeyframeArray*>(
                &_SerializedKeyframeArray_default_instance_);
@@ -1244,108 +2052,156 @@ class SerializedKeyframeArray : public ::google::protobuf::Message /* @@protoc_i
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(SerializedKeyframeArray* other);
   friend void swap(SerializedKeyframeArray& a, SerializedKeyframeArray& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedKeyframeArray* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframeArray* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKeyframeArray* New() const final {
-    return CreateMaybeMessage<SerializedKeyframeArray>(NULL);
-  }
-
-  SerializedKeyframeArray* New(::google::protobuf::Arena* arena) const final {
+  SerializedKeyframeArray* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedKeyframeArray>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedKeyframeArray& from);
-  void MergeFrom(const SerializedKeyframeArray& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframeArray& from) {
+    SerializedKeyframeArray::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedKeyframeArray* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframeArray";
   }
+  protected:
+  explicit SerializedKeyframeArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kKeyframeFieldNumber = 1,
+  };
   // repeated .SerializedKeyframe keyframe = 1;
   int keyframe_size() const;
+  private:
+  int _internal_keyframe_size() const;
+  public:
   void clear_keyframe();
-  static const int kKeyframeFieldNumber = 1;
   ::SerializedKeyframe* mutable_keyframe(int index);
-  ::google::protobuf::RepeatedPtrField< ::SerializedKeyframe >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >*
       mutable_keyframe();
+  private:
+  const ::SerializedKeyframe& _internal_keyframe(int index) const;
+  ::SerializedKeyframe* _internal_add_keyframe();
+  public:
   const ::SerializedKeyframe& keyframe(int index) const;
   ::SerializedKeyframe* add_keyframe();
-  const ::google::protobuf::RepeatedPtrField< ::SerializedKeyframe >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >&
       keyframe() const;
 
   // @@protoc_insertion_point(class_scope:SerializedKeyframeArray)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::SerializedKeyframe > keyframe_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe > keyframe_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedFeature : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedFeature) */ {
+class SerializedFeature final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedFeature) */ {
  public:
-  SerializedFeature();
-  virtual ~SerializedFeature();
+  inline SerializedFeature() : SerializedFeature(nullptr) {}
+  ~SerializedFeature() override;
+  explicit PROTOBUF_CONSTEXPR SerializedFeature(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SerializedFeature(const SerializedFeature& from);
-
-  inline SerializedFeature& operator=(const SerializedFeature& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   SerializedFeature(SerializedFeature&& from) noexcept
     : SerializedFeature() {
     *this = ::std::move(from);
   }
 
+  inline SerializedFeature& operator=(const SerializedFeature& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedFeature& operator=(SerializedFeature&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedFeature& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedFeature& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedFeature* internal_default_instance() {
     return reinterpret_cast<const SerializedFeature*>(
                &_SerializedFeature_default_instance_);
@@ -1353,360 +2209,1693 @@ class SerializedFeature : public ::google::protobuf::Message /* @@protoc_inserti
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(SerializedFeature* other);
   friend void swap(SerializedFeature& a, SerializedFeature& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedFeature* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedFeature* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedFeature* New() const final {
-    return CreateMaybeMessage<SerializedFeature>(NULL);
-  }
-
-  SerializedFeature* New(::google::protobuf::Arena* arena) const final {
+  SerializedFeature* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedFeature>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedFeature& from);
-  void MergeFrom(const SerializedFeature& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedFeature& from) {
+    SerializedFeature::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedFeature* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedFeature";
   }
+  protected:
+  explicit SerializedFeature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDescriptorresidualFieldNumber = 5,
+    kKeypointFieldNumber = 3,
+    kBriefdescriptorFieldNumber = 4,
+    kMappointIdFieldNumber = 2,
+  };
+  // bytes descriptorresidual = 5;
+  void clear_descriptorresidual();
+  const std::string& descriptorresidual() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_descriptorresidual(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_descriptorresidual();
+  PROTOBUF_NODISCARD std::string* release_descriptorresidual();
+  void set_allocated_descriptorresidual(std::string* descriptorresidual);
+  private:
+  const std::string& _internal_descriptorresidual() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_descriptorresidual(const std::string& value);
+  std::string* _internal_mutable_descriptorresidual();
+  public:
+
   // .SerializedKeypoint keypoint = 3;
   bool has_keypoint() const;
-  void clear_keypoint();
-  static const int kKeypointFieldNumber = 3;
   private:
-  const ::SerializedKeypoint& _internal_keypoint() const;
+  bool _internal_has_keypoint() const;
   public:
+  void clear_keypoint();
   const ::SerializedKeypoint& keypoint() const;
-  ::SerializedKeypoint* release_keypoint();
+  PROTOBUF_NODISCARD ::SerializedKeypoint* release_keypoint();
   ::SerializedKeypoint* mutable_keypoint();
   void set_allocated_keypoint(::SerializedKeypoint* keypoint);
+  private:
+  const ::SerializedKeypoint& _internal_keypoint() const;
+  ::SerializedKeypoint* _internal_mutable_keypoint();
+  public:
+  void unsafe_arena_set_allocated_keypoint(
+      ::SerializedKeypoint* keypoint);
+  ::SerializedKeypoint* unsafe_arena_release_keypoint();
 
   // .SerializedDescriptor briefdescriptor = 4;
   bool has_briefdescriptor() const;
-  void clear_briefdescriptor();
-  static const int kBriefdescriptorFieldNumber = 4;
   private:
-  const ::SerializedDescriptor& _internal_briefdescriptor() const;
+  bool _internal_has_briefdescriptor() const;
   public:
+  void clear_briefdescriptor();
   const ::SerializedDescriptor& briefdescriptor() const;
-  ::SerializedDescriptor* release_briefdescriptor();
+  PROTOBUF_NODISCARD ::SerializedDescriptor* release_briefdescriptor();
   ::SerializedDescriptor* mutable_briefdescriptor();
   void set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor);
+  private:
+  const ::SerializedDescriptor& _internal_briefdescriptor() const;
+  ::SerializedDescriptor* _internal_mutable_briefdescriptor();
+  public:
+  void unsafe_arena_set_allocated_briefdescriptor(
+      ::SerializedDescriptor* briefdescriptor);
+  ::SerializedDescriptor* unsafe_arena_release_briefdescriptor();
 
   // uint32 mappoint_id = 2;
   void clear_mappoint_id();
-  static const int kMappointIdFieldNumber = 2;
-  ::google::protobuf::uint32 mappoint_id() const;
-  void set_mappoint_id(::google::protobuf::uint32 value);
+  uint32_t mappoint_id() const;
+  void set_mappoint_id(uint32_t value);
+  private:
+  uint32_t _internal_mappoint_id() const;
+  void _internal_set_mappoint_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:SerializedFeature)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::SerializedKeypoint* keypoint_;
-  ::SerializedDescriptor* briefdescriptor_;
-  ::google::protobuf::uint32 mappoint_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr descriptorresidual_;
+    ::SerializedKeypoint* keypoint_;
+    ::SerializedDescriptor* briefdescriptor_;
+    uint32_t mappoint_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKeyframeFeatures : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeFeatures) */ {
+class SerializedBow final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedBow) */ {
  public:
-  SerializedKeyframeFeatures();
-  virtual ~SerializedKeyframeFeatures();
+  inline SerializedBow() : SerializedBow(nullptr) {}
+  ~SerializedBow() override;
+  explicit PROTOBUF_CONSTEXPR SerializedBow(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SerializedKeyframeFeatures(const SerializedKeyframeFeatures& from);
+  SerializedBow(const SerializedBow& from);
+  SerializedBow(SerializedBow&& from) noexcept
+    : SerializedBow() {
+    *this = ::std::move(from);
+  }
 
-  inline SerializedKeyframeFeatures& operator=(const SerializedKeyframeFeatures& from) {
+  inline SerializedBow& operator=(const SerializedBow& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  SerializedKeyframeFeatures(SerializedKeyframeFeatures&& from) noexcept
-    : SerializedKeyframeFeatures() {
-    *this = ::std::move(from);
-  }
-
-  inline SerializedKeyframeFeatures& operator=(SerializedKeyframeFeatures&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline SerializedBow& operator=(SerializedBow&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKeyframeFeatures& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SerializedKeyframeFeatures* internal_default_instance() {
-    return reinterpret_cast<const SerializedKeyframeFeatures*>(
-               &_SerializedKeyframeFeatures_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedBow& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SerializedBow* internal_default_instance() {
+    return reinterpret_cast<const SerializedBow*>(
+               &_SerializedBow_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  void Swap(SerializedKeyframeFeatures* other);
-  friend void swap(SerializedKeyframeFeatures& a, SerializedKeyframeFeatures& b) {
+  friend void swap(SerializedBow& a, SerializedBow& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedBow* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedBow* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKeyframeFeatures* New() const final {
-    return CreateMaybeMessage<SerializedKeyframeFeatures>(NULL);
+  SerializedBow* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SerializedBow>(arena);
   }
-
-  SerializedKeyframeFeatures* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<SerializedKeyframeFeatures>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SerializedBow& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedBow& from) {
+    SerializedBow::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const SerializedKeyframeFeatures& from);
-  void MergeFrom(const SerializedKeyframeFeatures& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SerializedKeyframeFeatures* other);
+  void InternalSwap(SerializedBow* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedBow";
   }
+  protected:
+  explicit SerializedBow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated .SerializedFeature feature = 2;
-  int feature_size() const;
-  void clear_feature();
-  static const int kFeatureFieldNumber = 2;
-  ::SerializedFeature* mutable_feature(int index);
-  ::google::protobuf::RepeatedPtrField< ::SerializedFeature >*
-      mutable_feature();
-  const ::SerializedFeature& feature(int index) const;
-  ::SerializedFeature* add_feature();
-  const ::google::protobuf::RepeatedPtrField< ::SerializedFeature >&
-      feature() const;
-
-  // uint32 keyframe_id = 1;
-  void clear_keyframe_id();
-  static const int kKeyframeIdFieldNumber = 1;
-  ::google::protobuf::uint32 keyframe_id() const;
-  void set_keyframe_id(::google::protobuf::uint32 value);
-
-  // @@protoc_insertion_point(class_scope:SerializedKeyframeFeatures)
+  enum : int {
+    kWorddeltaFieldNumber = 1,
+    kWordvalueFieldNumber = 2,
+    kNodedeltaFieldNumber = 3,
+    kNodesizeFieldNumber = 4,
+    kNodefeatureFieldNumber = 5,
+  };
+  // repeated uint32 worddelta = 1;
+  int worddelta_size() const;
+  private:
+  int _internal_worddelta_size() const;
+  public:
+  void clear_worddelta();
+  private:
+  uint32_t _internal_worddelta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_worddelta() const;
+  void _internal_add_worddelta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_worddelta();
+  public:
+  uint32_t worddelta(int index) const;
+  void set_worddelta(int index, uint32_t value);
+  void add_worddelta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      worddelta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_worddelta();
+
+  // repeated double wordvalue = 2;
+  int wordvalue_size() const;
+  private:
+  int _internal_wordvalue_size() const;
+  public:
+  void clear_wordvalue();
+  private:
+  double _internal_wordvalue(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_wordvalue() const;
+  void _internal_add_wordvalue(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_wordvalue();
+  public:
+  double wordvalue(int index) const;
+  void set_wordvalue(int index, double value);
+  void add_wordvalue(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      wordvalue() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_wordvalue();
+
+  // repeated uint32 nodedelta = 3;
+  int nodedelta_size() const;
+  private:
+  int _internal_nodedelta_size() const;
+  public:
+  void clear_nodedelta();
+  private:
+  uint32_t _internal_nodedelta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nodedelta() const;
+  void _internal_add_nodedelta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nodedelta();
+  public:
+  uint32_t nodedelta(int index) const;
+  void set_nodedelta(int index, uint32_t value);
+  void add_nodedelta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nodedelta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nodedelta();
+
+  // repeated uint32 nodesize = 4;
+  int nodesize_size() const;
+  private:
+  int _internal_nodesize_size() const;
+  public:
+  void clear_nodesize();
+  private:
+  uint32_t _internal_nodesize(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nodesize() const;
+  void _internal_add_nodesize(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nodesize();
+  public:
+  uint32_t nodesize(int index) const;
+  void set_nodesize(int index, uint32_t value);
+  void add_nodesize(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nodesize() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nodesize();
+
+  // repeated uint32 nodefeature = 5;
+  int nodefeature_size() const;
+  private:
+  int _internal_nodefeature_size() const;
+  public:
+  void clear_nodefeature();
+  private:
+  uint32_t _internal_nodefeature(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nodefeature() const;
+  void _internal_add_nodefeature(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nodefeature();
+  public:
+  uint32_t nodefeature(int index) const;
+  void set_nodefeature(int index, uint32_t value);
+  void add_nodefeature(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nodefeature() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nodefeature();
+
+  // @@protoc_insertion_point(class_scope:SerializedBow)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::SerializedFeature > feature_;
-  ::google::protobuf::uint32 keyframe_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > worddelta_;
+    mutable std::atomic<int> _worddelta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > wordvalue_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodedelta_;
+    mutable std::atomic<int> _nodedelta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodesize_;
+    mutable std::atomic<int> _nodesize_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodefeature_;
+    mutable std::atomic<int> _nodefeature_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SerializedKeyframeFeaturesArray : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeFeaturesArray) */ {
+class SerializedKeyframeFeatures final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeFeatures) */ {
  public:
-  SerializedKeyframeFeaturesArray();
-  virtual ~SerializedKeyframeFeaturesArray();
+  inline SerializedKeyframeFeatures() : SerializedKeyframeFeatures(nullptr) {}
+  ~SerializedKeyframeFeatures() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframeFeatures(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SerializedKeyframeFeaturesArray(const SerializedKeyframeFeaturesArray& from);
+  SerializedKeyframeFeatures(const SerializedKeyframeFeatures& from);
+  SerializedKeyframeFeatures(SerializedKeyframeFeatures&& from) noexcept
+    : SerializedKeyframeFeatures() {
+    *this = ::std::move(from);
+  }
 
-  inline SerializedKeyframeFeaturesArray& operator=(const SerializedKeyframeFeaturesArray& from) {
+  inline SerializedKeyframeFeatures& operator=(const SerializedKeyframeFeatures& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SerializedKeyframeFeatures& operator=(SerializedKeyframeFeatures&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframeFeatures& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SerializedKeyframeFeatures* internal_default_instance() {
+    return reinterpret_cast<const SerializedKeyframeFeatures*>(
+               &_SerializedKeyframeFeatures_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SerializedKeyframeFeatures& a, SerializedKeyframeFeatures& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SerializedKeyframeFeatures* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframeFeatures* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SerializedKeyframeFeatures* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SerializedKeyframeFeatures>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SerializedKeyframeFeatures& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframeFeatures& from) {
+    SerializedKeyframeFeatures::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SerializedKeyframeFeatures* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframeFeatures";
+  }
+  protected:
+  explicit SerializedKeyframeFeatures(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFeatureFieldNumber = 2,
+    kBowFieldNumber = 3,
+    kKeyframeIdFieldNumber = 1,
+  };
+  // repeated .SerializedFeature feature = 2;
+  int feature_size() const;
+  private:
+  int _internal_feature_size() const;
+  public:
+  void clear_feature();
+  ::SerializedFeature* mutable_feature(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedFeature >*
+      mutable_feature();
+  private:
+  const ::SerializedFeature& _internal_feature(int index) const;
+  ::SerializedFeature* _internal_add_feature();
+  public:
+  const ::SerializedFeature& feature(int index) const;
+  ::SerializedFeature* add_feature();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedFeature >&
+      feature() const;
+
+  // .SerializedBow bow = 3;
+  bool has_bow() const;
+  private:
+  bool _internal_has_bow() const;
+  public:
+  void clear_bow();
+  const ::SerializedBow& bow() const;
+  PROTOBUF_NODISCARD ::SerializedBow* release_bow();
+  ::SerializedBow* mutable_bow();
+  void set_allocated_bow(::SerializedBow* bow);
+  private:
+  const ::SerializedBow& _internal_bow() const;
+  ::SerializedBow* _internal_mutable_bow();
+  public:
+  void unsafe_arena_set_allocated_bow(
+      ::SerializedBow* bow);
+  ::SerializedBow* unsafe_arena_release_bow();
+
+  // uint32 keyframe_id = 1;
+  void clear_keyframe_id();
+  uint32_t keyframe_id() const;
+  void set_keyframe_id(uint32_t value);
+  private:
+  uint32_t _internal_keyframe_id() const;
+  void _internal_set_keyframe_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SerializedKeyframeFeatures)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedFeature > feature_;
+    ::SerializedBow* bow_;
+    uint32_t keyframe_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SerializedKeyframeColumnarFeatures final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeColumnarFeatures) */ {
+ public:
+  inline SerializedKeyframeColumnarFeatures() : SerializedKeyframeColumnarFeatures(nullptr) {}
+  ~SerializedKeyframeColumnarFeatures() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframeColumnarFeatures(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SerializedKeyframeColumnarFeatures(const SerializedKeyframeColumnarFeatures& from);
+  SerializedKeyframeColumnarFeatures(SerializedKeyframeColumnarFeatures&& from) noexcept
+    : SerializedKeyframeColumnarFeatures() {
+    *this = ::std::move(from);
+  }
+
+  inline SerializedKeyframeColumnarFeatures& operator=(const SerializedKeyframeColumnarFeatures& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline SerializedKeyframeColumnarFeatures& operator=(SerializedKeyframeColumnarFeatures&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframeColumnarFeatures& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SerializedKeyframeColumnarFeatures* internal_default_instance() {
+    return reinterpret_cast<const SerializedKeyframeColumnarFeatures*>(
+               &_SerializedKeyframeColumnarFeatures_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SerializedKeyframeColumnarFeatures& a, SerializedKeyframeColumnarFeatures& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SerializedKeyframeColumnarFeatures* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframeColumnarFeatures* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SerializedKeyframeColumnarFeatures* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SerializedKeyframeColumnarFeatures>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SerializedKeyframeColumnarFeatures& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframeColumnarFeatures& from) {
+    SerializedKeyframeColumnarFeatures::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SerializedKeyframeColumnarFeatures* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframeColumnarFeatures";
+  }
+  protected:
+  explicit SerializedKeyframeColumnarFeatures(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPtxFieldNumber = 2,
+    kPtyFieldNumber = 3,
+    kAngleFieldNumber = 4,
+    kOctaveFieldNumber = 5,
+    kMappointIdFieldNumber = 6,
+    kQuantizedptxFieldNumber = 8,
+    kQuantizedptyFieldNumber = 9,
+    kBriefdescriptorsFieldNumber = 7,
+    kQuantizedangleFieldNumber = 10,
+    kBowFieldNumber = 11,
+    kKeyframeIdFieldNumber = 1,
+  };
+  // repeated float ptx = 2;
+  int ptx_size() const;
+  private:
+  int _internal_ptx_size() const;
+  public:
+  void clear_ptx();
+  private:
+  float _internal_ptx(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_ptx() const;
+  void _internal_add_ptx(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_ptx();
+  public:
+  float ptx(int index) const;
+  void set_ptx(int index, float value);
+  void add_ptx(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      ptx() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_ptx();
+
+  // repeated float pty = 3;
+  int pty_size() const;
+  private:
+  int _internal_pty_size() const;
+  public:
+  void clear_pty();
+  private:
+  float _internal_pty(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_pty() const;
+  void _internal_add_pty(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_pty();
+  public:
+  float pty(int index) const;
+  void set_pty(int index, float value);
+  void add_pty(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      pty() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_pty();
+
+  // repeated float angle = 4;
+  int angle_size() const;
+  private:
+  int _internal_angle_size() const;
+  public:
+  void clear_angle();
+  private:
+  float _internal_angle(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_angle() const;
+  void _internal_add_angle(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_angle();
+  public:
+  float angle(int index) const;
+  void set_angle(int index, float value);
+  void add_angle(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      angle() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_angle();
+
+  // repeated uint32 octave = 5;
+  int octave_size() const;
+  private:
+  int _internal_octave_size() const;
+  public:
+  void clear_octave();
+  private:
+  uint32_t _internal_octave(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_octave() const;
+  void _internal_add_octave(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_octave();
+  public:
+  uint32_t octave(int index) const;
+  void set_octave(int index, uint32_t value);
+  void add_octave(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      octave() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_octave();
+
+  // repeated uint32 mappoint_id = 6;
+  int mappoint_id_size() const;
+  private:
+  int _internal_mappoint_id_size() const;
+  public:
+  void clear_mappoint_id();
+  private:
+  uint32_t _internal_mappoint_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_mappoint_id() const;
+  void _internal_add_mappoint_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_mappoint_id();
+  public:
+  uint32_t mappoint_id(int index) const;
+  void set_mappoint_id(int index, uint32_t value);
+  void add_mappoint_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      mappoint_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_mappoint_id();
+
+  // repeated sint32 quantizedptx = 8;
+  int quantizedptx_size() const;
+  private:
+  int _internal_quantizedptx_size() const;
+  public:
+  void clear_quantizedptx();
+  private:
+  int32_t _internal_quantizedptx(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_quantizedptx() const;
+  void _internal_add_quantizedptx(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_quantizedptx();
+  public:
+  int32_t quantizedptx(int index) const;
+  void set_quantizedptx(int index, int32_t value);
+  void add_quantizedptx(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      quantizedptx() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_quantizedptx();
+
+  // repeated sint32 quantizedpty = 9;
+  int quantizedpty_size() const;
+  private:
+  int _internal_quantizedpty_size() const;
+  public:
+  void clear_quantizedpty();
+  private:
+  int32_t _internal_quantizedpty(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_quantizedpty() const;
+  void _internal_add_quantizedpty(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_quantizedpty();
+  public:
+  int32_t quantizedpty(int index) const;
+  void set_quantizedpty(int index, int32_t value);
+  void add_quantizedpty(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      quantizedpty() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_quantizedpty();
+
+  // bytes briefdescriptors = 7;
+  void clear_briefdescriptors();
+  const std::string& briefdescriptors() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_briefdescriptors(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_briefdescriptors();
+  PROTOBUF_NODISCARD std::string* release_briefdescriptors();
+  void set_allocated_briefdescriptors(std::string* briefdescriptors);
+  private:
+  const std::string& _internal_briefdescriptors() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_briefdescriptors(const std::string& value);
+  std::string* _internal_mutable_briefdescriptors();
+  public:
+
+  // bytes quantizedangle = 10;
+  void clear_quantizedangle();
+  const std::string& quantizedangle() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_quantizedangle(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_quantizedangle();
+  PROTOBUF_NODISCARD std::string* release_quantizedangle();
+  void set_allocated_quantizedangle(std::string* quantizedangle);
+  private:
+  const std::string& _internal_quantizedangle() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_quantizedangle(const std::string& value);
+  std::string* _internal_mutable_quantizedangle();
+  public:
+
+  // .SerializedBow bow = 11;
+  bool has_bow() const;
+  private:
+  bool _internal_has_bow() const;
+  public:
+  void clear_bow();
+  const ::SerializedBow& bow() const;
+  PROTOBUF_NODISCARD ::SerializedBow* release_bow();
+  ::SerializedBow* mutable_bow();
+  void set_allocated_bow(::SerializedBow* bow);
+  private:
+  const ::SerializedBow& _internal_bow() const;
+  ::SerializedBow* _internal_mutable_bow();
+  public:
+  void unsafe_arena_set_allocated_bow(
+      ::SerializedBow* bow);
+  ::SerializedBow* unsafe_arena_release_bow();
+
+  // uint32 keyframe_id = 1;
+  void clear_keyframe_id();
+  uint32_t keyframe_id() const;
+  void set_keyframe_id(uint32_t value);
+  private:
+  uint32_t _internal_keyframe_id() const;
+  void _internal_set_keyframe_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SerializedKeyframeColumnarFeatures)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > ptx_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > pty_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > angle_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > octave_;
+    mutable std::atomic<int> _octave_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > mappoint_id_;
+    mutable std::atomic<int> _mappoint_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > quantizedptx_;
+    mutable std::atomic<int> _quantizedptx_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > quantizedpty_;
+    mutable std::atomic<int> _quantizedpty_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr briefdescriptors_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr quantizedangle_;
+    ::SerializedBow* bow_;
+    uint32_t keyframe_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SerializedKeyframeFeaturesArray final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeFeaturesArray) */ {
+ public:
+  inline SerializedKeyframeFeaturesArray() : SerializedKeyframeFeaturesArray(nullptr) {}
+  ~SerializedKeyframeFeaturesArray() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframeFeaturesArray(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SerializedKeyframeFeaturesArray(const SerializedKeyframeFeaturesArray& from);
   SerializedKeyframeFeaturesArray(SerializedKeyframeFeaturesArray&& from) noexcept
     : SerializedKeyframeFeaturesArray() {
     *this = ::std::move(from);
   }
 
+  inline SerializedKeyframeFeaturesArray& operator=(const SerializedKeyframeFeaturesArray& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline SerializedKeyframeFeaturesArray& operator=(SerializedKeyframeFeaturesArray&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SerializedKeyframeFeaturesArray& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframeFeaturesArray& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const SerializedKeyframeFeaturesArray* internal_default_instance() {
     return reinterpret_cast<const SerializedKeyframeFeaturesArray*>(
                &_SerializedKeyframeFeaturesArray_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    14;
 
-  void Swap(SerializedKeyframeFeaturesArray* other);
   friend void swap(SerializedKeyframeFeaturesArray& a, SerializedKeyframeFeaturesArray& b) {
     a.Swap(&b);
   }
+  inline void Swap(SerializedKeyframeFeaturesArray* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframeFeaturesArray* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline SerializedKeyframeFeaturesArray* New() const final {
-    return CreateMaybeMessage<SerializedKeyframeFeaturesArray>(NULL);
-  }
-
-  SerializedKeyframeFeaturesArray* New(::google::protobuf::Arena* arena) const final {
+  SerializedKeyframeFeaturesArray* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SerializedKeyframeFeaturesArray>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SerializedKeyframeFeaturesArray& from);
-  void MergeFrom(const SerializedKeyframeFeaturesArray& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframeFeaturesArray& from) {
+    SerializedKeyframeFeaturesArray::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SerializedKeyframeFeaturesArray* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframeFeaturesArray";
   }
+  protected:
+  explicit SerializedKeyframeFeaturesArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFeatureFieldNumber = 1,
+    kColumnarfeatureFieldNumber = 2,
+  };
   // repeated .SerializedKeyframeFeatures feature = 1;
   int feature_size() const;
+  private:
+  int _internal_feature_size() const;
+  public:
   void clear_feature();
-  static const int kFeatureFieldNumber = 1;
   ::SerializedKeyframeFeatures* mutable_feature(int index);
-  ::google::protobuf::RepeatedPtrField< ::SerializedKeyframeFeatures >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >*
       mutable_feature();
+  private:
+  const ::SerializedKeyframeFeatures& _internal_feature(int index) const;
+  ::SerializedKeyframeFeatures* _internal_add_feature();
+  public:
   const ::SerializedKeyframeFeatures& feature(int index) const;
   ::SerializedKeyframeFeatures* add_feature();
-  const ::google::protobuf::RepeatedPtrField< ::SerializedKeyframeFeatures >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >&
       feature() const;
 
+  // repeated .SerializedKeyframeColumnarFeatures columnarfeature = 2;
+  int columnarfeature_size() const;
+  private:
+  int _internal_columnarfeature_size() const;
+  public:
+  void clear_columnarfeature();
+  ::SerializedKeyframeColumnarFeatures* mutable_columnarfeature(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeColumnarFeatures >*
+      mutable_columnarfeature();
+  private:
+  const ::SerializedKeyframeColumnarFeatures& _internal_columnarfeature(int index) const;
+  ::SerializedKeyframeColumnarFeatures* _internal_add_columnarfeature();
+  public:
+  const ::SerializedKeyframeColumnarFeatures& columnarfeature(int index) const;
+  ::SerializedKeyframeColumnarFeatures* add_columnarfeature();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeColumnarFeatures >&
+      columnarfeature() const;
+
   // @@protoc_insertion_point(class_scope:SerializedKeyframeFeaturesArray)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::SerializedKeyframeFeatures > feature_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_osmap_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures > feature_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeColumnarFeatures > columnarfeature_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class SerializedJournalEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedJournalEntry) */ {
+ public:
+  inline SerializedJournalEntry() : SerializedJournalEntry(nullptr) {}
+  ~SerializedJournalEntry() override;
+  explicit PROTOBUF_CONSTEXPR SerializedJournalEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  SerializedJournalEntry(const SerializedJournalEntry& from);
+  SerializedJournalEntry(SerializedJournalEntry&& from) noexcept
+    : SerializedJournalEntry() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SerializedDescriptor
+  inline SerializedJournalEntry& operator=(const SerializedJournalEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SerializedJournalEntry& operator=(SerializedJournalEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// repeated fixed32 block = 1;
-inline int SerializedDescriptor::block_size() const {
-  return block_.size();
-}
-inline void SerializedDescriptor::clear_block() {
-  block_.Clear();
-}
-inline ::google::protobuf::uint32 SerializedDescriptor::block(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedDescriptor.block)
-  return block_.Get(index);
-}
-inline void SerializedDescriptor::set_block(int index, ::google::protobuf::uint32 value) {
-  block_.Set(index, value);
-  // @@protoc_insertion_point(field_set:SerializedDescriptor.block)
-}
-inline void SerializedDescriptor::add_block(::google::protobuf::uint32 value) {
-  block_.Add(value);
-  // @@protoc_insertion_point(field_add:SerializedDescriptor.block)
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedJournalEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SerializedJournalEntry* internal_default_instance() {
+    return reinterpret_cast<const SerializedJournalEntry*>(
+               &_SerializedJournalEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(SerializedJournalEntry& a, SerializedJournalEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SerializedJournalEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedJournalEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SerializedJournalEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SerializedJournalEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SerializedJournalEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedJournalEntry& from) {
+    SerializedJournalEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SerializedJournalEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedJournalEntry";
+  }
+  protected:
+  explicit SerializedJournalEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMappointFieldNumber = 1,
+    kKeyframeFieldNumber = 2,
+    kFeaturesFieldNumber = 3,
+    kErasedmappointsidsFieldNumber = 4,
+    kErasedkeyframesidsFieldNumber = 5,
+    kMappointwatermarkFieldNumber = 6,
+    kKeyframewatermarkFieldNumber = 7,
+  };
+  // repeated .SerializedMappoint mappoint = 1;
+  int mappoint_size() const;
+  private:
+  int _internal_mappoint_size() const;
+  public:
+  void clear_mappoint();
+  ::SerializedMappoint* mutable_mappoint(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >*
+      mutable_mappoint();
+  private:
+  const ::SerializedMappoint& _internal_mappoint(int index) const;
+  ::SerializedMappoint* _internal_add_mappoint();
+  public:
+  const ::SerializedMappoint& mappoint(int index) const;
+  ::SerializedMappoint* add_mappoint();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >&
+      mappoint() const;
+
+  // repeated .SerializedKeyframe keyframe = 2;
+  int keyframe_size() const;
+  private:
+  int _internal_keyframe_size() const;
+  public:
+  void clear_keyframe();
+  ::SerializedKeyframe* mutable_keyframe(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >*
+      mutable_keyframe();
+  private:
+  const ::SerializedKeyframe& _internal_keyframe(int index) const;
+  ::SerializedKeyframe* _internal_add_keyframe();
+  public:
+  const ::SerializedKeyframe& keyframe(int index) const;
+  ::SerializedKeyframe* add_keyframe();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >&
+      keyframe() const;
+
+  // repeated .SerializedKeyframeFeatures features = 3;
+  int features_size() const;
+  private:
+  int _internal_features_size() const;
+  public:
+  void clear_features();
+  ::SerializedKeyframeFeatures* mutable_features(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >*
+      mutable_features();
+  private:
+  const ::SerializedKeyframeFeatures& _internal_features(int index) const;
+  ::SerializedKeyframeFeatures* _internal_add_features();
+  public:
+  const ::SerializedKeyframeFeatures& features(int index) const;
+  ::SerializedKeyframeFeatures* add_features();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >&
+      features() const;
+
+  // repeated uint32 erasedmappointsids = 4;
+  int erasedmappointsids_size() const;
+  private:
+  int _internal_erasedmappointsids_size() const;
+  public:
+  void clear_erasedmappointsids();
+  private:
+  uint32_t _internal_erasedmappointsids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_erasedmappointsids() const;
+  void _internal_add_erasedmappointsids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_erasedmappointsids();
+  public:
+  uint32_t erasedmappointsids(int index) const;
+  void set_erasedmappointsids(int index, uint32_t value);
+  void add_erasedmappointsids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      erasedmappointsids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_erasedmappointsids();
+
+  // repeated uint32 erasedkeyframesids = 5;
+  int erasedkeyframesids_size() const;
+  private:
+  int _internal_erasedkeyframesids_size() const;
+  public:
+  void clear_erasedkeyframesids();
+  private:
+  uint32_t _internal_erasedkeyframesids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_erasedkeyframesids() const;
+  void _internal_add_erasedkeyframesids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_erasedkeyframesids();
+  public:
+  uint32_t erasedkeyframesids(int index) const;
+  void set_erasedkeyframesids(int index, uint32_t value);
+  void add_erasedkeyframesids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      erasedkeyframesids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_erasedkeyframesids();
+
+  // uint32 mappointwatermark = 6;
+  void clear_mappointwatermark();
+  uint32_t mappointwatermark() const;
+  void set_mappointwatermark(uint32_t value);
+  private:
+  uint32_t _internal_mappointwatermark() const;
+  void _internal_set_mappointwatermark(uint32_t value);
+  public:
+
+  // uint32 keyframewatermark = 7;
+  void clear_keyframewatermark();
+  uint32_t keyframewatermark() const;
+  void set_keyframewatermark(uint32_t value);
+  private:
+  uint32_t _internal_keyframewatermark() const;
+  void _internal_set_keyframewatermark(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SerializedJournalEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint > mappoint_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe > keyframe_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures > features_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > erasedmappointsids_;
+    mutable std::atomic<int> _erasedmappointsids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > erasedkeyframesids_;
+    mutable std::atomic<int> _erasedkeyframesids_cached_byte_size_;
+    uint32_t mappointwatermark_;
+    uint32_t keyframewatermark_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SerializedKeyframeDatabase final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SerializedKeyframeDatabase) */ {
+ public:
+  inline SerializedKeyframeDatabase() : SerializedKeyframeDatabase(nullptr) {}
+  ~SerializedKeyframeDatabase() override;
+  explicit PROTOBUF_CONSTEXPR SerializedKeyframeDatabase(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SerializedKeyframeDatabase(const SerializedKeyframeDatabase& from);
+  SerializedKeyframeDatabase(SerializedKeyframeDatabase&& from) noexcept
+    : SerializedKeyframeDatabase() {
+    *this = ::std::move(from);
+  }
+
+  inline SerializedKeyframeDatabase& operator=(const SerializedKeyframeDatabase& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SerializedKeyframeDatabase& operator=(SerializedKeyframeDatabase&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SerializedKeyframeDatabase& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SerializedKeyframeDatabase* internal_default_instance() {
+    return reinterpret_cast<const SerializedKeyframeDatabase*>(
+               &_SerializedKeyframeDatabase_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(SerializedKeyframeDatabase& a, SerializedKeyframeDatabase& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SerializedKeyframeDatabase* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SerializedKeyframeDatabase* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SerializedKeyframeDatabase* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SerializedKeyframeDatabase>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SerializedKeyframeDatabase& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SerializedKeyframeDatabase& from) {
+    SerializedKeyframeDatabase::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SerializedKeyframeDatabase* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SerializedKeyframeDatabase";
+  }
+  protected:
+  explicit SerializedKeyframeDatabase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWorddeltaFieldNumber = 1,
+    kNkeyframesFieldNumber = 2,
+    kKeyframedeltaFieldNumber = 3,
+  };
+  // repeated uint32 worddelta = 1;
+  int worddelta_size() const;
+  private:
+  int _internal_worddelta_size() const;
+  public:
+  void clear_worddelta();
+  private:
+  uint32_t _internal_worddelta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_worddelta() const;
+  void _internal_add_worddelta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_worddelta();
+  public:
+  uint32_t worddelta(int index) const;
+  void set_worddelta(int index, uint32_t value);
+  void add_worddelta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      worddelta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_worddelta();
+
+  // repeated uint32 nkeyframes = 2;
+  int nkeyframes_size() const;
+  private:
+  int _internal_nkeyframes_size() const;
+  public:
+  void clear_nkeyframes();
+  private:
+  uint32_t _internal_nkeyframes(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nkeyframes() const;
+  void _internal_add_nkeyframes(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nkeyframes();
+  public:
+  uint32_t nkeyframes(int index) const;
+  void set_nkeyframes(int index, uint32_t value);
+  void add_nkeyframes(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nkeyframes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nkeyframes();
+
+  // repeated uint32 keyframedelta = 3;
+  int keyframedelta_size() const;
+  private:
+  int _internal_keyframedelta_size() const;
+  public:
+  void clear_keyframedelta();
+  private:
+  uint32_t _internal_keyframedelta(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_keyframedelta() const;
+  void _internal_add_keyframedelta(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_keyframedelta();
+  public:
+  uint32_t keyframedelta(int index) const;
+  void set_keyframedelta(int index, uint32_t value);
+  void add_keyframedelta(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      keyframedelta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_keyframedelta();
+
+  // @@protoc_insertion_point(class_scope:SerializedKeyframeDatabase)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > worddelta_;
+    mutable std::atomic<int> _worddelta_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nkeyframes_;
+    mutable std::atomic<int> _nkeyframes_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > keyframedelta_;
+    mutable std::atomic<int> _keyframedelta_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_osmap_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SerializedDescriptor
+
+// repeated fixed32 block = 1;
+inline int SerializedDescriptor::_internal_block_size() const {
+  return _impl_.block_.size();
+}
+inline int SerializedDescriptor::block_size() const {
+  return _internal_block_size();
+}
+inline void SerializedDescriptor::clear_block() {
+  _impl_.block_.Clear();
+}
+inline uint32_t SerializedDescriptor::_internal_block(int index) const {
+  return _impl_.block_.Get(index);
+}
+inline uint32_t SerializedDescriptor::block(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedDescriptor.block)
+  return _internal_block(index);
+}
+inline void SerializedDescriptor::set_block(int index, uint32_t value) {
+  _impl_.block_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedDescriptor.block)
+}
+inline void SerializedDescriptor::_internal_add_block(uint32_t value) {
+  _impl_.block_.Add(value);
+}
+inline void SerializedDescriptor::add_block(uint32_t value) {
+  _internal_add_block(value);
+  // @@protoc_insertion_point(field_add:SerializedDescriptor.block)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedDescriptor::_internal_block() const {
+  return _impl_.block_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 SerializedDescriptor::block() const {
   // @@protoc_insertion_point(field_list:SerializedDescriptor.block)
-  return block_;
+  return _internal_block();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedDescriptor::_internal_mutable_block() {
+  return &_impl_.block_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 SerializedDescriptor::mutable_block() {
   // @@protoc_insertion_point(field_mutable_list:SerializedDescriptor.block)
-  return &block_;
+  return _internal_mutable_block();
 }
 
 // -------------------------------------------------------------------
@@ -1714,847 +3903,3135 @@ SerializedDescriptor::mutable_block() {
 // SerializedPose
 
 // repeated float element = 1;
+inline int SerializedPose::_internal_element_size() const {
+  return _impl_.element_.size();
+}
 inline int SerializedPose::element_size() const {
-  return element_.size();
+  return _internal_element_size();
+}
+inline void SerializedPose::clear_element() {
+  _impl_.element_.Clear();
+}
+inline float SerializedPose::_internal_element(int index) const {
+  return _impl_.element_.Get(index);
+}
+inline float SerializedPose::element(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedPose.element)
+  return _internal_element(index);
+}
+inline void SerializedPose::set_element(int index, float value) {
+  _impl_.element_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedPose.element)
+}
+inline void SerializedPose::_internal_add_element(float value) {
+  _impl_.element_.Add(value);
+}
+inline void SerializedPose::add_element(float value) {
+  _internal_add_element(value);
+  // @@protoc_insertion_point(field_add:SerializedPose.element)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedPose::_internal_element() const {
+  return _impl_.element_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedPose::element() const {
+  // @@protoc_insertion_point(field_list:SerializedPose.element)
+  return _internal_element();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedPose::_internal_mutable_element() {
+  return &_impl_.element_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedPose::mutable_element() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedPose.element)
+  return _internal_mutable_element();
+}
+
+// repeated sint32 quantized = 2;
+inline int SerializedPose::_internal_quantized_size() const {
+  return _impl_.quantized_.size();
+}
+inline int SerializedPose::quantized_size() const {
+  return _internal_quantized_size();
+}
+inline void SerializedPose::clear_quantized() {
+  _impl_.quantized_.Clear();
+}
+inline int32_t SerializedPose::_internal_quantized(int index) const {
+  return _impl_.quantized_.Get(index);
+}
+inline int32_t SerializedPose::quantized(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedPose.quantized)
+  return _internal_quantized(index);
+}
+inline void SerializedPose::set_quantized(int index, int32_t value) {
+  _impl_.quantized_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedPose.quantized)
+}
+inline void SerializedPose::_internal_add_quantized(int32_t value) {
+  _impl_.quantized_.Add(value);
+}
+inline void SerializedPose::add_quantized(int32_t value) {
+  _internal_add_quantized(value);
+  // @@protoc_insertion_point(field_add:SerializedPose.quantized)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedPose::_internal_quantized() const {
+  return _impl_.quantized_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedPose::quantized() const {
+  // @@protoc_insertion_point(field_list:SerializedPose.quantized)
+  return _internal_quantized();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedPose::_internal_mutable_quantized() {
+  return &_impl_.quantized_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedPose::mutable_quantized() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedPose.quantized)
+  return _internal_mutable_quantized();
+}
+
+// repeated float quaternion = 3;
+inline int SerializedPose::_internal_quaternion_size() const {
+  return _impl_.quaternion_.size();
+}
+inline int SerializedPose::quaternion_size() const {
+  return _internal_quaternion_size();
+}
+inline void SerializedPose::clear_quaternion() {
+  _impl_.quaternion_.Clear();
+}
+inline float SerializedPose::_internal_quaternion(int index) const {
+  return _impl_.quaternion_.Get(index);
+}
+inline float SerializedPose::quaternion(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedPose.quaternion)
+  return _internal_quaternion(index);
+}
+inline void SerializedPose::set_quaternion(int index, float value) {
+  _impl_.quaternion_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedPose.quaternion)
+}
+inline void SerializedPose::_internal_add_quaternion(float value) {
+  _impl_.quaternion_.Add(value);
+}
+inline void SerializedPose::add_quaternion(float value) {
+  _internal_add_quaternion(value);
+  // @@protoc_insertion_point(field_add:SerializedPose.quaternion)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedPose::_internal_quaternion() const {
+  return _impl_.quaternion_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedPose::quaternion() const {
+  // @@protoc_insertion_point(field_list:SerializedPose.quaternion)
+  return _internal_quaternion();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedPose::_internal_mutable_quaternion() {
+  return &_impl_.quaternion_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedPose::mutable_quaternion() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedPose.quaternion)
+  return _internal_mutable_quaternion();
+}
+
+// repeated sint32 delta = 4;
+inline int SerializedPose::_internal_delta_size() const {
+  return _impl_.delta_.size();
+}
+inline int SerializedPose::delta_size() const {
+  return _internal_delta_size();
+}
+inline void SerializedPose::clear_delta() {
+  _impl_.delta_.Clear();
+}
+inline int32_t SerializedPose::_internal_delta(int index) const {
+  return _impl_.delta_.Get(index);
+}
+inline int32_t SerializedPose::delta(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedPose.delta)
+  return _internal_delta(index);
+}
+inline void SerializedPose::set_delta(int index, int32_t value) {
+  _impl_.delta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedPose.delta)
+}
+inline void SerializedPose::_internal_add_delta(int32_t value) {
+  _impl_.delta_.Add(value);
+}
+inline void SerializedPose::add_delta(int32_t value) {
+  _internal_add_delta(value);
+  // @@protoc_insertion_point(field_add:SerializedPose.delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedPose::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedPose::delta() const {
+  // @@protoc_insertion_point(field_list:SerializedPose.delta)
+  return _internal_delta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedPose::_internal_mutable_delta() {
+  return &_impl_.delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedPose::mutable_delta() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedPose.delta)
+  return _internal_mutable_delta();
+}
+
+// -------------------------------------------------------------------
+
+// SerializedPosition
+
+// float x = 1;
+inline void SerializedPosition::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float SerializedPosition::_internal_x() const {
+  return _impl_.x_;
+}
+inline float SerializedPosition::x() const {
+  // @@protoc_insertion_point(field_get:SerializedPosition.x)
+  return _internal_x();
+}
+inline void SerializedPosition::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void SerializedPosition::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:SerializedPosition.x)
+}
+
+// float y = 2;
+inline void SerializedPosition::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float SerializedPosition::_internal_y() const {
+  return _impl_.y_;
+}
+inline float SerializedPosition::y() const {
+  // @@protoc_insertion_point(field_get:SerializedPosition.y)
+  return _internal_y();
+}
+inline void SerializedPosition::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void SerializedPosition::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:SerializedPosition.y)
+}
+
+// float z = 3;
+inline void SerializedPosition::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float SerializedPosition::_internal_z() const {
+  return _impl_.z_;
+}
+inline float SerializedPosition::z() const {
+  // @@protoc_insertion_point(field_get:SerializedPosition.z)
+  return _internal_z();
+}
+inline void SerializedPosition::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void SerializedPosition::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:SerializedPosition.z)
+}
+
+// fixed64 quantized = 4;
+inline void SerializedPosition::clear_quantized() {
+  _impl_.quantized_ = uint64_t{0u};
+}
+inline uint64_t SerializedPosition::_internal_quantized() const {
+  return _impl_.quantized_;
+}
+inline uint64_t SerializedPosition::quantized() const {
+  // @@protoc_insertion_point(field_get:SerializedPosition.quantized)
+  return _internal_quantized();
+}
+inline void SerializedPosition::_internal_set_quantized(uint64_t value) {
+  
+  _impl_.quantized_ = value;
+}
+inline void SerializedPosition::set_quantized(uint64_t value) {
+  _internal_set_quantized(value);
+  // @@protoc_insertion_point(field_set:SerializedPosition.quantized)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKeypoint
+
+// float ptx = 1;
+inline void SerializedKeypoint::clear_ptx() {
+  _impl_.ptx_ = 0;
+}
+inline float SerializedKeypoint::_internal_ptx() const {
+  return _impl_.ptx_;
+}
+inline float SerializedKeypoint::ptx() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.ptx)
+  return _internal_ptx();
+}
+inline void SerializedKeypoint::_internal_set_ptx(float value) {
+  
+  _impl_.ptx_ = value;
+}
+inline void SerializedKeypoint::set_ptx(float value) {
+  _internal_set_ptx(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.ptx)
+}
+
+// float pty = 2;
+inline void SerializedKeypoint::clear_pty() {
+  _impl_.pty_ = 0;
+}
+inline float SerializedKeypoint::_internal_pty() const {
+  return _impl_.pty_;
+}
+inline float SerializedKeypoint::pty() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.pty)
+  return _internal_pty();
+}
+inline void SerializedKeypoint::_internal_set_pty(float value) {
+  
+  _impl_.pty_ = value;
+}
+inline void SerializedKeypoint::set_pty(float value) {
+  _internal_set_pty(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.pty)
+}
+
+// float angle = 3;
+inline void SerializedKeypoint::clear_angle() {
+  _impl_.angle_ = 0;
+}
+inline float SerializedKeypoint::_internal_angle() const {
+  return _impl_.angle_;
+}
+inline float SerializedKeypoint::angle() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.angle)
+  return _internal_angle();
+}
+inline void SerializedKeypoint::_internal_set_angle(float value) {
+  
+  _impl_.angle_ = value;
+}
+inline void SerializedKeypoint::set_angle(float value) {
+  _internal_set_angle(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.angle)
+}
+
+// float octave = 4;
+inline void SerializedKeypoint::clear_octave() {
+  _impl_.octave_ = 0;
+}
+inline float SerializedKeypoint::_internal_octave() const {
+  return _impl_.octave_;
+}
+inline float SerializedKeypoint::octave() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.octave)
+  return _internal_octave();
+}
+inline void SerializedKeypoint::_internal_set_octave(float value) {
+  
+  _impl_.octave_ = value;
+}
+inline void SerializedKeypoint::set_octave(float value) {
+  _internal_set_octave(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.octave)
+}
+
+// sint32 quantizedptx = 5;
+inline void SerializedKeypoint::clear_quantizedptx() {
+  _impl_.quantizedptx_ = 0;
+}
+inline int32_t SerializedKeypoint::_internal_quantizedptx() const {
+  return _impl_.quantizedptx_;
+}
+inline int32_t SerializedKeypoint::quantizedptx() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.quantizedptx)
+  return _internal_quantizedptx();
+}
+inline void SerializedKeypoint::_internal_set_quantizedptx(int32_t value) {
+  
+  _impl_.quantizedptx_ = value;
+}
+inline void SerializedKeypoint::set_quantizedptx(int32_t value) {
+  _internal_set_quantizedptx(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.quantizedptx)
+}
+
+// sint32 quantizedpty = 6;
+inline void SerializedKeypoint::clear_quantizedpty() {
+  _impl_.quantizedpty_ = 0;
+}
+inline int32_t SerializedKeypoint::_internal_quantizedpty() const {
+  return _impl_.quantizedpty_;
+}
+inline int32_t SerializedKeypoint::quantizedpty() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.quantizedpty)
+  return _internal_quantizedpty();
+}
+inline void SerializedKeypoint::_internal_set_quantizedpty(int32_t value) {
+  
+  _impl_.quantizedpty_ = value;
+}
+inline void SerializedKeypoint::set_quantizedpty(int32_t value) {
+  _internal_set_quantizedpty(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.quantizedpty)
+}
+
+// uint32 quantizedangle = 7;
+inline void SerializedKeypoint::clear_quantizedangle() {
+  _impl_.quantizedangle_ = 0u;
+}
+inline uint32_t SerializedKeypoint::_internal_quantizedangle() const {
+  return _impl_.quantizedangle_;
+}
+inline uint32_t SerializedKeypoint::quantizedangle() const {
+  // @@protoc_insertion_point(field_get:SerializedKeypoint.quantizedangle)
+  return _internal_quantizedangle();
+}
+inline void SerializedKeypoint::_internal_set_quantizedangle(uint32_t value) {
+  
+  _impl_.quantizedangle_ = value;
+}
+inline void SerializedKeypoint::set_quantizedangle(uint32_t value) {
+  _internal_set_quantizedangle(value);
+  // @@protoc_insertion_point(field_set:SerializedKeypoint.quantizedangle)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedK
+
+// float fx = 1;
+inline void SerializedK::clear_fx() {
+  _impl_.fx_ = 0;
+}
+inline float SerializedK::_internal_fx() const {
+  return _impl_.fx_;
+}
+inline float SerializedK::fx() const {
+  // @@protoc_insertion_point(field_get:SerializedK.fx)
+  return _internal_fx();
+}
+inline void SerializedK::_internal_set_fx(float value) {
+  
+  _impl_.fx_ = value;
+}
+inline void SerializedK::set_fx(float value) {
+  _internal_set_fx(value);
+  // @@protoc_insertion_point(field_set:SerializedK.fx)
+}
+
+// float fy = 2;
+inline void SerializedK::clear_fy() {
+  _impl_.fy_ = 0;
+}
+inline float SerializedK::_internal_fy() const {
+  return _impl_.fy_;
+}
+inline float SerializedK::fy() const {
+  // @@protoc_insertion_point(field_get:SerializedK.fy)
+  return _internal_fy();
+}
+inline void SerializedK::_internal_set_fy(float value) {
+  
+  _impl_.fy_ = value;
+}
+inline void SerializedK::set_fy(float value) {
+  _internal_set_fy(value);
+  // @@protoc_insertion_point(field_set:SerializedK.fy)
+}
+
+// float cx = 3;
+inline void SerializedK::clear_cx() {
+  _impl_.cx_ = 0;
+}
+inline float SerializedK::_internal_cx() const {
+  return _impl_.cx_;
+}
+inline float SerializedK::cx() const {
+  // @@protoc_insertion_point(field_get:SerializedK.cx)
+  return _internal_cx();
+}
+inline void SerializedK::_internal_set_cx(float value) {
+  
+  _impl_.cx_ = value;
+}
+inline void SerializedK::set_cx(float value) {
+  _internal_set_cx(value);
+  // @@protoc_insertion_point(field_set:SerializedK.cx)
+}
+
+// float cy = 4;
+inline void SerializedK::clear_cy() {
+  _impl_.cy_ = 0;
+}
+inline float SerializedK::_internal_cy() const {
+  return _impl_.cy_;
+}
+inline float SerializedK::cy() const {
+  // @@protoc_insertion_point(field_get:SerializedK.cy)
+  return _internal_cy();
+}
+inline void SerializedK::_internal_set_cy(float value) {
+  
+  _impl_.cy_ = value;
+}
+inline void SerializedK::set_cy(float value) {
+  _internal_set_cy(value);
+  // @@protoc_insertion_point(field_set:SerializedK.cy)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKArray
+
+// repeated .SerializedK k = 1;
+inline int SerializedKArray::_internal_k_size() const {
+  return _impl_.k_.size();
+}
+inline int SerializedKArray::k_size() const {
+  return _internal_k_size();
+}
+inline void SerializedKArray::clear_k() {
+  _impl_.k_.Clear();
+}
+inline ::SerializedK* SerializedKArray::mutable_k(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedKArray.k)
+  return _impl_.k_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedK >*
+SerializedKArray::mutable_k() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKArray.k)
+  return &_impl_.k_;
+}
+inline const ::SerializedK& SerializedKArray::_internal_k(int index) const {
+  return _impl_.k_.Get(index);
+}
+inline const ::SerializedK& SerializedKArray::k(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKArray.k)
+  return _internal_k(index);
+}
+inline ::SerializedK* SerializedKArray::_internal_add_k() {
+  return _impl_.k_.Add();
+}
+inline ::SerializedK* SerializedKArray::add_k() {
+  ::SerializedK* _add = _internal_add_k();
+  // @@protoc_insertion_point(field_add:SerializedKArray.k)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedK >&
+SerializedKArray::k() const {
+  // @@protoc_insertion_point(field_list:SerializedKArray.k)
+  return _impl_.k_;
+}
+
+// -------------------------------------------------------------------
+
+// SerializedMappoint
+
+// uint32 id = 1;
+inline void SerializedMappoint::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t SerializedMappoint::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t SerializedMappoint::id() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.id)
+  return _internal_id();
+}
+inline void SerializedMappoint::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SerializedMappoint::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.id)
+}
+
+// .SerializedPosition position = 2;
+inline bool SerializedMappoint::_internal_has_position() const {
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
+}
+inline bool SerializedMappoint::has_position() const {
+  return _internal_has_position();
+}
+inline void SerializedMappoint::clear_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+}
+inline const ::SerializedPosition& SerializedMappoint::_internal_position() const {
+  const ::SerializedPosition* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedPosition&>(
+      ::_SerializedPosition_default_instance_);
+}
+inline const ::SerializedPosition& SerializedMappoint::position() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.position)
+  return _internal_position();
+}
+inline void SerializedMappoint::unsafe_arena_set_allocated_position(
+    ::SerializedPosition* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedMappoint.position)
+}
+inline ::SerializedPosition* SerializedMappoint::release_position() {
+  
+  ::SerializedPosition* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedPosition* SerializedMappoint::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:SerializedMappoint.position)
+  
+  ::SerializedPosition* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+  return temp;
+}
+inline ::SerializedPosition* SerializedMappoint::_internal_mutable_position() {
+  
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedPosition>(GetArenaForAllocation());
+    _impl_.position_ = p;
+  }
+  return _impl_.position_;
+}
+inline ::SerializedPosition* SerializedMappoint::mutable_position() {
+  ::SerializedPosition* _msg = _internal_mutable_position();
+  // @@protoc_insertion_point(field_mutable:SerializedMappoint.position)
+  return _msg;
+}
+inline void SerializedMappoint::set_allocated_position(::SerializedPosition* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:SerializedMappoint.position)
+}
+
+// float visible = 3;
+inline void SerializedMappoint::clear_visible() {
+  _impl_.visible_ = 0;
+}
+inline float SerializedMappoint::_internal_visible() const {
+  return _impl_.visible_;
+}
+inline float SerializedMappoint::visible() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.visible)
+  return _internal_visible();
+}
+inline void SerializedMappoint::_internal_set_visible(float value) {
+  
+  _impl_.visible_ = value;
+}
+inline void SerializedMappoint::set_visible(float value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.visible)
+}
+
+// float found = 4;
+inline void SerializedMappoint::clear_found() {
+  _impl_.found_ = 0;
+}
+inline float SerializedMappoint::_internal_found() const {
+  return _impl_.found_;
+}
+inline float SerializedMappoint::found() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.found)
+  return _internal_found();
+}
+inline void SerializedMappoint::_internal_set_found(float value) {
+  
+  _impl_.found_ = value;
+}
+inline void SerializedMappoint::set_found(float value) {
+  _internal_set_found(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.found)
+}
+
+// .SerializedDescriptor briefdescriptor = 5;
+inline bool SerializedMappoint::_internal_has_briefdescriptor() const {
+  return this != internal_default_instance() && _impl_.briefdescriptor_ != nullptr;
+}
+inline bool SerializedMappoint::has_briefdescriptor() const {
+  return _internal_has_briefdescriptor();
+}
+inline void SerializedMappoint::clear_briefdescriptor() {
+  if (GetArenaForAllocation() == nullptr && _impl_.briefdescriptor_ != nullptr) {
+    delete _impl_.briefdescriptor_;
+  }
+  _impl_.briefdescriptor_ = nullptr;
+}
+inline const ::SerializedDescriptor& SerializedMappoint::_internal_briefdescriptor() const {
+  const ::SerializedDescriptor* p = _impl_.briefdescriptor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedDescriptor&>(
+      ::_SerializedDescriptor_default_instance_);
+}
+inline const ::SerializedDescriptor& SerializedMappoint::briefdescriptor() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.briefdescriptor)
+  return _internal_briefdescriptor();
+}
+inline void SerializedMappoint::unsafe_arena_set_allocated_briefdescriptor(
+    ::SerializedDescriptor* briefdescriptor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.briefdescriptor_);
+  }
+  _impl_.briefdescriptor_ = briefdescriptor;
+  if (briefdescriptor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedMappoint.briefdescriptor)
+}
+inline ::SerializedDescriptor* SerializedMappoint::release_briefdescriptor() {
+  
+  ::SerializedDescriptor* temp = _impl_.briefdescriptor_;
+  _impl_.briefdescriptor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedDescriptor* SerializedMappoint::unsafe_arena_release_briefdescriptor() {
+  // @@protoc_insertion_point(field_release:SerializedMappoint.briefdescriptor)
+  
+  ::SerializedDescriptor* temp = _impl_.briefdescriptor_;
+  _impl_.briefdescriptor_ = nullptr;
+  return temp;
+}
+inline ::SerializedDescriptor* SerializedMappoint::_internal_mutable_briefdescriptor() {
+  
+  if (_impl_.briefdescriptor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedDescriptor>(GetArenaForAllocation());
+    _impl_.briefdescriptor_ = p;
+  }
+  return _impl_.briefdescriptor_;
+}
+inline ::SerializedDescriptor* SerializedMappoint::mutable_briefdescriptor() {
+  ::SerializedDescriptor* _msg = _internal_mutable_briefdescriptor();
+  // @@protoc_insertion_point(field_mutable:SerializedMappoint.briefdescriptor)
+  return _msg;
+}
+inline void SerializedMappoint::set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.briefdescriptor_;
+  }
+  if (briefdescriptor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(briefdescriptor);
+    if (message_arena != submessage_arena) {
+      briefdescriptor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, briefdescriptor, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.briefdescriptor_ = briefdescriptor;
+  // @@protoc_insertion_point(field_set_allocated:SerializedMappoint.briefdescriptor)
+}
+
+// repeated float normal = 6;
+inline int SerializedMappoint::_internal_normal_size() const {
+  return _impl_.normal_.size();
+}
+inline int SerializedMappoint::normal_size() const {
+  return _internal_normal_size();
+}
+inline void SerializedMappoint::clear_normal() {
+  _impl_.normal_.Clear();
+}
+inline float SerializedMappoint::_internal_normal(int index) const {
+  return _impl_.normal_.Get(index);
+}
+inline float SerializedMappoint::normal(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.normal)
+  return _internal_normal(index);
+}
+inline void SerializedMappoint::set_normal(int index, float value) {
+  _impl_.normal_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.normal)
+}
+inline void SerializedMappoint::_internal_add_normal(float value) {
+  _impl_.normal_.Add(value);
+}
+inline void SerializedMappoint::add_normal(float value) {
+  _internal_add_normal(value);
+  // @@protoc_insertion_point(field_add:SerializedMappoint.normal)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedMappoint::_internal_normal() const {
+  return _impl_.normal_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedMappoint::normal() const {
+  // @@protoc_insertion_point(field_list:SerializedMappoint.normal)
+  return _internal_normal();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedMappoint::_internal_mutable_normal() {
+  return &_impl_.normal_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedMappoint::mutable_normal() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedMappoint.normal)
+  return _internal_mutable_normal();
+}
+
+// float mindistance = 7;
+inline void SerializedMappoint::clear_mindistance() {
+  _impl_.mindistance_ = 0;
+}
+inline float SerializedMappoint::_internal_mindistance() const {
+  return _impl_.mindistance_;
+}
+inline float SerializedMappoint::mindistance() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.mindistance)
+  return _internal_mindistance();
+}
+inline void SerializedMappoint::_internal_set_mindistance(float value) {
+  
+  _impl_.mindistance_ = value;
+}
+inline void SerializedMappoint::set_mindistance(float value) {
+  _internal_set_mindistance(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.mindistance)
+}
+
+// float maxdistance = 8;
+inline void SerializedMappoint::clear_maxdistance() {
+  _impl_.maxdistance_ = 0;
+}
+inline float SerializedMappoint::_internal_maxdistance() const {
+  return _impl_.maxdistance_;
+}
+inline float SerializedMappoint::maxdistance() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.maxdistance)
+  return _internal_maxdistance();
+}
+inline void SerializedMappoint::_internal_set_maxdistance(float value) {
+  
+  _impl_.maxdistance_ = value;
+}
+inline void SerializedMappoint::set_maxdistance(float value) {
+  _internal_set_maxdistance(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.maxdistance)
+}
+
+// uint32 refkeyframeid = 9;
+inline void SerializedMappoint::clear_refkeyframeid() {
+  _impl_.refkeyframeid_ = 0u;
+}
+inline uint32_t SerializedMappoint::_internal_refkeyframeid() const {
+  return _impl_.refkeyframeid_;
+}
+inline uint32_t SerializedMappoint::refkeyframeid() const {
+  // @@protoc_insertion_point(field_get:SerializedMappoint.refkeyframeid)
+  return _internal_refkeyframeid();
+}
+inline void SerializedMappoint::_internal_set_refkeyframeid(uint32_t value) {
+  
+  _impl_.refkeyframeid_ = value;
+}
+inline void SerializedMappoint::set_refkeyframeid(uint32_t value) {
+  _internal_set_refkeyframeid(value);
+  // @@protoc_insertion_point(field_set:SerializedMappoint.refkeyframeid)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedMappointArray
+
+// repeated .SerializedMappoint mappoint = 1;
+inline int SerializedMappointArray::_internal_mappoint_size() const {
+  return _impl_.mappoint_.size();
+}
+inline int SerializedMappointArray::mappoint_size() const {
+  return _internal_mappoint_size();
+}
+inline void SerializedMappointArray::clear_mappoint() {
+  _impl_.mappoint_.Clear();
+}
+inline ::SerializedMappoint* SerializedMappointArray::mutable_mappoint(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedMappointArray.mappoint)
+  return _impl_.mappoint_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >*
+SerializedMappointArray::mutable_mappoint() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedMappointArray.mappoint)
+  return &_impl_.mappoint_;
+}
+inline const ::SerializedMappoint& SerializedMappointArray::_internal_mappoint(int index) const {
+  return _impl_.mappoint_.Get(index);
+}
+inline const ::SerializedMappoint& SerializedMappointArray::mappoint(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedMappointArray.mappoint)
+  return _internal_mappoint(index);
+}
+inline ::SerializedMappoint* SerializedMappointArray::_internal_add_mappoint() {
+  return _impl_.mappoint_.Add();
+}
+inline ::SerializedMappoint* SerializedMappointArray::add_mappoint() {
+  ::SerializedMappoint* _add = _internal_add_mappoint();
+  // @@protoc_insertion_point(field_add:SerializedMappointArray.mappoint)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >&
+SerializedMappointArray::mappoint() const {
+  // @@protoc_insertion_point(field_list:SerializedMappointArray.mappoint)
+  return _impl_.mappoint_;
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKeyframe
+
+// uint32 id = 1;
+inline void SerializedKeyframe::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t SerializedKeyframe::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t SerializedKeyframe::id() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.id)
+  return _internal_id();
+}
+inline void SerializedKeyframe::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SerializedKeyframe::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.id)
+}
+
+// .SerializedPose pose = 2;
+inline bool SerializedKeyframe::_internal_has_pose() const {
+  return this != internal_default_instance() && _impl_.pose_ != nullptr;
+}
+inline bool SerializedKeyframe::has_pose() const {
+  return _internal_has_pose();
+}
+inline void SerializedKeyframe::clear_pose() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pose_ != nullptr) {
+    delete _impl_.pose_;
+  }
+  _impl_.pose_ = nullptr;
+}
+inline const ::SerializedPose& SerializedKeyframe::_internal_pose() const {
+  const ::SerializedPose* p = _impl_.pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedPose&>(
+      ::_SerializedPose_default_instance_);
+}
+inline const ::SerializedPose& SerializedKeyframe::pose() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.pose)
+  return _internal_pose();
+}
+inline void SerializedKeyframe::unsafe_arena_set_allocated_pose(
+    ::SerializedPose* pose) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  _impl_.pose_ = pose;
+  if (pose) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedKeyframe.pose)
+}
+inline ::SerializedPose* SerializedKeyframe::release_pose() {
+  
+  ::SerializedPose* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedPose* SerializedKeyframe::unsafe_arena_release_pose() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframe.pose)
+  
+  ::SerializedPose* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+  return temp;
+}
+inline ::SerializedPose* SerializedKeyframe::_internal_mutable_pose() {
+  
+  if (_impl_.pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedPose>(GetArenaForAllocation());
+    _impl_.pose_ = p;
+  }
+  return _impl_.pose_;
+}
+inline ::SerializedPose* SerializedKeyframe::mutable_pose() {
+  ::SerializedPose* _msg = _internal_mutable_pose();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframe.pose)
+  return _msg;
+}
+inline void SerializedKeyframe::set_allocated_pose(::SerializedPose* pose) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pose_;
+  }
+  if (pose) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pose);
+    if (message_arena != submessage_arena) {
+      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pose_ = pose;
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframe.pose)
+}
+
+// .SerializedK kmatrix = 3;
+inline bool SerializedKeyframe::_internal_has_kmatrix() const {
+  return this != internal_default_instance() && _impl_.kmatrix_ != nullptr;
+}
+inline bool SerializedKeyframe::has_kmatrix() const {
+  return _internal_has_kmatrix();
+}
+inline void SerializedKeyframe::clear_kmatrix() {
+  if (GetArenaForAllocation() == nullptr && _impl_.kmatrix_ != nullptr) {
+    delete _impl_.kmatrix_;
+  }
+  _impl_.kmatrix_ = nullptr;
+}
+inline const ::SerializedK& SerializedKeyframe::_internal_kmatrix() const {
+  const ::SerializedK* p = _impl_.kmatrix_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedK&>(
+      ::_SerializedK_default_instance_);
+}
+inline const ::SerializedK& SerializedKeyframe::kmatrix() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.kmatrix)
+  return _internal_kmatrix();
+}
+inline void SerializedKeyframe::unsafe_arena_set_allocated_kmatrix(
+    ::SerializedK* kmatrix) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.kmatrix_);
+  }
+  _impl_.kmatrix_ = kmatrix;
+  if (kmatrix) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedKeyframe.kmatrix)
+}
+inline ::SerializedK* SerializedKeyframe::release_kmatrix() {
+  
+  ::SerializedK* temp = _impl_.kmatrix_;
+  _impl_.kmatrix_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedK* SerializedKeyframe::unsafe_arena_release_kmatrix() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframe.kmatrix)
+  
+  ::SerializedK* temp = _impl_.kmatrix_;
+  _impl_.kmatrix_ = nullptr;
+  return temp;
+}
+inline ::SerializedK* SerializedKeyframe::_internal_mutable_kmatrix() {
+  
+  if (_impl_.kmatrix_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedK>(GetArenaForAllocation());
+    _impl_.kmatrix_ = p;
+  }
+  return _impl_.kmatrix_;
+}
+inline ::SerializedK* SerializedKeyframe::mutable_kmatrix() {
+  ::SerializedK* _msg = _internal_mutable_kmatrix();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframe.kmatrix)
+  return _msg;
+}
+inline void SerializedKeyframe::set_allocated_kmatrix(::SerializedK* kmatrix) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.kmatrix_;
+  }
+  if (kmatrix) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(kmatrix);
+    if (message_arena != submessage_arena) {
+      kmatrix = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, kmatrix, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.kmatrix_ = kmatrix;
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframe.kmatrix)
+}
+
+// uint32 kindex = 4;
+inline void SerializedKeyframe::clear_kindex() {
+  _impl_.kindex_ = 0u;
+}
+inline uint32_t SerializedKeyframe::_internal_kindex() const {
+  return _impl_.kindex_;
+}
+inline uint32_t SerializedKeyframe::kindex() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.kindex)
+  return _internal_kindex();
+}
+inline void SerializedKeyframe::_internal_set_kindex(uint32_t value) {
+  
+  _impl_.kindex_ = value;
+}
+inline void SerializedKeyframe::set_kindex(uint32_t value) {
+  _internal_set_kindex(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.kindex)
+}
+
+// repeated uint32 loopedgesids = 5;
+inline int SerializedKeyframe::_internal_loopedgesids_size() const {
+  return _impl_.loopedgesids_.size();
+}
+inline int SerializedKeyframe::loopedgesids_size() const {
+  return _internal_loopedgesids_size();
+}
+inline void SerializedKeyframe::clear_loopedgesids() {
+  _impl_.loopedgesids_.Clear();
+}
+inline uint32_t SerializedKeyframe::_internal_loopedgesids(int index) const {
+  return _impl_.loopedgesids_.Get(index);
+}
+inline uint32_t SerializedKeyframe::loopedgesids(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.loopedgesids)
+  return _internal_loopedgesids(index);
+}
+inline void SerializedKeyframe::set_loopedgesids(int index, uint32_t value) {
+  _impl_.loopedgesids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.loopedgesids)
+}
+inline void SerializedKeyframe::_internal_add_loopedgesids(uint32_t value) {
+  _impl_.loopedgesids_.Add(value);
+}
+inline void SerializedKeyframe::add_loopedgesids(uint32_t value) {
+  _internal_add_loopedgesids(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframe.loopedgesids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::_internal_loopedgesids() const {
+  return _impl_.loopedgesids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::loopedgesids() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframe.loopedgesids)
+  return _internal_loopedgesids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::_internal_mutable_loopedgesids() {
+  return &_impl_.loopedgesids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::mutable_loopedgesids() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframe.loopedgesids)
+  return _internal_mutable_loopedgesids();
+}
+
+// double timestamp = 6;
+inline void SerializedKeyframe::clear_timestamp() {
+  _impl_.timestamp_ = 0;
+}
+inline double SerializedKeyframe::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline double SerializedKeyframe::timestamp() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.timestamp)
+  return _internal_timestamp();
+}
+inline void SerializedKeyframe::_internal_set_timestamp(double value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void SerializedKeyframe::set_timestamp(double value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.timestamp)
+}
+
+// sint64 timestampdelta = 7;
+inline void SerializedKeyframe::clear_timestampdelta() {
+  _impl_.timestampdelta_ = int64_t{0};
+}
+inline int64_t SerializedKeyframe::_internal_timestampdelta() const {
+  return _impl_.timestampdelta_;
+}
+inline int64_t SerializedKeyframe::timestampdelta() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.timestampdelta)
+  return _internal_timestampdelta();
+}
+inline void SerializedKeyframe::_internal_set_timestampdelta(int64_t value) {
+  
+  _impl_.timestampdelta_ = value;
+}
+inline void SerializedKeyframe::set_timestampdelta(int64_t value) {
+  _internal_set_timestampdelta(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.timestampdelta)
+}
+
+// repeated uint32 loopedgesdeltas = 8;
+inline int SerializedKeyframe::_internal_loopedgesdeltas_size() const {
+  return _impl_.loopedgesdeltas_.size();
+}
+inline int SerializedKeyframe::loopedgesdeltas_size() const {
+  return _internal_loopedgesdeltas_size();
+}
+inline void SerializedKeyframe::clear_loopedgesdeltas() {
+  _impl_.loopedgesdeltas_.Clear();
+}
+inline uint32_t SerializedKeyframe::_internal_loopedgesdeltas(int index) const {
+  return _impl_.loopedgesdeltas_.Get(index);
+}
+inline uint32_t SerializedKeyframe::loopedgesdeltas(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.loopedgesdeltas)
+  return _internal_loopedgesdeltas(index);
+}
+inline void SerializedKeyframe::set_loopedgesdeltas(int index, uint32_t value) {
+  _impl_.loopedgesdeltas_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.loopedgesdeltas)
+}
+inline void SerializedKeyframe::_internal_add_loopedgesdeltas(uint32_t value) {
+  _impl_.loopedgesdeltas_.Add(value);
+}
+inline void SerializedKeyframe::add_loopedgesdeltas(uint32_t value) {
+  _internal_add_loopedgesdeltas(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframe.loopedgesdeltas)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::_internal_loopedgesdeltas() const {
+  return _impl_.loopedgesdeltas_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::loopedgesdeltas() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframe.loopedgesdeltas)
+  return _internal_loopedgesdeltas();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::_internal_mutable_loopedgesdeltas() {
+  return &_impl_.loopedgesdeltas_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::mutable_loopedgesdeltas() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframe.loopedgesdeltas)
+  return _internal_mutable_loopedgesdeltas();
+}
+
+// repeated uint32 covisibleids = 9;
+inline int SerializedKeyframe::_internal_covisibleids_size() const {
+  return _impl_.covisibleids_.size();
+}
+inline int SerializedKeyframe::covisibleids_size() const {
+  return _internal_covisibleids_size();
+}
+inline void SerializedKeyframe::clear_covisibleids() {
+  _impl_.covisibleids_.Clear();
+}
+inline uint32_t SerializedKeyframe::_internal_covisibleids(int index) const {
+  return _impl_.covisibleids_.Get(index);
+}
+inline uint32_t SerializedKeyframe::covisibleids(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.covisibleids)
+  return _internal_covisibleids(index);
+}
+inline void SerializedKeyframe::set_covisibleids(int index, uint32_t value) {
+  _impl_.covisibleids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.covisibleids)
+}
+inline void SerializedKeyframe::_internal_add_covisibleids(uint32_t value) {
+  _impl_.covisibleids_.Add(value);
+}
+inline void SerializedKeyframe::add_covisibleids(uint32_t value) {
+  _internal_add_covisibleids(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframe.covisibleids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::_internal_covisibleids() const {
+  return _impl_.covisibleids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::covisibleids() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframe.covisibleids)
+  return _internal_covisibleids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::_internal_mutable_covisibleids() {
+  return &_impl_.covisibleids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::mutable_covisibleids() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframe.covisibleids)
+  return _internal_mutable_covisibleids();
+}
+
+// repeated uint32 covisibleweights = 10;
+inline int SerializedKeyframe::_internal_covisibleweights_size() const {
+  return _impl_.covisibleweights_.size();
+}
+inline int SerializedKeyframe::covisibleweights_size() const {
+  return _internal_covisibleweights_size();
+}
+inline void SerializedKeyframe::clear_covisibleweights() {
+  _impl_.covisibleweights_.Clear();
+}
+inline uint32_t SerializedKeyframe::_internal_covisibleweights(int index) const {
+  return _impl_.covisibleweights_.Get(index);
+}
+inline uint32_t SerializedKeyframe::covisibleweights(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.covisibleweights)
+  return _internal_covisibleweights(index);
+}
+inline void SerializedKeyframe::set_covisibleweights(int index, uint32_t value) {
+  _impl_.covisibleweights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.covisibleweights)
+}
+inline void SerializedKeyframe::_internal_add_covisibleweights(uint32_t value) {
+  _impl_.covisibleweights_.Add(value);
+}
+inline void SerializedKeyframe::add_covisibleweights(uint32_t value) {
+  _internal_add_covisibleweights(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframe.covisibleweights)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::_internal_covisibleweights() const {
+  return _impl_.covisibleweights_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframe::covisibleweights() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframe.covisibleweights)
+  return _internal_covisibleweights();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::_internal_mutable_covisibleweights() {
+  return &_impl_.covisibleweights_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframe::mutable_covisibleweights() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframe.covisibleweights)
+  return _internal_mutable_covisibleweights();
+}
+
+// uint32 parentid = 11;
+inline void SerializedKeyframe::clear_parentid() {
+  _impl_.parentid_ = 0u;
+}
+inline uint32_t SerializedKeyframe::_internal_parentid() const {
+  return _impl_.parentid_;
+}
+inline uint32_t SerializedKeyframe::parentid() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframe.parentid)
+  return _internal_parentid();
+}
+inline void SerializedKeyframe::_internal_set_parentid(uint32_t value) {
+  
+  _impl_.parentid_ = value;
+}
+inline void SerializedKeyframe::set_parentid(uint32_t value) {
+  _internal_set_parentid(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframe.parentid)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKeyframeArray
+
+// repeated .SerializedKeyframe keyframe = 1;
+inline int SerializedKeyframeArray::_internal_keyframe_size() const {
+  return _impl_.keyframe_.size();
+}
+inline int SerializedKeyframeArray::keyframe_size() const {
+  return _internal_keyframe_size();
+}
+inline void SerializedKeyframeArray::clear_keyframe() {
+  _impl_.keyframe_.Clear();
+}
+inline ::SerializedKeyframe* SerializedKeyframeArray::mutable_keyframe(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeArray.keyframe)
+  return _impl_.keyframe_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >*
+SerializedKeyframeArray::mutable_keyframe() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeArray.keyframe)
+  return &_impl_.keyframe_;
+}
+inline const ::SerializedKeyframe& SerializedKeyframeArray::_internal_keyframe(int index) const {
+  return _impl_.keyframe_.Get(index);
+}
+inline const ::SerializedKeyframe& SerializedKeyframeArray::keyframe(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeArray.keyframe)
+  return _internal_keyframe(index);
+}
+inline ::SerializedKeyframe* SerializedKeyframeArray::_internal_add_keyframe() {
+  return _impl_.keyframe_.Add();
+}
+inline ::SerializedKeyframe* SerializedKeyframeArray::add_keyframe() {
+  ::SerializedKeyframe* _add = _internal_add_keyframe();
+  // @@protoc_insertion_point(field_add:SerializedKeyframeArray.keyframe)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >&
+SerializedKeyframeArray::keyframe() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeArray.keyframe)
+  return _impl_.keyframe_;
+}
+
+// -------------------------------------------------------------------
+
+// SerializedFeature
+
+// uint32 mappoint_id = 2;
+inline void SerializedFeature::clear_mappoint_id() {
+  _impl_.mappoint_id_ = 0u;
+}
+inline uint32_t SerializedFeature::_internal_mappoint_id() const {
+  return _impl_.mappoint_id_;
+}
+inline uint32_t SerializedFeature::mappoint_id() const {
+  // @@protoc_insertion_point(field_get:SerializedFeature.mappoint_id)
+  return _internal_mappoint_id();
+}
+inline void SerializedFeature::_internal_set_mappoint_id(uint32_t value) {
+  
+  _impl_.mappoint_id_ = value;
+}
+inline void SerializedFeature::set_mappoint_id(uint32_t value) {
+  _internal_set_mappoint_id(value);
+  // @@protoc_insertion_point(field_set:SerializedFeature.mappoint_id)
+}
+
+// .SerializedKeypoint keypoint = 3;
+inline bool SerializedFeature::_internal_has_keypoint() const {
+  return this != internal_default_instance() && _impl_.keypoint_ != nullptr;
+}
+inline bool SerializedFeature::has_keypoint() const {
+  return _internal_has_keypoint();
+}
+inline void SerializedFeature::clear_keypoint() {
+  if (GetArenaForAllocation() == nullptr && _impl_.keypoint_ != nullptr) {
+    delete _impl_.keypoint_;
+  }
+  _impl_.keypoint_ = nullptr;
+}
+inline const ::SerializedKeypoint& SerializedFeature::_internal_keypoint() const {
+  const ::SerializedKeypoint* p = _impl_.keypoint_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedKeypoint&>(
+      ::_SerializedKeypoint_default_instance_);
+}
+inline const ::SerializedKeypoint& SerializedFeature::keypoint() const {
+  // @@protoc_insertion_point(field_get:SerializedFeature.keypoint)
+  return _internal_keypoint();
+}
+inline void SerializedFeature::unsafe_arena_set_allocated_keypoint(
+    ::SerializedKeypoint* keypoint) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.keypoint_);
+  }
+  _impl_.keypoint_ = keypoint;
+  if (keypoint) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedFeature.keypoint)
+}
+inline ::SerializedKeypoint* SerializedFeature::release_keypoint() {
+  
+  ::SerializedKeypoint* temp = _impl_.keypoint_;
+  _impl_.keypoint_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedKeypoint* SerializedFeature::unsafe_arena_release_keypoint() {
+  // @@protoc_insertion_point(field_release:SerializedFeature.keypoint)
+  
+  ::SerializedKeypoint* temp = _impl_.keypoint_;
+  _impl_.keypoint_ = nullptr;
+  return temp;
+}
+inline ::SerializedKeypoint* SerializedFeature::_internal_mutable_keypoint() {
+  
+  if (_impl_.keypoint_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedKeypoint>(GetArenaForAllocation());
+    _impl_.keypoint_ = p;
+  }
+  return _impl_.keypoint_;
+}
+inline ::SerializedKeypoint* SerializedFeature::mutable_keypoint() {
+  ::SerializedKeypoint* _msg = _internal_mutable_keypoint();
+  // @@protoc_insertion_point(field_mutable:SerializedFeature.keypoint)
+  return _msg;
+}
+inline void SerializedFeature::set_allocated_keypoint(::SerializedKeypoint* keypoint) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.keypoint_;
+  }
+  if (keypoint) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(keypoint);
+    if (message_arena != submessage_arena) {
+      keypoint = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, keypoint, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.keypoint_ = keypoint;
+  // @@protoc_insertion_point(field_set_allocated:SerializedFeature.keypoint)
+}
+
+// .SerializedDescriptor briefdescriptor = 4;
+inline bool SerializedFeature::_internal_has_briefdescriptor() const {
+  return this != internal_default_instance() && _impl_.briefdescriptor_ != nullptr;
+}
+inline bool SerializedFeature::has_briefdescriptor() const {
+  return _internal_has_briefdescriptor();
+}
+inline void SerializedFeature::clear_briefdescriptor() {
+  if (GetArenaForAllocation() == nullptr && _impl_.briefdescriptor_ != nullptr) {
+    delete _impl_.briefdescriptor_;
+  }
+  _impl_.briefdescriptor_ = nullptr;
+}
+inline const ::SerializedDescriptor& SerializedFeature::_internal_briefdescriptor() const {
+  const ::SerializedDescriptor* p = _impl_.briefdescriptor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedDescriptor&>(
+      ::_SerializedDescriptor_default_instance_);
+}
+inline const ::SerializedDescriptor& SerializedFeature::briefdescriptor() const {
+  // @@protoc_insertion_point(field_get:SerializedFeature.briefdescriptor)
+  return _internal_briefdescriptor();
+}
+inline void SerializedFeature::unsafe_arena_set_allocated_briefdescriptor(
+    ::SerializedDescriptor* briefdescriptor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.briefdescriptor_);
+  }
+  _impl_.briefdescriptor_ = briefdescriptor;
+  if (briefdescriptor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedFeature.briefdescriptor)
+}
+inline ::SerializedDescriptor* SerializedFeature::release_briefdescriptor() {
+  
+  ::SerializedDescriptor* temp = _impl_.briefdescriptor_;
+  _impl_.briefdescriptor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedDescriptor* SerializedFeature::unsafe_arena_release_briefdescriptor() {
+  // @@protoc_insertion_point(field_release:SerializedFeature.briefdescriptor)
+  
+  ::SerializedDescriptor* temp = _impl_.briefdescriptor_;
+  _impl_.briefdescriptor_ = nullptr;
+  return temp;
+}
+inline ::SerializedDescriptor* SerializedFeature::_internal_mutable_briefdescriptor() {
+  
+  if (_impl_.briefdescriptor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedDescriptor>(GetArenaForAllocation());
+    _impl_.briefdescriptor_ = p;
+  }
+  return _impl_.briefdescriptor_;
+}
+inline ::SerializedDescriptor* SerializedFeature::mutable_briefdescriptor() {
+  ::SerializedDescriptor* _msg = _internal_mutable_briefdescriptor();
+  // @@protoc_insertion_point(field_mutable:SerializedFeature.briefdescriptor)
+  return _msg;
+}
+inline void SerializedFeature::set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.briefdescriptor_;
+  }
+  if (briefdescriptor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(briefdescriptor);
+    if (message_arena != submessage_arena) {
+      briefdescriptor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, briefdescriptor, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.briefdescriptor_ = briefdescriptor;
+  // @@protoc_insertion_point(field_set_allocated:SerializedFeature.briefdescriptor)
+}
+
+// bytes descriptorresidual = 5;
+inline void SerializedFeature::clear_descriptorresidual() {
+  _impl_.descriptorresidual_.ClearToEmpty();
+}
+inline const std::string& SerializedFeature::descriptorresidual() const {
+  // @@protoc_insertion_point(field_get:SerializedFeature.descriptorresidual)
+  return _internal_descriptorresidual();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SerializedFeature::set_descriptorresidual(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.descriptorresidual_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SerializedFeature.descriptorresidual)
+}
+inline std::string* SerializedFeature::mutable_descriptorresidual() {
+  std::string* _s = _internal_mutable_descriptorresidual();
+  // @@protoc_insertion_point(field_mutable:SerializedFeature.descriptorresidual)
+  return _s;
+}
+inline const std::string& SerializedFeature::_internal_descriptorresidual() const {
+  return _impl_.descriptorresidual_.Get();
+}
+inline void SerializedFeature::_internal_set_descriptorresidual(const std::string& value) {
+  
+  _impl_.descriptorresidual_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SerializedFeature::_internal_mutable_descriptorresidual() {
+  
+  return _impl_.descriptorresidual_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SerializedFeature::release_descriptorresidual() {
+  // @@protoc_insertion_point(field_release:SerializedFeature.descriptorresidual)
+  return _impl_.descriptorresidual_.Release();
+}
+inline void SerializedFeature::set_allocated_descriptorresidual(std::string* descriptorresidual) {
+  if (descriptorresidual != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.descriptorresidual_.SetAllocated(descriptorresidual, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.descriptorresidual_.IsDefault()) {
+    _impl_.descriptorresidual_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SerializedFeature.descriptorresidual)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedBow
+
+// repeated uint32 worddelta = 1;
+inline int SerializedBow::_internal_worddelta_size() const {
+  return _impl_.worddelta_.size();
+}
+inline int SerializedBow::worddelta_size() const {
+  return _internal_worddelta_size();
+}
+inline void SerializedBow::clear_worddelta() {
+  _impl_.worddelta_.Clear();
+}
+inline uint32_t SerializedBow::_internal_worddelta(int index) const {
+  return _impl_.worddelta_.Get(index);
+}
+inline uint32_t SerializedBow::worddelta(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedBow.worddelta)
+  return _internal_worddelta(index);
+}
+inline void SerializedBow::set_worddelta(int index, uint32_t value) {
+  _impl_.worddelta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedBow.worddelta)
+}
+inline void SerializedBow::_internal_add_worddelta(uint32_t value) {
+  _impl_.worddelta_.Add(value);
+}
+inline void SerializedBow::add_worddelta(uint32_t value) {
+  _internal_add_worddelta(value);
+  // @@protoc_insertion_point(field_add:SerializedBow.worddelta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::_internal_worddelta() const {
+  return _impl_.worddelta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::worddelta() const {
+  // @@protoc_insertion_point(field_list:SerializedBow.worddelta)
+  return _internal_worddelta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::_internal_mutable_worddelta() {
+  return &_impl_.worddelta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::mutable_worddelta() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedBow.worddelta)
+  return _internal_mutable_worddelta();
+}
+
+// repeated double wordvalue = 2;
+inline int SerializedBow::_internal_wordvalue_size() const {
+  return _impl_.wordvalue_.size();
+}
+inline int SerializedBow::wordvalue_size() const {
+  return _internal_wordvalue_size();
+}
+inline void SerializedBow::clear_wordvalue() {
+  _impl_.wordvalue_.Clear();
+}
+inline double SerializedBow::_internal_wordvalue(int index) const {
+  return _impl_.wordvalue_.Get(index);
+}
+inline double SerializedBow::wordvalue(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedBow.wordvalue)
+  return _internal_wordvalue(index);
+}
+inline void SerializedBow::set_wordvalue(int index, double value) {
+  _impl_.wordvalue_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedBow.wordvalue)
+}
+inline void SerializedBow::_internal_add_wordvalue(double value) {
+  _impl_.wordvalue_.Add(value);
+}
+inline void SerializedBow::add_wordvalue(double value) {
+  _internal_add_wordvalue(value);
+  // @@protoc_insertion_point(field_add:SerializedBow.wordvalue)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+SerializedBow::_internal_wordvalue() const {
+  return _impl_.wordvalue_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+SerializedBow::wordvalue() const {
+  // @@protoc_insertion_point(field_list:SerializedBow.wordvalue)
+  return _internal_wordvalue();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+SerializedBow::_internal_mutable_wordvalue() {
+  return &_impl_.wordvalue_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+SerializedBow::mutable_wordvalue() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedBow.wordvalue)
+  return _internal_mutable_wordvalue();
+}
+
+// repeated uint32 nodedelta = 3;
+inline int SerializedBow::_internal_nodedelta_size() const {
+  return _impl_.nodedelta_.size();
+}
+inline int SerializedBow::nodedelta_size() const {
+  return _internal_nodedelta_size();
+}
+inline void SerializedBow::clear_nodedelta() {
+  _impl_.nodedelta_.Clear();
+}
+inline uint32_t SerializedBow::_internal_nodedelta(int index) const {
+  return _impl_.nodedelta_.Get(index);
+}
+inline uint32_t SerializedBow::nodedelta(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedBow.nodedelta)
+  return _internal_nodedelta(index);
+}
+inline void SerializedBow::set_nodedelta(int index, uint32_t value) {
+  _impl_.nodedelta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedBow.nodedelta)
+}
+inline void SerializedBow::_internal_add_nodedelta(uint32_t value) {
+  _impl_.nodedelta_.Add(value);
+}
+inline void SerializedBow::add_nodedelta(uint32_t value) {
+  _internal_add_nodedelta(value);
+  // @@protoc_insertion_point(field_add:SerializedBow.nodedelta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::_internal_nodedelta() const {
+  return _impl_.nodedelta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::nodedelta() const {
+  // @@protoc_insertion_point(field_list:SerializedBow.nodedelta)
+  return _internal_nodedelta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::_internal_mutable_nodedelta() {
+  return &_impl_.nodedelta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::mutable_nodedelta() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedBow.nodedelta)
+  return _internal_mutable_nodedelta();
+}
+
+// repeated uint32 nodesize = 4;
+inline int SerializedBow::_internal_nodesize_size() const {
+  return _impl_.nodesize_.size();
+}
+inline int SerializedBow::nodesize_size() const {
+  return _internal_nodesize_size();
+}
+inline void SerializedBow::clear_nodesize() {
+  _impl_.nodesize_.Clear();
+}
+inline uint32_t SerializedBow::_internal_nodesize(int index) const {
+  return _impl_.nodesize_.Get(index);
+}
+inline uint32_t SerializedBow::nodesize(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedBow.nodesize)
+  return _internal_nodesize(index);
+}
+inline void SerializedBow::set_nodesize(int index, uint32_t value) {
+  _impl_.nodesize_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedBow.nodesize)
+}
+inline void SerializedBow::_internal_add_nodesize(uint32_t value) {
+  _impl_.nodesize_.Add(value);
+}
+inline void SerializedBow::add_nodesize(uint32_t value) {
+  _internal_add_nodesize(value);
+  // @@protoc_insertion_point(field_add:SerializedBow.nodesize)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::_internal_nodesize() const {
+  return _impl_.nodesize_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::nodesize() const {
+  // @@protoc_insertion_point(field_list:SerializedBow.nodesize)
+  return _internal_nodesize();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::_internal_mutable_nodesize() {
+  return &_impl_.nodesize_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::mutable_nodesize() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedBow.nodesize)
+  return _internal_mutable_nodesize();
+}
+
+// repeated uint32 nodefeature = 5;
+inline int SerializedBow::_internal_nodefeature_size() const {
+  return _impl_.nodefeature_.size();
+}
+inline int SerializedBow::nodefeature_size() const {
+  return _internal_nodefeature_size();
+}
+inline void SerializedBow::clear_nodefeature() {
+  _impl_.nodefeature_.Clear();
+}
+inline uint32_t SerializedBow::_internal_nodefeature(int index) const {
+  return _impl_.nodefeature_.Get(index);
+}
+inline uint32_t SerializedBow::nodefeature(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedBow.nodefeature)
+  return _internal_nodefeature(index);
+}
+inline void SerializedBow::set_nodefeature(int index, uint32_t value) {
+  _impl_.nodefeature_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedBow.nodefeature)
+}
+inline void SerializedBow::_internal_add_nodefeature(uint32_t value) {
+  _impl_.nodefeature_.Add(value);
+}
+inline void SerializedBow::add_nodefeature(uint32_t value) {
+  _internal_add_nodefeature(value);
+  // @@protoc_insertion_point(field_add:SerializedBow.nodefeature)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::_internal_nodefeature() const {
+  return _impl_.nodefeature_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedBow::nodefeature() const {
+  // @@protoc_insertion_point(field_list:SerializedBow.nodefeature)
+  return _internal_nodefeature();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::_internal_mutable_nodefeature() {
+  return &_impl_.nodefeature_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedBow::mutable_nodefeature() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedBow.nodefeature)
+  return _internal_mutable_nodefeature();
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKeyframeFeatures
+
+// uint32 keyframe_id = 1;
+inline void SerializedKeyframeFeatures::clear_keyframe_id() {
+  _impl_.keyframe_id_ = 0u;
+}
+inline uint32_t SerializedKeyframeFeatures::_internal_keyframe_id() const {
+  return _impl_.keyframe_id_;
+}
+inline uint32_t SerializedKeyframeFeatures::keyframe_id() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeFeatures.keyframe_id)
+  return _internal_keyframe_id();
+}
+inline void SerializedKeyframeFeatures::_internal_set_keyframe_id(uint32_t value) {
+  
+  _impl_.keyframe_id_ = value;
+}
+inline void SerializedKeyframeFeatures::set_keyframe_id(uint32_t value) {
+  _internal_set_keyframe_id(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeFeatures.keyframe_id)
+}
+
+// repeated .SerializedFeature feature = 2;
+inline int SerializedKeyframeFeatures::_internal_feature_size() const {
+  return _impl_.feature_.size();
+}
+inline int SerializedKeyframeFeatures::feature_size() const {
+  return _internal_feature_size();
+}
+inline void SerializedKeyframeFeatures::clear_feature() {
+  _impl_.feature_.Clear();
+}
+inline ::SerializedFeature* SerializedKeyframeFeatures::mutable_feature(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeatures.feature)
+  return _impl_.feature_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedFeature >*
+SerializedKeyframeFeatures::mutable_feature() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeFeatures.feature)
+  return &_impl_.feature_;
+}
+inline const ::SerializedFeature& SerializedKeyframeFeatures::_internal_feature(int index) const {
+  return _impl_.feature_.Get(index);
+}
+inline const ::SerializedFeature& SerializedKeyframeFeatures::feature(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeFeatures.feature)
+  return _internal_feature(index);
+}
+inline ::SerializedFeature* SerializedKeyframeFeatures::_internal_add_feature() {
+  return _impl_.feature_.Add();
+}
+inline ::SerializedFeature* SerializedKeyframeFeatures::add_feature() {
+  ::SerializedFeature* _add = _internal_add_feature();
+  // @@protoc_insertion_point(field_add:SerializedKeyframeFeatures.feature)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedFeature >&
+SerializedKeyframeFeatures::feature() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeFeatures.feature)
+  return _impl_.feature_;
+}
+
+// .SerializedBow bow = 3;
+inline bool SerializedKeyframeFeatures::_internal_has_bow() const {
+  return this != internal_default_instance() && _impl_.bow_ != nullptr;
+}
+inline bool SerializedKeyframeFeatures::has_bow() const {
+  return _internal_has_bow();
+}
+inline void SerializedKeyframeFeatures::clear_bow() {
+  if (GetArenaForAllocation() == nullptr && _impl_.bow_ != nullptr) {
+    delete _impl_.bow_;
+  }
+  _impl_.bow_ = nullptr;
+}
+inline const ::SerializedBow& SerializedKeyframeFeatures::_internal_bow() const {
+  const ::SerializedBow* p = _impl_.bow_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedBow&>(
+      ::_SerializedBow_default_instance_);
+}
+inline const ::SerializedBow& SerializedKeyframeFeatures::bow() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeFeatures.bow)
+  return _internal_bow();
+}
+inline void SerializedKeyframeFeatures::unsafe_arena_set_allocated_bow(
+    ::SerializedBow* bow) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bow_);
+  }
+  _impl_.bow_ = bow;
+  if (bow) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedKeyframeFeatures.bow)
+}
+inline ::SerializedBow* SerializedKeyframeFeatures::release_bow() {
+  
+  ::SerializedBow* temp = _impl_.bow_;
+  _impl_.bow_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::SerializedBow* SerializedKeyframeFeatures::unsafe_arena_release_bow() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframeFeatures.bow)
+  
+  ::SerializedBow* temp = _impl_.bow_;
+  _impl_.bow_ = nullptr;
+  return temp;
+}
+inline ::SerializedBow* SerializedKeyframeFeatures::_internal_mutable_bow() {
+  
+  if (_impl_.bow_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedBow>(GetArenaForAllocation());
+    _impl_.bow_ = p;
+  }
+  return _impl_.bow_;
+}
+inline ::SerializedBow* SerializedKeyframeFeatures::mutable_bow() {
+  ::SerializedBow* _msg = _internal_mutable_bow();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeatures.bow)
+  return _msg;
+}
+inline void SerializedKeyframeFeatures::set_allocated_bow(::SerializedBow* bow) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.bow_;
+  }
+  if (bow) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bow);
+    if (message_arena != submessage_arena) {
+      bow = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bow, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.bow_ = bow;
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframeFeatures.bow)
+}
+
+// -------------------------------------------------------------------
+
+// SerializedKeyframeColumnarFeatures
+
+// uint32 keyframe_id = 1;
+inline void SerializedKeyframeColumnarFeatures::clear_keyframe_id() {
+  _impl_.keyframe_id_ = 0u;
+}
+inline uint32_t SerializedKeyframeColumnarFeatures::_internal_keyframe_id() const {
+  return _impl_.keyframe_id_;
+}
+inline uint32_t SerializedKeyframeColumnarFeatures::keyframe_id() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.keyframe_id)
+  return _internal_keyframe_id();
+}
+inline void SerializedKeyframeColumnarFeatures::_internal_set_keyframe_id(uint32_t value) {
+  
+  _impl_.keyframe_id_ = value;
+}
+inline void SerializedKeyframeColumnarFeatures::set_keyframe_id(uint32_t value) {
+  _internal_set_keyframe_id(value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.keyframe_id)
+}
+
+// repeated float ptx = 2;
+inline int SerializedKeyframeColumnarFeatures::_internal_ptx_size() const {
+  return _impl_.ptx_.size();
+}
+inline int SerializedKeyframeColumnarFeatures::ptx_size() const {
+  return _internal_ptx_size();
+}
+inline void SerializedKeyframeColumnarFeatures::clear_ptx() {
+  _impl_.ptx_.Clear();
+}
+inline float SerializedKeyframeColumnarFeatures::_internal_ptx(int index) const {
+  return _impl_.ptx_.Get(index);
+}
+inline float SerializedKeyframeColumnarFeatures::ptx(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.ptx)
+  return _internal_ptx(index);
+}
+inline void SerializedKeyframeColumnarFeatures::set_ptx(int index, float value) {
+  _impl_.ptx_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.ptx)
 }
-inline void SerializedPose::clear_element() {
-  element_.Clear();
+inline void SerializedKeyframeColumnarFeatures::_internal_add_ptx(float value) {
+  _impl_.ptx_.Add(value);
 }
-inline float SerializedPose::element(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedPose.element)
-  return element_.Get(index);
+inline void SerializedKeyframeColumnarFeatures::add_ptx(float value) {
+  _internal_add_ptx(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.ptx)
 }
-inline void SerializedPose::set_element(int index, float value) {
-  element_.Set(index, value);
-  // @@protoc_insertion_point(field_set:SerializedPose.element)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::_internal_ptx() const {
+  return _impl_.ptx_;
 }
-inline void SerializedPose::add_element(float value) {
-  element_.Add(value);
-  // @@protoc_insertion_point(field_add:SerializedPose.element)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::ptx() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.ptx)
+  return _internal_ptx();
 }
-inline const ::google::protobuf::RepeatedField< float >&
-SerializedPose::element() const {
-  // @@protoc_insertion_point(field_list:SerializedPose.element)
-  return element_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_ptx() {
+  return &_impl_.ptx_;
 }
-inline ::google::protobuf::RepeatedField< float >*
-SerializedPose::mutable_element() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedPose.element)
-  return &element_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::mutable_ptx() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.ptx)
+  return _internal_mutable_ptx();
 }
 
-// -------------------------------------------------------------------
-
-// SerializedPosition
-
-// float x = 1;
-inline void SerializedPosition::clear_x() {
-  x_ = 0;
+// repeated float pty = 3;
+inline int SerializedKeyframeColumnarFeatures::_internal_pty_size() const {
+  return _impl_.pty_.size();
 }
-inline float SerializedPosition::x() const {
-  // @@protoc_insertion_point(field_get:SerializedPosition.x)
-  return x_;
+inline int SerializedKeyframeColumnarFeatures::pty_size() const {
+  return _internal_pty_size();
 }
-inline void SerializedPosition::set_x(float value) {
-  
-  x_ = value;
-  // @@protoc_insertion_point(field_set:SerializedPosition.x)
+inline void SerializedKeyframeColumnarFeatures::clear_pty() {
+  _impl_.pty_.Clear();
 }
-
-// float y = 2;
-inline void SerializedPosition::clear_y() {
-  y_ = 0;
+inline float SerializedKeyframeColumnarFeatures::_internal_pty(int index) const {
+  return _impl_.pty_.Get(index);
 }
-inline float SerializedPosition::y() const {
-  // @@protoc_insertion_point(field_get:SerializedPosition.y)
-  return y_;
+inline float SerializedKeyframeColumnarFeatures::pty(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.pty)
+  return _internal_pty(index);
 }
-inline void SerializedPosition::set_y(float value) {
-  
-  y_ = value;
-  // @@protoc_insertion_point(field_set:SerializedPosition.y)
+inline void SerializedKeyframeColumnarFeatures::set_pty(int index, float value) {
+  _impl_.pty_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.pty)
 }
-
-// float z = 3;
-inline void SerializedPosition::clear_z() {
-  z_ = 0;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_pty(float value) {
+  _impl_.pty_.Add(value);
 }
-inline float SerializedPosition::z() const {
-  // @@protoc_insertion_point(field_get:SerializedPosition.z)
-  return z_;
+inline void SerializedKeyframeColumnarFeatures::add_pty(float value) {
+  _internal_add_pty(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.pty)
 }
-inline void SerializedPosition::set_z(float value) {
-  
-  z_ = value;
-  // @@protoc_insertion_point(field_set:SerializedPosition.z)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::_internal_pty() const {
+  return _impl_.pty_;
 }
-
-// -------------------------------------------------------------------
-
-// SerializedKeypoint
-
-// float ptx = 1;
-inline void SerializedKeypoint::clear_ptx() {
-  ptx_ = 0;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::pty() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.pty)
+  return _internal_pty();
 }
-inline float SerializedKeypoint::ptx() const {
-  // @@protoc_insertion_point(field_get:SerializedKeypoint.ptx)
-  return ptx_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_pty() {
+  return &_impl_.pty_;
 }
-inline void SerializedKeypoint::set_ptx(float value) {
-  
-  ptx_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeypoint.ptx)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::mutable_pty() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.pty)
+  return _internal_mutable_pty();
 }
 
-// float pty = 2;
-inline void SerializedKeypoint::clear_pty() {
-  pty_ = 0;
+// repeated float angle = 4;
+inline int SerializedKeyframeColumnarFeatures::_internal_angle_size() const {
+  return _impl_.angle_.size();
 }
-inline float SerializedKeypoint::pty() const {
-  // @@protoc_insertion_point(field_get:SerializedKeypoint.pty)
-  return pty_;
+inline int SerializedKeyframeColumnarFeatures::angle_size() const {
+  return _internal_angle_size();
 }
-inline void SerializedKeypoint::set_pty(float value) {
-  
-  pty_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeypoint.pty)
+inline void SerializedKeyframeColumnarFeatures::clear_angle() {
+  _impl_.angle_.Clear();
 }
-
-// float angle = 3;
-inline void SerializedKeypoint::clear_angle() {
-  angle_ = 0;
+inline float SerializedKeyframeColumnarFeatures::_internal_angle(int index) const {
+  return _impl_.angle_.Get(index);
 }
-inline float SerializedKeypoint::angle() const {
-  // @@protoc_insertion_point(field_get:SerializedKeypoint.angle)
-  return angle_;
+inline float SerializedKeyframeColumnarFeatures::angle(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.angle)
+  return _internal_angle(index);
 }
-inline void SerializedKeypoint::set_angle(float value) {
-  
-  angle_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeypoint.angle)
+inline void SerializedKeyframeColumnarFeatures::set_angle(int index, float value) {
+  _impl_.angle_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.angle)
 }
-
-// float octave = 4;
-inline void SerializedKeypoint::clear_octave() {
-  octave_ = 0;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_angle(float value) {
+  _impl_.angle_.Add(value);
 }
-inline float SerializedKeypoint::octave() const {
-  // @@protoc_insertion_point(field_get:SerializedKeypoint.octave)
-  return octave_;
+inline void SerializedKeyframeColumnarFeatures::add_angle(float value) {
+  _internal_add_angle(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.angle)
 }
-inline void SerializedKeypoint::set_octave(float value) {
-  
-  octave_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeypoint.octave)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::_internal_angle() const {
+  return _impl_.angle_;
 }
-
-// -------------------------------------------------------------------
-
-// SerializedK
-
-// float fx = 1;
-inline void SerializedK::clear_fx() {
-  fx_ = 0;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SerializedKeyframeColumnarFeatures::angle() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.angle)
+  return _internal_angle();
 }
-inline float SerializedK::fx() const {
-  // @@protoc_insertion_point(field_get:SerializedK.fx)
-  return fx_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_angle() {
+  return &_impl_.angle_;
 }
-inline void SerializedK::set_fx(float value) {
-  
-  fx_ = value;
-  // @@protoc_insertion_point(field_set:SerializedK.fx)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SerializedKeyframeColumnarFeatures::mutable_angle() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.angle)
+  return _internal_mutable_angle();
 }
 
-// float fy = 2;
-inline void SerializedK::clear_fy() {
-  fy_ = 0;
+// repeated uint32 octave = 5;
+inline int SerializedKeyframeColumnarFeatures::_internal_octave_size() const {
+  return _impl_.octave_.size();
 }
-inline float SerializedK::fy() const {
-  // @@protoc_insertion_point(field_get:SerializedK.fy)
-  return fy_;
+inline int SerializedKeyframeColumnarFeatures::octave_size() const {
+  return _internal_octave_size();
 }
-inline void SerializedK::set_fy(float value) {
-  
-  fy_ = value;
-  // @@protoc_insertion_point(field_set:SerializedK.fy)
+inline void SerializedKeyframeColumnarFeatures::clear_octave() {
+  _impl_.octave_.Clear();
 }
-
-// float cx = 3;
-inline void SerializedK::clear_cx() {
-  cx_ = 0;
+inline uint32_t SerializedKeyframeColumnarFeatures::_internal_octave(int index) const {
+  return _impl_.octave_.Get(index);
 }
-inline float SerializedK::cx() const {
-  // @@protoc_insertion_point(field_get:SerializedK.cx)
-  return cx_;
+inline uint32_t SerializedKeyframeColumnarFeatures::octave(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.octave)
+  return _internal_octave(index);
 }
-inline void SerializedK::set_cx(float value) {
-  
-  cx_ = value;
-  // @@protoc_insertion_point(field_set:SerializedK.cx)
+inline void SerializedKeyframeColumnarFeatures::set_octave(int index, uint32_t value) {
+  _impl_.octave_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.octave)
 }
-
-// float cy = 4;
-inline void SerializedK::clear_cy() {
-  cy_ = 0;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_octave(uint32_t value) {
+  _impl_.octave_.Add(value);
 }
-inline float SerializedK::cy() const {
-  // @@protoc_insertion_point(field_get:SerializedK.cy)
-  return cy_;
+inline void SerializedKeyframeColumnarFeatures::add_octave(uint32_t value) {
+  _internal_add_octave(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.octave)
 }
-inline void SerializedK::set_cy(float value) {
-  
-  cy_ = value;
-  // @@protoc_insertion_point(field_set:SerializedK.cy)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeColumnarFeatures::_internal_octave() const {
+  return _impl_.octave_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeColumnarFeatures::octave() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.octave)
+  return _internal_octave();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_octave() {
+  return &_impl_.octave_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeColumnarFeatures::mutable_octave() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.octave)
+  return _internal_mutable_octave();
 }
 
-// -------------------------------------------------------------------
-
-// SerializedKArray
-
-// repeated .SerializedK k = 1;
-inline int SerializedKArray::k_size() const {
-  return k_.size();
+// repeated uint32 mappoint_id = 6;
+inline int SerializedKeyframeColumnarFeatures::_internal_mappoint_id_size() const {
+  return _impl_.mappoint_id_.size();
 }
-inline void SerializedKArray::clear_k() {
-  k_.Clear();
+inline int SerializedKeyframeColumnarFeatures::mappoint_id_size() const {
+  return _internal_mappoint_id_size();
 }
-inline ::SerializedK* SerializedKArray::mutable_k(int index) {
-  // @@protoc_insertion_point(field_mutable:SerializedKArray.k)
-  return k_.Mutable(index);
+inline void SerializedKeyframeColumnarFeatures::clear_mappoint_id() {
+  _impl_.mappoint_id_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::SerializedK >*
-SerializedKArray::mutable_k() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedKArray.k)
-  return &k_;
+inline uint32_t SerializedKeyframeColumnarFeatures::_internal_mappoint_id(int index) const {
+  return _impl_.mappoint_id_.Get(index);
 }
-inline const ::SerializedK& SerializedKArray::k(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedKArray.k)
-  return k_.Get(index);
+inline uint32_t SerializedKeyframeColumnarFeatures::mappoint_id(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.mappoint_id)
+  return _internal_mappoint_id(index);
 }
-inline ::SerializedK* SerializedKArray::add_k() {
-  // @@protoc_insertion_point(field_add:SerializedKArray.k)
-  return k_.Add();
+inline void SerializedKeyframeColumnarFeatures::set_mappoint_id(int index, uint32_t value) {
+  _impl_.mappoint_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.mappoint_id)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::SerializedK >&
-SerializedKArray::k() const {
-  // @@protoc_insertion_point(field_list:SerializedKArray.k)
-  return k_;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_mappoint_id(uint32_t value) {
+  _impl_.mappoint_id_.Add(value);
 }
-
-// -------------------------------------------------------------------
-
-// SerializedMappoint
-
-// uint32 id = 1;
-inline void SerializedMappoint::clear_id() {
-  id_ = 0u;
+inline void SerializedKeyframeColumnarFeatures::add_mappoint_id(uint32_t value) {
+  _internal_add_mappoint_id(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.mappoint_id)
 }
-inline ::google::protobuf::uint32 SerializedMappoint::id() const {
-  // @@protoc_insertion_point(field_get:SerializedMappoint.id)
-  return id_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeColumnarFeatures::_internal_mappoint_id() const {
+  return _impl_.mappoint_id_;
 }
-inline void SerializedMappoint::set_id(::google::protobuf::uint32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:SerializedMappoint.id)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeColumnarFeatures::mappoint_id() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.mappoint_id)
+  return _internal_mappoint_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_mappoint_id() {
+  return &_impl_.mappoint_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeColumnarFeatures::mutable_mappoint_id() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.mappoint_id)
+  return _internal_mutable_mappoint_id();
 }
 
-// .SerializedPosition position = 2;
-inline bool SerializedMappoint::has_position() const {
-  return this != internal_default_instance() && position_ != NULL;
+// bytes briefdescriptors = 7;
+inline void SerializedKeyframeColumnarFeatures::clear_briefdescriptors() {
+  _impl_.briefdescriptors_.ClearToEmpty();
 }
-inline void SerializedMappoint::clear_position() {
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
-  }
-  position_ = NULL;
+inline const std::string& SerializedKeyframeColumnarFeatures::briefdescriptors() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.briefdescriptors)
+  return _internal_briefdescriptors();
 }
-inline const ::SerializedPosition& SerializedMappoint::_internal_position() const {
-  return *position_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SerializedKeyframeColumnarFeatures::set_briefdescriptors(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.briefdescriptors_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.briefdescriptors)
 }
-inline const ::SerializedPosition& SerializedMappoint::position() const {
-  const ::SerializedPosition* p = position_;
-  // @@protoc_insertion_point(field_get:SerializedMappoint.position)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedPosition*>(
-      &::_SerializedPosition_default_instance_);
+inline std::string* SerializedKeyframeColumnarFeatures::mutable_briefdescriptors() {
+  std::string* _s = _internal_mutable_briefdescriptors();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeColumnarFeatures.briefdescriptors)
+  return _s;
 }
-inline ::SerializedPosition* SerializedMappoint::release_position() {
-  // @@protoc_insertion_point(field_release:SerializedMappoint.position)
+inline const std::string& SerializedKeyframeColumnarFeatures::_internal_briefdescriptors() const {
+  return _impl_.briefdescriptors_.Get();
+}
+inline void SerializedKeyframeColumnarFeatures::_internal_set_briefdescriptors(const std::string& value) {
   
-  ::SerializedPosition* temp = position_;
-  position_ = NULL;
-  return temp;
+  _impl_.briefdescriptors_.Set(value, GetArenaForAllocation());
 }
-inline ::SerializedPosition* SerializedMappoint::mutable_position() {
+inline std::string* SerializedKeyframeColumnarFeatures::_internal_mutable_briefdescriptors() {
   
-  if (position_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedPosition>(GetArenaNoVirtual());
-    position_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:SerializedMappoint.position)
-  return position_;
+  return _impl_.briefdescriptors_.Mutable(GetArenaForAllocation());
 }
-inline void SerializedMappoint::set_allocated_position(::SerializedPosition* position) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete position_;
-  }
-  if (position) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      position = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
-    }
+inline std::string* SerializedKeyframeColumnarFeatures::release_briefdescriptors() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframeColumnarFeatures.briefdescriptors)
+  return _impl_.briefdescriptors_.Release();
+}
+inline void SerializedKeyframeColumnarFeatures::set_allocated_briefdescriptors(std::string* briefdescriptors) {
+  if (briefdescriptors != nullptr) {
     
   } else {
     
   }
-  position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:SerializedMappoint.position)
+  _impl_.briefdescriptors_.SetAllocated(briefdescriptors, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.briefdescriptors_.IsDefault()) {
+    _impl_.briefdescriptors_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframeColumnarFeatures.briefdescriptors)
 }
 
-// float visible = 3;
-inline void SerializedMappoint::clear_visible() {
-  visible_ = 0;
-}
-inline float SerializedMappoint::visible() const {
-  // @@protoc_insertion_point(field_get:SerializedMappoint.visible)
-  return visible_;
+// repeated sint32 quantizedptx = 8;
+inline int SerializedKeyframeColumnarFeatures::_internal_quantizedptx_size() const {
+  return _impl_.quantizedptx_.size();
 }
-inline void SerializedMappoint::set_visible(float value) {
-  
-  visible_ = value;
-  // @@protoc_insertion_point(field_set:SerializedMappoint.visible)
+inline int SerializedKeyframeColumnarFeatures::quantizedptx_size() const {
+  return _internal_quantizedptx_size();
 }
-
-// float found = 4;
-inline void SerializedMappoint::clear_found() {
-  found_ = 0;
+inline void SerializedKeyframeColumnarFeatures::clear_quantizedptx() {
+  _impl_.quantizedptx_.Clear();
 }
-inline float SerializedMappoint::found() const {
-  // @@protoc_insertion_point(field_get:SerializedMappoint.found)
-  return found_;
+inline int32_t SerializedKeyframeColumnarFeatures::_internal_quantizedptx(int index) const {
+  return _impl_.quantizedptx_.Get(index);
 }
-inline void SerializedMappoint::set_found(float value) {
-  
-  found_ = value;
-  // @@protoc_insertion_point(field_set:SerializedMappoint.found)
+inline int32_t SerializedKeyframeColumnarFeatures::quantizedptx(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.quantizedptx)
+  return _internal_quantizedptx(index);
 }
-
-// .SerializedDescriptor briefdescriptor = 5;
-inline bool SerializedMappoint::has_briefdescriptor() const {
-  return this != internal_default_instance() && briefdescriptor_ != NULL;
+inline void SerializedKeyframeColumnarFeatures::set_quantizedptx(int index, int32_t value) {
+  _impl_.quantizedptx_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.quantizedptx)
 }
-inline void SerializedMappoint::clear_briefdescriptor() {
-  if (GetArenaNoVirtual() == NULL && briefdescriptor_ != NULL) {
-    delete briefdescriptor_;
-  }
-  briefdescriptor_ = NULL;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_quantizedptx(int32_t value) {
+  _impl_.quantizedptx_.Add(value);
 }
-inline const ::SerializedDescriptor& SerializedMappoint::_internal_briefdescriptor() const {
-  return *briefdescriptor_;
+inline void SerializedKeyframeColumnarFeatures::add_quantizedptx(int32_t value) {
+  _internal_add_quantizedptx(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.quantizedptx)
 }
-inline const ::SerializedDescriptor& SerializedMappoint::briefdescriptor() const {
-  const ::SerializedDescriptor* p = briefdescriptor_;
-  // @@protoc_insertion_point(field_get:SerializedMappoint.briefdescriptor)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedDescriptor*>(
-      &::_SerializedDescriptor_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedKeyframeColumnarFeatures::_internal_quantizedptx() const {
+  return _impl_.quantizedptx_;
 }
-inline ::SerializedDescriptor* SerializedMappoint::release_briefdescriptor() {
-  // @@protoc_insertion_point(field_release:SerializedMappoint.briefdescriptor)
-  
-  ::SerializedDescriptor* temp = briefdescriptor_;
-  briefdescriptor_ = NULL;
-  return temp;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedKeyframeColumnarFeatures::quantizedptx() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.quantizedptx)
+  return _internal_quantizedptx();
 }
-inline ::SerializedDescriptor* SerializedMappoint::mutable_briefdescriptor() {
-  
-  if (briefdescriptor_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedDescriptor>(GetArenaNoVirtual());
-    briefdescriptor_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:SerializedMappoint.briefdescriptor)
-  return briefdescriptor_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_quantizedptx() {
+  return &_impl_.quantizedptx_;
 }
-inline void SerializedMappoint::set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete briefdescriptor_;
-  }
-  if (briefdescriptor) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      briefdescriptor = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, briefdescriptor, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  briefdescriptor_ = briefdescriptor;
-  // @@protoc_insertion_point(field_set_allocated:SerializedMappoint.briefdescriptor)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedKeyframeColumnarFeatures::mutable_quantizedptx() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.quantizedptx)
+  return _internal_mutable_quantizedptx();
 }
 
-// -------------------------------------------------------------------
-
-// SerializedMappointArray
-
-// repeated .SerializedMappoint mappoint = 1;
-inline int SerializedMappointArray::mappoint_size() const {
-  return mappoint_.size();
+// repeated sint32 quantizedpty = 9;
+inline int SerializedKeyframeColumnarFeatures::_internal_quantizedpty_size() const {
+  return _impl_.quantizedpty_.size();
 }
-inline void SerializedMappointArray::clear_mappoint() {
-  mappoint_.Clear();
+inline int SerializedKeyframeColumnarFeatures::quantizedpty_size() const {
+  return _internal_quantizedpty_size();
 }
-inline ::SerializedMappoint* SerializedMappointArray::mutable_mappoint(int index) {
-  // @@protoc_insertion_point(field_mutable:SerializedMappointArray.mappoint)
-  return mappoint_.Mutable(index);
+inline void SerializedKeyframeColumnarFeatures::clear_quantizedpty() {
+  _impl_.quantizedpty_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::SerializedMappoint >*
-SerializedMappointArray::mutable_mappoint() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedMappointArray.mappoint)
-  return &mappoint_;
+inline int32_t SerializedKeyframeColumnarFeatures::_internal_quantizedpty(int index) const {
+  return _impl_.quantizedpty_.Get(index);
 }
-inline const ::SerializedMappoint& SerializedMappointArray::mappoint(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedMappointArray.mappoint)
-  return mappoint_.Get(index);
+inline int32_t SerializedKeyframeColumnarFeatures::quantizedpty(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.quantizedpty)
+  return _internal_quantizedpty(index);
 }
-inline ::SerializedMappoint* SerializedMappointArray::add_mappoint() {
-  // @@protoc_insertion_point(field_add:SerializedMappointArray.mappoint)
-  return mappoint_.Add();
+inline void SerializedKeyframeColumnarFeatures::set_quantizedpty(int index, int32_t value) {
+  _impl_.quantizedpty_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.quantizedpty)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::SerializedMappoint >&
-SerializedMappointArray::mappoint() const {
-  // @@protoc_insertion_point(field_list:SerializedMappointArray.mappoint)
-  return mappoint_;
+inline void SerializedKeyframeColumnarFeatures::_internal_add_quantizedpty(int32_t value) {
+  _impl_.quantizedpty_.Add(value);
 }
-
-// -------------------------------------------------------------------
-
-// SerializedKeyframe
-
-// uint32 id = 1;
-inline void SerializedKeyframe::clear_id() {
-  id_ = 0u;
+inline void SerializedKeyframeColumnarFeatures::add_quantizedpty(int32_t value) {
+  _internal_add_quantizedpty(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeColumnarFeatures.quantizedpty)
 }
-inline ::google::protobuf::uint32 SerializedKeyframe::id() const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.id)
-  return id_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedKeyframeColumnarFeatures::_internal_quantizedpty() const {
+  return _impl_.quantizedpty_;
 }
-inline void SerializedKeyframe::set_id(::google::protobuf::uint32 value) {
-  
-  id_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeyframe.id)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SerializedKeyframeColumnarFeatures::quantizedpty() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeColumnarFeatures.quantizedpty)
+  return _internal_quantizedpty();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedKeyframeColumnarFeatures::_internal_mutable_quantizedpty() {
+  return &_impl_.quantizedpty_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SerializedKeyframeColumnarFeatures::mutable_quantizedpty() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeColumnarFeatures.quantizedpty)
+  return _internal_mutable_quantizedpty();
 }
 
-// .SerializedPose pose = 2;
-inline bool SerializedKeyframe::has_pose() const {
-  return this != internal_default_instance() && pose_ != NULL;
+// bytes quantizedangle = 10;
+inline void SerializedKeyframeColumnarFeatures::clear_quantizedangle() {
+  _impl_.quantizedangle_.ClearToEmpty();
 }
-inline void SerializedKeyframe::clear_pose() {
-  if (GetArenaNoVirtual() == NULL && pose_ != NULL) {
-    delete pose_;
-  }
-  pose_ = NULL;
+inline const std::string& SerializedKeyframeColumnarFeatures::quantizedangle() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.quantizedangle)
+  return _internal_quantizedangle();
 }
-inline const ::SerializedPose& SerializedKeyframe::_internal_pose() const {
-  return *pose_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SerializedKeyframeColumnarFeatures::set_quantizedangle(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.quantizedangle_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:SerializedKeyframeColumnarFeatures.quantizedangle)
 }
-inline const ::SerializedPose& SerializedKeyframe::pose() const {
-  const ::SerializedPose* p = pose_;
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.pose)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedPose*>(
-      &::_SerializedPose_default_instance_);
+inline std::string* SerializedKeyframeColumnarFeatures::mutable_quantizedangle() {
+  std::string* _s = _internal_mutable_quantizedangle();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeColumnarFeatures.quantizedangle)
+  return _s;
 }
-inline ::SerializedPose* SerializedKeyframe::release_pose() {
-  // @@protoc_insertion_point(field_release:SerializedKeyframe.pose)
-  
-  ::SerializedPose* temp = pose_;
-  pose_ = NULL;
-  return temp;
+inline const std::string& SerializedKeyframeColumnarFeatures::_internal_quantizedangle() const {
+  return _impl_.quantizedangle_.Get();
 }
-inline ::SerializedPose* SerializedKeyframe::mutable_pose() {
+inline void SerializedKeyframeColumnarFeatures::_internal_set_quantizedangle(const std::string& value) {
   
-  if (pose_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedPose>(GetArenaNoVirtual());
-    pose_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:SerializedKeyframe.pose)
-  return pose_;
-}
-inline void SerializedKeyframe::set_allocated_pose(::SerializedPose* pose) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete pose_;
-  }
-  if (pose) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      pose = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, pose, submessage_arena);
-    }
+  _impl_.quantizedangle_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SerializedKeyframeColumnarFeatures::_internal_mutable_quantizedangle() {
+  
+  return _impl_.quantizedangle_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SerializedKeyframeColumnarFeatures::release_quantizedangle() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframeColumnarFeatures.quantizedangle)
+  return _impl_.quantizedangle_.Release();
+}
+inline void SerializedKeyframeColumnarFeatures::set_allocated_quantizedangle(std::string* quantizedangle) {
+  if (quantizedangle != nullptr) {
     
   } else {
     
   }
-  pose_ = pose;
-  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframe.pose)
+  _impl_.quantizedangle_.SetAllocated(quantizedangle, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.quantizedangle_.IsDefault()) {
+    _impl_.quantizedangle_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframeColumnarFeatures.quantizedangle)
 }
 
-// .SerializedK kmatrix = 3;
-inline bool SerializedKeyframe::has_kmatrix() const {
-  return this != internal_default_instance() && kmatrix_ != NULL;
+// .SerializedBow bow = 11;
+inline bool SerializedKeyframeColumnarFeatures::_internal_has_bow() const {
+  return this != internal_default_instance() && _impl_.bow_ != nullptr;
 }
-inline void SerializedKeyframe::clear_kmatrix() {
-  if (GetArenaNoVirtual() == NULL && kmatrix_ != NULL) {
-    delete kmatrix_;
+inline bool SerializedKeyframeColumnarFeatures::has_bow() const {
+  return _internal_has_bow();
+}
+inline void SerializedKeyframeColumnarFeatures::clear_bow() {
+  if (GetArenaForAllocation() == nullptr && _impl_.bow_ != nullptr) {
+    delete _impl_.bow_;
   }
-  kmatrix_ = NULL;
+  _impl_.bow_ = nullptr;
 }
-inline const ::SerializedK& SerializedKeyframe::_internal_kmatrix() const {
-  return *kmatrix_;
+inline const ::SerializedBow& SerializedKeyframeColumnarFeatures::_internal_bow() const {
+  const ::SerializedBow* p = _impl_.bow_;
+  return p != nullptr ? *p : reinterpret_cast<const ::SerializedBow&>(
+      ::_SerializedBow_default_instance_);
 }
-inline const ::SerializedK& SerializedKeyframe::kmatrix() const {
-  const ::SerializedK* p = kmatrix_;
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.kmatrix)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedK*>(
-      &::_SerializedK_default_instance_);
+inline const ::SerializedBow& SerializedKeyframeColumnarFeatures::bow() const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeColumnarFeatures.bow)
+  return _internal_bow();
 }
-inline ::SerializedK* SerializedKeyframe::release_kmatrix() {
-  // @@protoc_insertion_point(field_release:SerializedKeyframe.kmatrix)
+inline void SerializedKeyframeColumnarFeatures::unsafe_arena_set_allocated_bow(
+    ::SerializedBow* bow) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bow_);
+  }
+  _impl_.bow_ = bow;
+  if (bow) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SerializedKeyframeColumnarFeatures.bow)
+}
+inline ::SerializedBow* SerializedKeyframeColumnarFeatures::release_bow() {
   
-  ::SerializedK* temp = kmatrix_;
-  kmatrix_ = NULL;
+  ::SerializedBow* temp = _impl_.bow_;
+  _impl_.bow_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::SerializedK* SerializedKeyframe::mutable_kmatrix() {
+inline ::SerializedBow* SerializedKeyframeColumnarFeatures::unsafe_arena_release_bow() {
+  // @@protoc_insertion_point(field_release:SerializedKeyframeColumnarFeatures.bow)
+  
+  ::SerializedBow* temp = _impl_.bow_;
+  _impl_.bow_ = nullptr;
+  return temp;
+}
+inline ::SerializedBow* SerializedKeyframeColumnarFeatures::_internal_mutable_bow() {
   
-  if (kmatrix_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedK>(GetArenaNoVirtual());
-    kmatrix_ = p;
+  if (_impl_.bow_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SerializedBow>(GetArenaForAllocation());
+    _impl_.bow_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:SerializedKeyframe.kmatrix)
-  return kmatrix_;
+  return _impl_.bow_;
 }
-inline void SerializedKeyframe::set_allocated_kmatrix(::SerializedK* kmatrix) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete kmatrix_;
+inline ::SerializedBow* SerializedKeyframeColumnarFeatures::mutable_bow() {
+  ::SerializedBow* _msg = _internal_mutable_bow();
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeColumnarFeatures.bow)
+  return _msg;
+}
+inline void SerializedKeyframeColumnarFeatures::set_allocated_bow(::SerializedBow* bow) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.bow_;
   }
-  if (kmatrix) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (bow) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bow);
     if (message_arena != submessage_arena) {
-      kmatrix = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, kmatrix, submessage_arena);
+      bow = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bow, submessage_arena);
     }
     
   } else {
     
   }
-  kmatrix_ = kmatrix;
-  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframe.kmatrix)
+  _impl_.bow_ = bow;
+  // @@protoc_insertion_point(field_set_allocated:SerializedKeyframeColumnarFeatures.bow)
 }
 
-// uint32 kindex = 4;
-inline void SerializedKeyframe::clear_kindex() {
-  kindex_ = 0u;
+// -------------------------------------------------------------------
+
+// SerializedKeyframeFeaturesArray
+
+// repeated .SerializedKeyframeFeatures feature = 1;
+inline int SerializedKeyframeFeaturesArray::_internal_feature_size() const {
+  return _impl_.feature_.size();
 }
-inline ::google::protobuf::uint32 SerializedKeyframe::kindex() const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.kindex)
-  return kindex_;
+inline int SerializedKeyframeFeaturesArray::feature_size() const {
+  return _internal_feature_size();
 }
-inline void SerializedKeyframe::set_kindex(::google::protobuf::uint32 value) {
-  
-  kindex_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeyframe.kindex)
+inline void SerializedKeyframeFeaturesArray::clear_feature() {
+  _impl_.feature_.Clear();
 }
-
-// repeated uint32 loopedgesids = 5;
-inline int SerializedKeyframe::loopedgesids_size() const {
-  return loopedgesids_.size();
+inline ::SerializedKeyframeFeatures* SerializedKeyframeFeaturesArray::mutable_feature(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeaturesArray.feature)
+  return _impl_.feature_.Mutable(index);
 }
-inline void SerializedKeyframe::clear_loopedgesids() {
-  loopedgesids_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >*
+SerializedKeyframeFeaturesArray::mutable_feature() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeFeaturesArray.feature)
+  return &_impl_.feature_;
 }
-inline ::google::protobuf::uint32 SerializedKeyframe::loopedgesids(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.loopedgesids)
-  return loopedgesids_.Get(index);
+inline const ::SerializedKeyframeFeatures& SerializedKeyframeFeaturesArray::_internal_feature(int index) const {
+  return _impl_.feature_.Get(index);
 }
-inline void SerializedKeyframe::set_loopedgesids(int index, ::google::protobuf::uint32 value) {
-  loopedgesids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:SerializedKeyframe.loopedgesids)
+inline const ::SerializedKeyframeFeatures& SerializedKeyframeFeaturesArray::feature(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeFeaturesArray.feature)
+  return _internal_feature(index);
 }
-inline void SerializedKeyframe::add_loopedgesids(::google::protobuf::uint32 value) {
-  loopedgesids_.Add(value);
-  // @@protoc_insertion_point(field_add:SerializedKeyframe.loopedgesids)
+inline ::SerializedKeyframeFeatures* SerializedKeyframeFeaturesArray::_internal_add_feature() {
+  return _impl_.feature_.Add();
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-SerializedKeyframe::loopedgesids() const {
-  // @@protoc_insertion_point(field_list:SerializedKeyframe.loopedgesids)
-  return loopedgesids_;
+inline ::SerializedKeyframeFeatures* SerializedKeyframeFeaturesArray::add_feature() {
+  ::SerializedKeyframeFeatures* _add = _internal_add_feature();
+  // @@protoc_insertion_point(field_add:SerializedKeyframeFeaturesArray.feature)
+  return _add;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-SerializedKeyframe::mutable_loopedgesids() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframe.loopedgesids)
-  return &loopedgesids_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >&
+SerializedKeyframeFeaturesArray::feature() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeFeaturesArray.feature)
+  return _impl_.feature_;
 }
 
-// double timestamp = 6;
-inline void SerializedKeyframe::clear_timestamp() {
-  timestamp_ = 0;
+// repeated .SerializedKeyframeColumnarFeatures columnarfeature = 2;
+inline int SerializedKeyframeFeaturesArray::_internal_columnarfeature_size() const {
+  return _impl_.columnarfeature_.size();
 }
-inline double SerializedKeyframe::timestamp() const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframe.timestamp)
-  return timestamp_;
+inline int SerializedKeyframeFeaturesArray::columnarfeature_size() const {
+  return _internal_columnarfeature_size();
 }
-inline void SerializedKeyframe::set_timestamp(double value) {
-  
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeyframe.timestamp)
+inline void SerializedKeyframeFeaturesArray::clear_columnarfeature() {
+  _impl_.columnarfeature_.Clear();
+}
+inline ::SerializedKeyframeColumnarFeatures* SerializedKeyframeFeaturesArray::mutable_columnarfeature(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeaturesArray.columnarfeature)
+  return _impl_.columnarfeature_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeColumnarFeatures >*
+SerializedKeyframeFeaturesArray::mutable_columnarfeature() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeFeaturesArray.columnarfeature)
+  return &_impl_.columnarfeature_;
+}
+inline const ::SerializedKeyframeColumnarFeatures& SerializedKeyframeFeaturesArray::_internal_columnarfeature(int index) const {
+  return _impl_.columnarfeature_.Get(index);
+}
+inline const ::SerializedKeyframeColumnarFeatures& SerializedKeyframeFeaturesArray::columnarfeature(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeFeaturesArray.columnarfeature)
+  return _internal_columnarfeature(index);
+}
+inline ::SerializedKeyframeColumnarFeatures* SerializedKeyframeFeaturesArray::_internal_add_columnarfeature() {
+  return _impl_.columnarfeature_.Add();
+}
+inline ::SerializedKeyframeColumnarFeatures* SerializedKeyframeFeaturesArray::add_columnarfeature() {
+  ::SerializedKeyframeColumnarFeatures* _add = _internal_add_columnarfeature();
+  // @@protoc_insertion_point(field_add:SerializedKeyframeFeaturesArray.columnarfeature)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeColumnarFeatures >&
+SerializedKeyframeFeaturesArray::columnarfeature() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeFeaturesArray.columnarfeature)
+  return _impl_.columnarfeature_;
 }
 
 // -------------------------------------------------------------------
 
-// SerializedKeyframeArray
+// SerializedJournalEntry
 
-// repeated .SerializedKeyframe keyframe = 1;
-inline int SerializedKeyframeArray::keyframe_size() const {
-  return keyframe_.size();
+// repeated .SerializedMappoint mappoint = 1;
+inline int SerializedJournalEntry::_internal_mappoint_size() const {
+  return _impl_.mappoint_.size();
 }
-inline void SerializedKeyframeArray::clear_keyframe() {
-  keyframe_.Clear();
+inline int SerializedJournalEntry::mappoint_size() const {
+  return _internal_mappoint_size();
 }
-inline ::SerializedKeyframe* SerializedKeyframeArray::mutable_keyframe(int index) {
-  // @@protoc_insertion_point(field_mutable:SerializedKeyframeArray.keyframe)
-  return keyframe_.Mutable(index);
+inline void SerializedJournalEntry::clear_mappoint() {
+  _impl_.mappoint_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::SerializedKeyframe >*
-SerializedKeyframeArray::mutable_keyframe() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeArray.keyframe)
-  return &keyframe_;
+inline ::SerializedMappoint* SerializedJournalEntry::mutable_mappoint(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedJournalEntry.mappoint)
+  return _impl_.mappoint_.Mutable(index);
 }
-inline const ::SerializedKeyframe& SerializedKeyframeArray::keyframe(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframeArray.keyframe)
-  return keyframe_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >*
+SerializedJournalEntry::mutable_mappoint() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedJournalEntry.mappoint)
+  return &_impl_.mappoint_;
 }
-inline ::SerializedKeyframe* SerializedKeyframeArray::add_keyframe() {
-  // @@protoc_insertion_point(field_add:SerializedKeyframeArray.keyframe)
-  return keyframe_.Add();
+inline const ::SerializedMappoint& SerializedJournalEntry::_internal_mappoint(int index) const {
+  return _impl_.mappoint_.Get(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::SerializedKeyframe >&
-SerializedKeyframeArray::keyframe() const {
-  // @@protoc_insertion_point(field_list:SerializedKeyframeArray.keyframe)
-  return keyframe_;
+inline const ::SerializedMappoint& SerializedJournalEntry::mappoint(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.mappoint)
+  return _internal_mappoint(index);
+}
+inline ::SerializedMappoint* SerializedJournalEntry::_internal_add_mappoint() {
+  return _impl_.mappoint_.Add();
+}
+inline ::SerializedMappoint* SerializedJournalEntry::add_mappoint() {
+  ::SerializedMappoint* _add = _internal_add_mappoint();
+  // @@protoc_insertion_point(field_add:SerializedJournalEntry.mappoint)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedMappoint >&
+SerializedJournalEntry::mappoint() const {
+  // @@protoc_insertion_point(field_list:SerializedJournalEntry.mappoint)
+  return _impl_.mappoint_;
 }
 
-// -------------------------------------------------------------------
-
-// SerializedFeature
+// repeated .SerializedKeyframe keyframe = 2;
+inline int SerializedJournalEntry::_internal_keyframe_size() const {
+  return _impl_.keyframe_.size();
+}
+inline int SerializedJournalEntry::keyframe_size() const {
+  return _internal_keyframe_size();
+}
+inline void SerializedJournalEntry::clear_keyframe() {
+  _impl_.keyframe_.Clear();
+}
+inline ::SerializedKeyframe* SerializedJournalEntry::mutable_keyframe(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedJournalEntry.keyframe)
+  return _impl_.keyframe_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >*
+SerializedJournalEntry::mutable_keyframe() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedJournalEntry.keyframe)
+  return &_impl_.keyframe_;
+}
+inline const ::SerializedKeyframe& SerializedJournalEntry::_internal_keyframe(int index) const {
+  return _impl_.keyframe_.Get(index);
+}
+inline const ::SerializedKeyframe& SerializedJournalEntry::keyframe(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.keyframe)
+  return _internal_keyframe(index);
+}
+inline ::SerializedKeyframe* SerializedJournalEntry::_internal_add_keyframe() {
+  return _impl_.keyframe_.Add();
+}
+inline ::SerializedKeyframe* SerializedJournalEntry::add_keyframe() {
+  ::SerializedKeyframe* _add = _internal_add_keyframe();
+  // @@protoc_insertion_point(field_add:SerializedJournalEntry.keyframe)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframe >&
+SerializedJournalEntry::keyframe() const {
+  // @@protoc_insertion_point(field_list:SerializedJournalEntry.keyframe)
+  return _impl_.keyframe_;
+}
 
-// uint32 mappoint_id = 2;
-inline void SerializedFeature::clear_mappoint_id() {
-  mappoint_id_ = 0u;
+// repeated .SerializedKeyframeFeatures features = 3;
+inline int SerializedJournalEntry::_internal_features_size() const {
+  return _impl_.features_.size();
 }
-inline ::google::protobuf::uint32 SerializedFeature::mappoint_id() const {
-  // @@protoc_insertion_point(field_get:SerializedFeature.mappoint_id)
-  return mappoint_id_;
+inline int SerializedJournalEntry::features_size() const {
+  return _internal_features_size();
 }
-inline void SerializedFeature::set_mappoint_id(::google::protobuf::uint32 value) {
-  
-  mappoint_id_ = value;
-  // @@protoc_insertion_point(field_set:SerializedFeature.mappoint_id)
+inline void SerializedJournalEntry::clear_features() {
+  _impl_.features_.Clear();
+}
+inline ::SerializedKeyframeFeatures* SerializedJournalEntry::mutable_features(int index) {
+  // @@protoc_insertion_point(field_mutable:SerializedJournalEntry.features)
+  return _impl_.features_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >*
+SerializedJournalEntry::mutable_features() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedJournalEntry.features)
+  return &_impl_.features_;
+}
+inline const ::SerializedKeyframeFeatures& SerializedJournalEntry::_internal_features(int index) const {
+  return _impl_.features_.Get(index);
+}
+inline const ::SerializedKeyframeFeatures& SerializedJournalEntry::features(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.features)
+  return _internal_features(index);
+}
+inline ::SerializedKeyframeFeatures* SerializedJournalEntry::_internal_add_features() {
+  return _impl_.features_.Add();
+}
+inline ::SerializedKeyframeFeatures* SerializedJournalEntry::add_features() {
+  ::SerializedKeyframeFeatures* _add = _internal_add_features();
+  // @@protoc_insertion_point(field_add:SerializedJournalEntry.features)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SerializedKeyframeFeatures >&
+SerializedJournalEntry::features() const {
+  // @@protoc_insertion_point(field_list:SerializedJournalEntry.features)
+  return _impl_.features_;
 }
 
-// .SerializedKeypoint keypoint = 3;
-inline bool SerializedFeature::has_keypoint() const {
-  return this != internal_default_instance() && keypoint_ != NULL;
+// repeated uint32 erasedmappointsids = 4;
+inline int SerializedJournalEntry::_internal_erasedmappointsids_size() const {
+  return _impl_.erasedmappointsids_.size();
 }
-inline void SerializedFeature::clear_keypoint() {
-  if (GetArenaNoVirtual() == NULL && keypoint_ != NULL) {
-    delete keypoint_;
-  }
-  keypoint_ = NULL;
+inline int SerializedJournalEntry::erasedmappointsids_size() const {
+  return _internal_erasedmappointsids_size();
 }
-inline const ::SerializedKeypoint& SerializedFeature::_internal_keypoint() const {
-  return *keypoint_;
+inline void SerializedJournalEntry::clear_erasedmappointsids() {
+  _impl_.erasedmappointsids_.Clear();
 }
-inline const ::SerializedKeypoint& SerializedFeature::keypoint() const {
-  const ::SerializedKeypoint* p = keypoint_;
-  // @@protoc_insertion_point(field_get:SerializedFeature.keypoint)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedKeypoint*>(
-      &::_SerializedKeypoint_default_instance_);
+inline uint32_t SerializedJournalEntry::_internal_erasedmappointsids(int index) const {
+  return _impl_.erasedmappointsids_.Get(index);
 }
-inline ::SerializedKeypoint* SerializedFeature::release_keypoint() {
-  // @@protoc_insertion_point(field_release:SerializedFeature.keypoint)
-  
-  ::SerializedKeypoint* temp = keypoint_;
-  keypoint_ = NULL;
-  return temp;
+inline uint32_t SerializedJournalEntry::erasedmappointsids(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.erasedmappointsids)
+  return _internal_erasedmappointsids(index);
 }
-inline ::SerializedKeypoint* SerializedFeature::mutable_keypoint() {
-  
-  if (keypoint_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedKeypoint>(GetArenaNoVirtual());
-    keypoint_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:SerializedFeature.keypoint)
-  return keypoint_;
+inline void SerializedJournalEntry::set_erasedmappointsids(int index, uint32_t value) {
+  _impl_.erasedmappointsids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedJournalEntry.erasedmappointsids)
 }
-inline void SerializedFeature::set_allocated_keypoint(::SerializedKeypoint* keypoint) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete keypoint_;
-  }
-  if (keypoint) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      keypoint = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, keypoint, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  keypoint_ = keypoint;
-  // @@protoc_insertion_point(field_set_allocated:SerializedFeature.keypoint)
+inline void SerializedJournalEntry::_internal_add_erasedmappointsids(uint32_t value) {
+  _impl_.erasedmappointsids_.Add(value);
+}
+inline void SerializedJournalEntry::add_erasedmappointsids(uint32_t value) {
+  _internal_add_erasedmappointsids(value);
+  // @@protoc_insertion_point(field_add:SerializedJournalEntry.erasedmappointsids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedJournalEntry::_internal_erasedmappointsids() const {
+  return _impl_.erasedmappointsids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedJournalEntry::erasedmappointsids() const {
+  // @@protoc_insertion_point(field_list:SerializedJournalEntry.erasedmappointsids)
+  return _internal_erasedmappointsids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedJournalEntry::_internal_mutable_erasedmappointsids() {
+  return &_impl_.erasedmappointsids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedJournalEntry::mutable_erasedmappointsids() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedJournalEntry.erasedmappointsids)
+  return _internal_mutable_erasedmappointsids();
 }
 
-// .SerializedDescriptor briefdescriptor = 4;
-inline bool SerializedFeature::has_briefdescriptor() const {
-  return this != internal_default_instance() && briefdescriptor_ != NULL;
+// repeated uint32 erasedkeyframesids = 5;
+inline int SerializedJournalEntry::_internal_erasedkeyframesids_size() const {
+  return _impl_.erasedkeyframesids_.size();
 }
-inline void SerializedFeature::clear_briefdescriptor() {
-  if (GetArenaNoVirtual() == NULL && briefdescriptor_ != NULL) {
-    delete briefdescriptor_;
-  }
-  briefdescriptor_ = NULL;
+inline int SerializedJournalEntry::erasedkeyframesids_size() const {
+  return _internal_erasedkeyframesids_size();
 }
-inline const ::SerializedDescriptor& SerializedFeature::_internal_briefdescriptor() const {
-  return *briefdescriptor_;
+inline void SerializedJournalEntry::clear_erasedkeyframesids() {
+  _impl_.erasedkeyframesids_.Clear();
 }
-inline const ::SerializedDescriptor& SerializedFeature::briefdescriptor() const {
-  const ::SerializedDescriptor* p = briefdescriptor_;
-  // @@protoc_insertion_point(field_get:SerializedFeature.briefdescriptor)
-  return p != NULL ? *p : *reinterpret_cast<const ::SerializedDescriptor*>(
-      &::_SerializedDescriptor_default_instance_);
+inline uint32_t SerializedJournalEntry::_internal_erasedkeyframesids(int index) const {
+  return _impl_.erasedkeyframesids_.Get(index);
 }
-inline ::SerializedDescriptor* SerializedFeature::release_briefdescriptor() {
-  // @@protoc_insertion_point(field_release:SerializedFeature.briefdescriptor)
+inline uint32_t SerializedJournalEntry::erasedkeyframesids(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.erasedkeyframesids)
+  return _internal_erasedkeyframesids(index);
+}
+inline void SerializedJournalEntry::set_erasedkeyframesids(int index, uint32_t value) {
+  _impl_.erasedkeyframesids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedJournalEntry.erasedkeyframesids)
+}
+inline void SerializedJournalEntry::_internal_add_erasedkeyframesids(uint32_t value) {
+  _impl_.erasedkeyframesids_.Add(value);
+}
+inline void SerializedJournalEntry::add_erasedkeyframesids(uint32_t value) {
+  _internal_add_erasedkeyframesids(value);
+  // @@protoc_insertion_point(field_add:SerializedJournalEntry.erasedkeyframesids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedJournalEntry::_internal_erasedkeyframesids() const {
+  return _impl_.erasedkeyframesids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedJournalEntry::erasedkeyframesids() const {
+  // @@protoc_insertion_point(field_list:SerializedJournalEntry.erasedkeyframesids)
+  return _internal_erasedkeyframesids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedJournalEntry::_internal_mutable_erasedkeyframesids() {
+  return &_impl_.erasedkeyframesids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedJournalEntry::mutable_erasedkeyframesids() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedJournalEntry.erasedkeyframesids)
+  return _internal_mutable_erasedkeyframesids();
+}
+
+// uint32 mappointwatermark = 6;
+inline void SerializedJournalEntry::clear_mappointwatermark() {
+  _impl_.mappointwatermark_ = 0u;
+}
+inline uint32_t SerializedJournalEntry::_internal_mappointwatermark() const {
+  return _impl_.mappointwatermark_;
+}
+inline uint32_t SerializedJournalEntry::mappointwatermark() const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.mappointwatermark)
+  return _internal_mappointwatermark();
+}
+inline void SerializedJournalEntry::_internal_set_mappointwatermark(uint32_t value) {
   
-  ::SerializedDescriptor* temp = briefdescriptor_;
-  briefdescriptor_ = NULL;
-  return temp;
+  _impl_.mappointwatermark_ = value;
 }
-inline ::SerializedDescriptor* SerializedFeature::mutable_briefdescriptor() {
+inline void SerializedJournalEntry::set_mappointwatermark(uint32_t value) {
+  _internal_set_mappointwatermark(value);
+  // @@protoc_insertion_point(field_set:SerializedJournalEntry.mappointwatermark)
+}
+
+// uint32 keyframewatermark = 7;
+inline void SerializedJournalEntry::clear_keyframewatermark() {
+  _impl_.keyframewatermark_ = 0u;
+}
+inline uint32_t SerializedJournalEntry::_internal_keyframewatermark() const {
+  return _impl_.keyframewatermark_;
+}
+inline uint32_t SerializedJournalEntry::keyframewatermark() const {
+  // @@protoc_insertion_point(field_get:SerializedJournalEntry.keyframewatermark)
+  return _internal_keyframewatermark();
+}
+inline void SerializedJournalEntry::_internal_set_keyframewatermark(uint32_t value) {
   
-  if (briefdescriptor_ == NULL) {
-    auto* p = CreateMaybeMessage<::SerializedDescriptor>(GetArenaNoVirtual());
-    briefdescriptor_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:SerializedFeature.briefdescriptor)
-  return briefdescriptor_;
+  _impl_.keyframewatermark_ = value;
 }
-inline void SerializedFeature::set_allocated_briefdescriptor(::SerializedDescriptor* briefdescriptor) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete briefdescriptor_;
-  }
-  if (briefdescriptor) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      briefdescriptor = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, briefdescriptor, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  briefdescriptor_ = briefdescriptor;
-  // @@protoc_insertion_point(field_set_allocated:SerializedFeature.briefdescriptor)
+inline void SerializedJournalEntry::set_keyframewatermark(uint32_t value) {
+  _internal_set_keyframewatermark(value);
+  // @@protoc_insertion_point(field_set:SerializedJournalEntry.keyframewatermark)
 }
 
 // -------------------------------------------------------------------
 
-// SerializedKeyframeFeatures
+// SerializedKeyframeDatabase
 
-// uint32 keyframe_id = 1;
-inline void SerializedKeyframeFeatures::clear_keyframe_id() {
-  keyframe_id_ = 0u;
+// repeated uint32 worddelta = 1;
+inline int SerializedKeyframeDatabase::_internal_worddelta_size() const {
+  return _impl_.worddelta_.size();
 }
-inline ::google::protobuf::uint32 SerializedKeyframeFeatures::keyframe_id() const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframeFeatures.keyframe_id)
-  return keyframe_id_;
+inline int SerializedKeyframeDatabase::worddelta_size() const {
+  return _internal_worddelta_size();
 }
-inline void SerializedKeyframeFeatures::set_keyframe_id(::google::protobuf::uint32 value) {
-  
-  keyframe_id_ = value;
-  // @@protoc_insertion_point(field_set:SerializedKeyframeFeatures.keyframe_id)
+inline void SerializedKeyframeDatabase::clear_worddelta() {
+  _impl_.worddelta_.Clear();
 }
-
-// repeated .SerializedFeature feature = 2;
-inline int SerializedKeyframeFeatures::feature_size() const {
-  return feature_.size();
+inline uint32_t SerializedKeyframeDatabase::_internal_worddelta(int index) const {
+  return _impl_.worddelta_.Get(index);
 }
-inline void SerializedKeyframeFeatures::clear_feature() {
-  feature_.Clear();
+inline uint32_t SerializedKeyframeDatabase::worddelta(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeDatabase.worddelta)
+  return _internal_worddelta(index);
 }
-inline ::SerializedFeature* SerializedKeyframeFeatures::mutable_feature(int index) {
-  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeatures.feature)
-  return feature_.Mutable(index);
+inline void SerializedKeyframeDatabase::set_worddelta(int index, uint32_t value) {
+  _impl_.worddelta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeDatabase.worddelta)
 }
-inline ::google::protobuf::RepeatedPtrField< ::SerializedFeature >*
-SerializedKeyframeFeatures::mutable_feature() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeFeatures.feature)
-  return &feature_;
+inline void SerializedKeyframeDatabase::_internal_add_worddelta(uint32_t value) {
+  _impl_.worddelta_.Add(value);
 }
-inline const ::SerializedFeature& SerializedKeyframeFeatures::feature(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframeFeatures.feature)
-  return feature_.Get(index);
+inline void SerializedKeyframeDatabase::add_worddelta(uint32_t value) {
+  _internal_add_worddelta(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeDatabase.worddelta)
 }
-inline ::SerializedFeature* SerializedKeyframeFeatures::add_feature() {
-  // @@protoc_insertion_point(field_add:SerializedKeyframeFeatures.feature)
-  return feature_.Add();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::_internal_worddelta() const {
+  return _impl_.worddelta_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::SerializedFeature >&
-SerializedKeyframeFeatures::feature() const {
-  // @@protoc_insertion_point(field_list:SerializedKeyframeFeatures.feature)
-  return feature_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::worddelta() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeDatabase.worddelta)
+  return _internal_worddelta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::_internal_mutable_worddelta() {
+  return &_impl_.worddelta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::mutable_worddelta() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeDatabase.worddelta)
+  return _internal_mutable_worddelta();
 }
 
-// -------------------------------------------------------------------
-
-// SerializedKeyframeFeaturesArray
+// repeated uint32 nkeyframes = 2;
+inline int SerializedKeyframeDatabase::_internal_nkeyframes_size() const {
+  return _impl_.nkeyframes_.size();
+}
+inline int SerializedKeyframeDatabase::nkeyframes_size() const {
+  return _internal_nkeyframes_size();
+}
+inline void SerializedKeyframeDatabase::clear_nkeyframes() {
+  _impl_.nkeyframes_.Clear();
+}
+inline uint32_t SerializedKeyframeDatabase::_internal_nkeyframes(int index) const {
+  return _impl_.nkeyframes_.Get(index);
+}
+inline uint32_t SerializedKeyframeDatabase::nkeyframes(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeDatabase.nkeyframes)
+  return _internal_nkeyframes(index);
+}
+inline void SerializedKeyframeDatabase::set_nkeyframes(int index, uint32_t value) {
+  _impl_.nkeyframes_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeDatabase.nkeyframes)
+}
+inline void SerializedKeyframeDatabase::_internal_add_nkeyframes(uint32_t value) {
+  _impl_.nkeyframes_.Add(value);
+}
+inline void SerializedKeyframeDatabase::add_nkeyframes(uint32_t value) {
+  _internal_add_nkeyframes(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeDatabase.nkeyframes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::_internal_nkeyframes() const {
+  return _impl_.nkeyframes_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::nkeyframes() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeDatabase.nkeyframes)
+  return _internal_nkeyframes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::_internal_mutable_nkeyframes() {
+  return &_impl_.nkeyframes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::mutable_nkeyframes() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeDatabase.nkeyframes)
+  return _internal_mutable_nkeyframes();
+}
 
-// repeated .SerializedKeyframeFeatures feature = 1;
-inline int SerializedKeyframeFeaturesArray::feature_size() const {
-  return feature_.size();
+// repeated uint32 keyframedelta = 3;
+inline int SerializedKeyframeDatabase::_internal_keyframedelta_size() const {
+  return _impl_.keyframedelta_.size();
 }
-inline void SerializedKeyframeFeaturesArray::clear_feature() {
-  feature_.Clear();
+inline int SerializedKeyframeDatabase::keyframedelta_size() const {
+  return _internal_keyframedelta_size();
 }
-inline ::SerializedKeyframeFeatures* SerializedKeyframeFeaturesArray::mutable_feature(int index) {
-  // @@protoc_insertion_point(field_mutable:SerializedKeyframeFeaturesArray.feature)
-  return feature_.Mutable(index);
+inline void SerializedKeyframeDatabase::clear_keyframedelta() {
+  _impl_.keyframedelta_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::SerializedKeyframeFeatures >*
-SerializedKeyframeFeaturesArray::mutable_feature() {
-  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeFeaturesArray.feature)
-  return &feature_;
+inline uint32_t SerializedKeyframeDatabase::_internal_keyframedelta(int index) const {
+  return _impl_.keyframedelta_.Get(index);
 }
-inline const ::SerializedKeyframeFeatures& SerializedKeyframeFeaturesArray::feature(int index) const {
-  // @@protoc_insertion_point(field_get:SerializedKeyframeFeaturesArray.feature)
-  return feature_.Get(index);
+inline uint32_t SerializedKeyframeDatabase::keyframedelta(int index) const {
+  // @@protoc_insertion_point(field_get:SerializedKeyframeDatabase.keyframedelta)
+  return _internal_keyframedelta(index);
 }
-inline ::SerializedKeyframeFeatures* SerializedKeyframeFeaturesArray::add_feature() {
-  // @@protoc_insertion_point(field_add:SerializedKeyframeFeaturesArray.feature)
-  return feature_.Add();
+inline void SerializedKeyframeDatabase::set_keyframedelta(int index, uint32_t value) {
+  _impl_.keyframedelta_.Set(index, value);
+  // @@protoc_insertion_point(field_set:SerializedKeyframeDatabase.keyframedelta)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::SerializedKeyframeFeatures >&
-SerializedKeyframeFeaturesArray::feature() const {
-  // @@protoc_insertion_point(field_list:SerializedKeyframeFeaturesArray.feature)
-  return feature_;
+inline void SerializedKeyframeDatabase::_internal_add_keyframedelta(uint32_t value) {
+  _impl_.keyframedelta_.Add(value);
+}
+inline void SerializedKeyframeDatabase::add_keyframedelta(uint32_t value) {
+  _internal_add_keyframedelta(value);
+  // @@protoc_insertion_point(field_add:SerializedKeyframeDatabase.keyframedelta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::_internal_keyframedelta() const {
+  return _impl_.keyframedelta_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SerializedKeyframeDatabase::keyframedelta() const {
+  // @@protoc_insertion_point(field_list:SerializedKeyframeDatabase.keyframedelta)
+  return _internal_keyframedelta();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::_internal_mutable_keyframedelta() {
+  return &_impl_.keyframedelta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SerializedKeyframeDatabase::mutable_keyframedelta() {
+  // @@protoc_insertion_point(field_mutable_list:SerializedKeyframeDatabase.keyframedelta)
+  return _internal_mutable_keyframedelta();
 }
 
 #ifdef __GNUC__
@@ -2584,10 +7061,19 @@ SerializedKeyframeFeaturesArray::feature() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_osmap_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_osmap_2eproto
@@ -20,13 +20,49 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <assert.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <future>
+#include <chrono>
+#include <ctime>
+#include <tuple>
+#include <unordered_set>
+#include <list>
+#include <deque>
 #include <opencv2/core/core.hpp>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/coded_stream.h>
 
 #include "Osmap.h"
 
+#ifndef OSMAP_DUMMY_MAP
+#include "Converter.h"
+#endif
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif defined __ARM_NEON
+#include <arm_neon.h>
+#endif
+#ifdef OSMAP_LZ4
+#include <lz4.h>
+#endif
+#ifdef OSMAP_ZSTD
+#include <zstd.h>
+#endif
+
 // Option check macro
 #define OPTION(OP) if(options[OP]) headerFile << #OP;
 
@@ -38,6 +74,24 @@ using namespace cv;
 
 namespace ORB_SLAM2{
 
+/*
+ * Section names in statistics' phases, by SectionTypes.
+ */
+static const char *sectionNames[] = {"", "header", "mappoints", "keyframes", "features", "database"};
+
+// Phases end in any thread saving or loading, and progress calls are serialized
+static mutex statsMutex;
+
+// Adds a run since start to a phase, accumulated apart from stats until phaseAdd
+static void phaseRun(OsmapPhase &phase, const OsmapClock &start, uint64_t objects = 0, uint64_t bytes = 0){
+	OsmapClock end;
+	phase.wallTime += end.wallTime - start.wallTime;
+	phase.cpuTime += end.cpuTime - start.cpuTime;
+	phase.objects += objects;
+	phase.bytes += bytes;
+	phase.runs++;
+}
+
 Osmap::Osmap(System &_system):
 	map(static_cast<OsmapMap&>(*_system.mpMap)),
 	keyFrameDatabase(*_system.mpKeyFrameDatabase),
@@ -66,13 +120,28 @@ Osmap::Osmap(System &_system):
 
 
 void Osmap::mapSave(const string givenFilename, bool pauseThreads){
+	stats = OsmapStats();
+	OsmapClock callStart;
+
+	// Common ending, also when the map can't be saved: releases temporary vectors and resumes threads
+	auto finish = [&](){
+		clearVectors();
+		if(pauseThreads)
+		  system.mpViewer->Release();
+		statsEnd(callStart);
+	};
+
 	// Stop threads
 	if(pauseThreads){
 		system.mpLocalMapper->RequestStop();
 		while(!system.mpLocalMapper->isStopped()) usleep(1000);
 	}
 
-	// Strip out .yaml if present
+	// Paged out features are needed to save them
+	if(pageFileDescriptor >= 0)
+		pageInAll();
+
+	// Strip out .yaml or .osmap if present
 	string baseFilename, filename, pathDirectory;
 	parsePath(givenFilename, &filename, &pathDirectory);
 	if(pathDirectory != "")
@@ -80,68 +149,257 @@ void Osmap::mapSave(const string givenFilename, bool pauseThreads){
 
 	int length = filename.length();
 	if(length>5 && filename.substr(length-5) == ".yaml")
-	  baseFilename = filename.substr(length-5);
+	  baseFilename = filename.substr(0, length-5);
+	else if(length>6 && filename.substr(length-6) == ".osmap")
+	  baseFilename = filename.substr(0, length-6);
 	else
 	  baseFilename = filename;
 
 	// Map depuration
-	if(!options[NO_DEPURATION])
+	if(!options[NO_DEPURATION]){
+		OsmapClock start;
 		depurate();
+		phaseEnd("depurate", start);
+	}
+
+	// Tiles need explicit ids, and poses independent from other tiles'
+	if(options[TILED] && (options[DENSE_IDS] || options[POSE_DELTAS])){
+		cerr << "TILED option is not compatible with DENSE_IDS nor POSE_DELTAS, saving without tiles." << endl;
+		options.reset(TILED);
+	}
+	bool tiled = options[TILED];
+
+	// Keyframe database refers to saved keyframes, all of them loaded, and to the vocabulary's words
+	if(options[KEYFRAME_DATABASE] && (tiled || options[NO_KEYFRAMES_FILE])){
+		cerr << "KEYFRAME_DATABASE option is not compatible with TILED nor NO_KEYFRAMES_FILE, saving without keyframe database." << endl;
+		options.reset(KEYFRAME_DATABASE);
+	}
+
+	// Bag of words and keyframe database need the vocabulary, fingerprinted once: it hashes every word
+	uint64_t fingerprint = (options[BOW] && !options[NO_FEATURES_FILE]) || options[KEYFRAME_DATABASE]? vocabularyFingerprint() : 0;
+	if(options[KEYFRAME_DATABASE] && !fingerprint){
+		cerr << "KEYFRAME_DATABASE option without vocabulary, saving without keyframe database." << endl;
+		options.reset(KEYFRAME_DATABASE);
+	}
+	if(options[BOW] && !options[NO_FEATURES_FILE] && !fingerprint){
+		cerr << "BOW option without vocabulary, saving without bag of words." << endl;
+		options.reset(BOW);
+	}
 
+	// Journal: changes since the last save are appended to the journal of this map, until it is time to save it whole again
+	bool journal = options[JOURNAL];
+	if(journal && options[DENSE_IDS]){
+		cerr << "JOURNAL option is not compatible with DENSE_IDS, saving without journal." << endl;
+		journal = false;
+	}
+	if(journal && tiled){
+		cerr << "JOURNAL option is not compatible with TILED, saving without journal." << endl;
+		journal = false;
+	}
+	if(journal && journalFilename == baseFilename + ".journal" && journalEntries < journalCompaction){
+		if(!options[NO_MAPPOINTS_FILE]) getMapPointsFromMap();
+		if(!options[NO_KEYFRAMES_FILE] || !options[NO_FEATURES_FILE]) getKeyFramesFromMap();
+		cout << "Saving " << journalFilename << endl;
+		struct stat journalStat;
+		off_t journalSize = stat(journalFilename.c_str(), &journalStat)? 0 : journalStat.st_size;
+		OsmapClock start;
+		journalSave(journalFilename);
+		if(!stat(journalFilename.c_str(), &journalStat))
+			stats.bytes = journalStat.st_size - journalSize;
+		phaseEnd("journal save", start, 0, stats.bytes);
+		finish();
+		return;
+	}
 
 	// Actual saving
-	filename = baseFilename + ".yaml";
+	bool singleFile = options[SINGLE_FILE];
+	filename = baseFilename + (singleFile? ".osmap" : ".yaml");
 
-	// Open YAML file for write, it will be the last file to close.
+	// Open YAML file for write, it will be the last file to close.  In a single file container it is written in memory, and then as the last section.
 	// FileStorage https://docs.opencv.org/3.1.0/da/d56/classcv_1_1FileStorage.html
-	FileStorage headerFile(filename, FileStorage::WRITE);
+	FileStorage headerFile(singleFile? ".yaml" : filename, singleFile? FileStorage::WRITE | FileStorage::MEMORY : FileStorage::WRITE);
 	if(!headerFile.isOpened()){
 	// Is this necessary?
 	 cerr << "Couldn't create file " << baseFilename << ".yaml, map not saved." << endl;
+	 finish();
 	 return;
 	}
 
-	// MapPoints
-	if(!options[NO_MAPPOINTS_FILE]){
-	  // Order mappoints by mnId
-	  getMapPointsFromMap();
-
-	  // New file
-	  filename = baseFilename + ".mappoints";
+	// Compression
+	if(!codecAvailable(codec)){
+		cerr << "Codec " << codec << " not available in this build, saving without compression." << endl;
+		codec = NO_CODEC;
+	}
 
-	  // Serialize
-	  cout << "Saving " << filename << endl;
-	  headerFile << "mappointsFile" << filename;
-	  headerFile << "nMappoints" << MapPointsSave(filename);
+	// Single file container, with a placeholder section table to be rewritten when sections are done.
+	ofstream container;
+	vector<OsmapSection> sectionTable;
+	if(singleFile){
+		container.open(filename, ofstream::binary);
+		if(!container){
+			cerr << "Couldn't create file " << filename << ", map not saved." << endl;
+			finish();
+			return;
+		}
+		writeContainerHeader(container, vector<OsmapSection>(1 + !options[NO_MAPPOINTS_FILE] + !options[NO_KEYFRAMES_FILE] + !options[NO_FEATURES_FILE] + options[KEYFRAME_DATABASE]));
 	}
 
+	/*
+	 * Sections are serialized and written by MapPointsSave, KeyFramesSave, featuresSave and keyFrameDatabaseSave, or tile by tile by tilesSave.
+	 * They read disjoint data and write different files, so they run concurrently if threads property is not 1.
+	 * Otherwise they are deferred, and run one after another when their results are written to the header.
+	 * Shared data is prepared before: ordered vectors, K matrices and features file form.
+	 * In a single file container sections are always deferred, as they are written one after another to the same file.
+	 */
+	launch policy = getThreads() == 1? launch::deferred : launch::async;
+	string mappointsFilename = baseFilename + ".mappoints", keyframesFilename = baseFilename + ".keyframes", featuresFilename = baseFilename + ".features";
+	string databaseFilename = baseFilename + ".database";
+	future<int> nMappoints, nKeyframes, nFeatures, nDatabaseWords;
+	auto saveSection = [&](SectionTypes type, string sectionFilename, function<int(ostream&)> save) -> future<int>{
+		// With a codec the section is serialized in memory, and then compressed.  Tiled sections compress each tile on their own.
+		string name = sectionNames[type];
+		function<int(ostream&)> saveCompressed = [this, save, tiled, name](ostream &file){
+			if(codec == NO_CODEC || tiled)
+				return save(file);
+			ostringstream raw;
+			int n = save(raw);
+			OsmapClock start;
+			streampos begin = file.tellp();
+			if(!compress(raw.str(), file))
+				n = -1;
+			phaseEnd(name + " compress", start, 0, (uint64_t)(file.tellp() - begin));
+			return n;
+		};
+		if(singleFile)
+			return async(launch::deferred, [this, type, tiled, saveCompressed, name, &container, &sectionTable]{
+				OsmapClock start;
+				OsmapSection section = {(uint32_t)type, (uint32_t)(tiled? NO_CODEC : codec), (uint64_t)container.tellp(), 0};
+				int n = saveCompressed(container);
+				section.length = (uint64_t)container.tellp() - section.offset;
+				sectionTable.push_back(section);
+				phaseEnd(name + " save", start, max(n, 0), section.length);
+				return n;
+			});
+		return async(policy, [this, sectionFilename, saveCompressed, name]{
+			OsmapClock start;
+			ofstream file(sectionFilename, ofstream::binary);
+			int n = saveCompressed(file);
+			phaseEnd(name + " save", start, max(n, 0), (uint64_t)file.tellp());
+			return n;
+		});
+	};
+
+	// Bounding box, quantized positions are relative to it
+	if(options[QUANTIZED]) getBoundingBox();
+
+	/*
+	 * Shared data, prepared before any section starts, as sections read it concurrently: ordered vectors, tiles, K matrices and options.
+	 * Keyframes are ordered by mnId before mappoints, which refer to their reference keyframes with NORMAL_AND_DEPTH.
+	 */
+	if(tiled || options[NORMAL_AND_DEPTH] || !options[NO_KEYFRAMES_FILE]) getKeyFramesFromMap();
+	if(tiled || !options[NO_MAPPOINTS_FILE]) getMapPointsFromMap();
+
 	// K: grab camera calibration matrices.  Will be saved to yaml file later.
 	if(!options[K_IN_KEYFRAME]) getVectorKFromKeyframes();
 
-	// KeyFrames
-	if(!options[NO_KEYFRAMES_FILE]){
-	  getKeyFramesFromMap();
+	// Tiles, both vectors are partitioned before saving any section.  Tiles' features are delimited.
+	if(tiled){
+	  getTiles();
+	  options.reset(FEATURES_FILE_NOT_DELIMITED);
+	  options.set(FEATURES_FILE_DELIMITED);
+	}
 
-	  // New file
-	  filename = baseFilename + ".keyframes";
+	// Features file form, the last change to options
+	if(!options[NO_FEATURES_FILE]) chooseFeaturesFileForm();
 
-	  // Serialize
-	  cout << "Saving " << filename << endl;
-	  headerFile << "keyframesFile" << filename;
-	  headerFile << "nKeyframes" << KeyFramesSave(filename);
+	// MapPoints
+	if(!options[NO_MAPPOINTS_FILE]){
+	  cout << "Saving " << mappointsFilename << endl;
+	  nMappoints = saveSection(MAPPOINTS_SECTION, mappointsFilename, [this, tiled](ostream &file){
+		  return tiled? tilesSave(file, MAPPOINTS_SECTION) : MapPointsSave(file);
+	  });
+	}
+
+	// KeyFrames
+	if(!options[NO_KEYFRAMES_FILE]){
+	  cout << "Saving " << keyframesFilename << endl;
+	  nKeyframes = saveSection(KEYFRAMES_SECTION, keyframesFilename, [this, tiled](ostream &file){
+		  return tiled? tilesSave(file, KEYFRAMES_SECTION) : KeyFramesSave(file);
+	  });
 	}
 
 	// Features
 	if(!options[NO_FEATURES_FILE]){
-	  filename = baseFilename + ".features";
-	  cout << "Saving " << filename << endl;
-	  headerFile << "featuresFile" << filename;
-	  headerFile << "nFeatures" << featuresSave(filename);
+	  cout << "Saving " << featuresFilename << endl;
+	  nFeatures = saveSection(FEATURES_SECTION, featuresFilename, [this, tiled](ostream &file){
+		  return tiled? tilesSave(file, FEATURES_SECTION) : featuresSave(file);
+	  });
+	}
+
+	// Keyframe database
+	if(options[KEYFRAME_DATABASE]){
+	  cout << "Saving " << databaseFilename << endl;
+	  nDatabaseWords = saveSection(DATABASE_SECTION, databaseFilename, [this](ostream &file){
+		  return keyFrameDatabaseSave(file);
+	  });
 	}
 
+	// Header, written when every section is done.  Files' names are not needed in a single file container.
+	if(nMappoints.valid()){
+	  if(!singleFile) headerFile << "mappointsFile" << mappointsFilename;
+	  headerFile << "nMappoints" << nMappoints.get();
+	}
+	if(nKeyframes.valid()){
+	  if(!singleFile) headerFile << "keyframesFile" << keyframesFilename;
+	  headerFile << "nKeyframes" << nKeyframes.get();
+	}
+	if(nFeatures.valid()){
+	  if(!singleFile) headerFile << "featuresFile" << featuresFilename;
+	  headerFile << "nFeatures" << nFeatures.get();
+	}
+	if(nDatabaseWords.valid()){
+	  if(!singleFile) headerFile << "databaseFile" << databaseFilename;
+	  headerFile << "nDatabaseWords" << nDatabaseWords.get();
+	}
+
+	// Tile index, with tiles' lengths in each section, as decimal strings to keep 64 bits.  Tiles are one after another, so offsets follow from lengths.
+	if(tiled){
+	  headerFile << "tileSize" << tileSize;
+	  headerFile << "mapPointsNextId" << (int)(vectorMapPoints.empty()? 0 : vectorMapPoints.back()->mnId + 1);
+	  headerFile << "keyFramesNextId" << (int)(vectorKeyFrames.empty()? 0 : vectorKeyFrames.back()->mnId + 1);
+	  headerFile << "tiles" << "[";
+	  for(auto &tile : tiles)
+		headerFile << "{:" << "x" << tile.x << "y" << tile.y << "z" << tile.z
+		  << "mappoints" << to_string(tile.length[0]) << "keyframes" << to_string(tile.length[1]) << "features" << to_string(tile.length[2]) << "}";
+	  headerFile << "]";
+	}
+
+
+	// Journal, emptied: this save folds it
+	if(journal){
+	  headerFile << "journalFile" << baseFilename + ".journal";
+	  ofstream(baseFilename + ".journal", ofstream::binary | ofstream::trunc);
+	}
+
+	// Vocabulary of the saved bag of words and keyframe database
+	if((options[BOW] && !options[NO_FEATURES_FILE]) || options[KEYFRAME_DATABASE])
+	  headerFile << "vocabularyFingerprint" << to_string(fingerprint);
 
 	// Save options, as an int
 	headerFile << "Options" << (int) options.to_ulong();
+	headerFile << "codec" << (int) codec;
+
+	// Quantization reference and its errors
+	if(options[QUANTIZED]){
+	  headerFile << "boundingBox" << "[:";
+	  for(float limit : boundingBox)
+		headerFile << limit;
+	  headerFile << "]";
+
+	  OsmapQuantizationError error = quantizationError();
+	  cout << "Quantization maximum errors, position: " << error.position << ", pose: " << error.pose << ", keypoint: " << error.keypoint << " px, angle: " << error.angle << " deg" << endl;
+	  headerFile << "quantizationError" << "{:" << "position" << error.position << "pose" << error.pose << "keypoint" << error.keypoint << "angle" << error.angle << "}";
+	}
 	// Options
 	if(options.any()){
 	headerFile << "Options descriptions" << "[:";
@@ -154,6 +412,19 @@ void Osmap::mapSave(const string givenFilename, bool pauseThreads){
 	OPTION(NO_MAPPOINTS_FILE)
 	OPTION(NO_KEYFRAMES_FILE)
 	OPTION(NO_FEATURES_FILE)
+	OPTION(COLUMNAR_FEATURES)
+	OPTION(SINGLE_FILE)
+	OPTION(QUANTIZED)
+	OPTION(DENSE_IDS)
+	OPTION(QUATERNION_POSES)
+	OPTION(POSE_DELTAS)
+	OPTION(DESCRIPTOR_RESIDUALS)
+	OPTION(JOURNAL)
+	OPTION(TILED)
+	OPTION(COVISIBILITY)
+	OPTION(BOW)
+	OPTION(NORMAL_AND_DEPTH)
+	OPTION(KEYFRAME_DATABASE)
 	headerFile << "]";
 	}
 
@@ -168,16 +439,88 @@ void Osmap::mapSave(const string givenFilename, bool pauseThreads){
 	}
 
 	// Save yaml file
-	headerFile.release();
+	if(singleFile){
+		// Header as the last section, then the final section table at the beginning of the container.
+		string header = headerFile.releaseAndGetString();
+		OsmapSection section = {HEADER_SECTION, 0, (uint64_t)container.tellp(), header.size()};
+		container.write(header.data(), header.size());
+		sectionTable.insert(sectionTable.begin(), section);
+		stats.bytes = container.tellp();
+		container.seekp(0);
+		writeContainerHeader(container, sectionTable);
+		container.close();
+		if(!container)
+			cerr << "Error while writing file " << filename << endl;
+	} else {
+		headerFile.release();
+
+		// Map size, sections' files and the header
+		for(auto &phase : stats.phases)
+			for(int type = MAPPOINTS_SECTION; type <= DATABASE_SECTION; type++)
+				if(phase.name == string(sectionNames[type]) + " save")
+					stats.bytes += phase.bytes;
+		struct stat headerStat;
+		if(!stat(filename.c_str(), &headerStat))
+			stats.bytes += headerStat.st_size;
+	}
 
-	// Clear temporary vectors
-	clearVectors();
+	// Journal checkpoint, later saves append what changes from now on
+	if(journal){
+		if(options[NO_KEYFRAMES_FILE] && !options[NO_FEATURES_FILE]) getKeyFramesFromMap();
+		journalFingerprints(NULL);
+		journalFilename = baseFilename + ".journal";
+		journalEntries = 0;
+	}
 
-	if(pauseThreads)
-	  system.mpViewer->Release();
+	finish();
+	cout << "Map saved in " << stats.wallTime << " s, " << stats.bytes << " bytes" << endl;
+}
+
+/*
+ * Tiles: distance from a position to a tile's cell, 0 inside it.
+ */
+static float tileDistance(const OsmapTile &tile, float tileSize, const Mat &position){
+	int cell[3] = {tile.x, tile.y, tile.z};
+	float squared = 0;
+	for(int i=0; i<3; i++){
+		float coordinate = position.at<float>(i), low = cell[i]*tileSize, high = low + tileSize;
+		float distance = coordinate < low? low - coordinate : coordinate > high? coordinate - high : 0;
+		squared += distance*distance;
+	}
+	return sqrt(squared);
+}
+
+void Osmap::mapLoad(string yamlFilename, const Mat &seed, float radius, bool noSetBad, bool pauseThreads){
+	loadSeed = seed;
+	loadRadius = radius;
+	mapLoad(yamlFilename, noSetBad, pauseThreads);
+	loadRadius = -1;
 }
 
 void Osmap::mapLoad(string yamlFilename, bool noSetBad, bool pauseThreads){
+	stats = OsmapStats();
+	OsmapClock callStart;
+
+	// A single file container is mapped and validated before touching the system.
+	bool singleFile = yamlFilename.length() > 6 && yamlFilename.substr(yamlFilename.length()-6) == ".osmap";
+	unique_ptr<OsmapMappedFile> containerFile;
+	vector<OsmapSection> sectionTable;
+	if(singleFile){
+		containerFile.reset(new OsmapMappedFile(yamlFilename));
+		if(!readContainerHeader(containerFile->data, containerFile->size, sectionTable)){
+			cerr << "Couldn't read map container " << yamlFilename << ", map not loaded." << endl;
+			return;
+		}
+	}
+
+	// Pages belong to the previous map's keyframes
+	if(pageFileDescriptor >= 0){
+		pages.clear();
+		if(ftruncate(pageFileDescriptor, 0))
+			cerr << "Couldn't truncate page file " << pageFilename << endl;
+		pageFileSize = 0;
+	}
+
 #ifndef OSMAP_DUMMY_MAP
 	LOGV(system.mpTracker->mState)
 	// Initialize currentFrame via calling GrabImageMonocular just in case, with a dummy image.
@@ -216,13 +559,88 @@ void Osmap::mapLoad(string yamlFilename, bool noSetBad, bool pauseThreads){
 	string filename;
 	int intOptions;
 
-	// Open YAML
-	cv::FileStorage headerFile(yamlFilename, cv::FileStorage::READ);
+	// Open YAML, from its file or from the container's header section
+	cv::FileStorage headerFile;
+	if(singleFile){
+		for(auto &section : sectionTable)
+			if(section.type == HEADER_SECTION)
+				headerFile.open(string(containerFile->data + section.offset, section.length), cv::FileStorage::READ | cv::FileStorage::MEMORY);
+	} else
+		headerFile.open(yamlFilename, cv::FileStorage::READ);
 
 	// Options
 	headerFile["Options"] >> intOptions;
 	options = intOptions;
 
+	// Codec, absent in maps saved without compression support
+	int intCodec = 0;
+	headerFile["codec"] >> intCodec;
+	codec = (Codecs) intCodec;
+
+	// Bounding box, quantized positions are relative to it
+	if(options[QUANTIZED]){
+		FileNode limits = headerFile["boundingBox"];
+		int i = 0;
+		for(FileNodeIterator it = limits.begin(); it != limits.end() && i < 6; ++it)
+			boundingBox[i++] = (float)(*it);
+	}
+
+	// Bag of words and keyframe database are restored only if computed with the actual vocabulary
+	vocabularyMatches = false;
+	keyFrameDatabaseLoaded = false;
+	if(options[BOW] || options[KEYFRAME_DATABASE]){
+		string savedFingerprint;
+		headerFile["vocabularyFingerprint"] >> savedFingerprint;
+		vocabularyMatches = !savedFingerprint.empty() && savedFingerprint == to_string(vocabularyFingerprint());
+		if(!vocabularyMatches)
+			cerr << "Map saved with another vocabulary, bag of words and keyframe database will be computed." << endl;
+	}
+
+	// Tile index.  Tiles not selected are skipped in every section.
+	bool tiled = options[TILED], partial = false;
+	unsigned int mapPointsNextId = 0, keyFramesNextId = 0;
+	tiles.clear();
+	if(tiled){
+		headerFile["tileSize"] >> tileSize;
+		mapPointsNextId = (int)headerFile["mapPointsNextId"];
+		keyFramesNextId = (int)headerFile["keyFramesNextId"];
+		const char *sectionKeys[3] = {"mappoints", "keyframes", "features"};
+		uint64_t offset[3] = {0, 0, 0};
+		int nSelected = 0, nearest = -1;
+		float nearestDistance = INFINITY;
+		FileNode tileIndex = headerFile["tiles"];
+		for(FileNodeIterator it = tileIndex.begin(); it != tileIndex.end(); ++it){
+			OsmapTile tile;
+			tile.x = (int)(*it)["x"];
+			tile.y = (int)(*it)["y"];
+			tile.z = (int)(*it)["z"];
+			for(int i=0; i<3; i++){
+				// Lengths are strings, or ints in older maps
+				FileNode length = (*it)[sectionKeys[i]];
+				tile.offset[i] = offset[i];
+				tile.length[i] = length.isString()? stoull((string)length) : (uint64_t)(int)length;
+				offset[i] += tile.length[i];
+			}
+			float distance = loadRadius < 0? 0 : tileDistance(tile, tileSize, loadSeed);
+			tile.selected = loadRadius < 0 || distance <= loadRadius;
+			if(tile.length[1] && distance < nearestDistance){
+				nearestDistance = distance;
+				nearest = tiles.size();
+			}
+			nSelected += tile.selected;
+			tiles.push_back(move(tile));
+		}
+
+		// A map needs keyframes: without any within radius, the nearest tile with keyframes is loaded
+		if(nearest >= 0 && nearestDistance > loadRadius && loadRadius >= 0){
+			cerr << "No keyframes within radius " << loadRadius << ", loading the nearest tile, at " << nearestDistance << endl;
+			tiles[nearest].selected = true;
+			nSelected++;
+		}
+		partial = nSelected < (int)tiles.size();
+		cout << "Tiles loaded: " << nSelected << " of " << tiles.size() << endl;
+	}
+
 	// K
 	if(!options[K_IN_KEYFRAME]){
 		vectorK.clear();
@@ -246,38 +664,258 @@ void Osmap::mapLoad(string yamlFilename, bool noSetBad, bool pauseThreads){
 	if(pathDirectory != "")
 		chdir(pathDirectory.c_str());
 
+	// Journal file, read after the map.  Entries change keyframes and observations, so they need the whole map loaded before rebuilding.
+	journalFilename.clear();
+	journalEntries = 0;
+	bool journalPending = false;
+	if(options[JOURNAL]){
+		headerFile["journalFile"] >> journalFilename;
+		struct stat journalStat;
+		journalPending = !journalFilename.empty() && !stat(journalFilename.c_str(), &journalStat) && journalStat.st_size > 0;
+	}
+
+	/*
+	 * Sections are slices of the container, or whole memory mapped files whose names are in the header.
+	 * Sections are parsed and then deserialized.  Parsing a section doesn't depend on the others, but deserialization does:
+	 * keyframes link to other keyframes, and features link to keyframes and mappoints.
+	 * If threads property is not 1, the sections are parsed concurrently, and deserialized in order as soon as each one is parsed.
+	 * Otherwise parsing is deferred, and in delimited form each features message is deserialized right after being parsed.
+	 */
+	vector<unique_ptr<OsmapMappedFile>> sectionFiles;
+	vector<unique_ptr<string>> sectionBuffers;
+	auto getSection = [&](SectionTypes type, const char *fileKey, const char *&data, size_t &size) -> bool{
+		OsmapClock start;
+		string name = sectionNames[type];
+		data = NULL;
+		size = 0;
+		Codecs sectionCodec = codec;
+		if(singleFile){
+			for(auto &section : sectionTable)
+				if(section.type == type){
+					data = containerFile->data + section.offset;
+					size = section.length;
+					sectionCodec = (Codecs) section.codec;
+				}
+		} else {
+			headerFile[fileKey] >> filename;
+			sectionFiles.emplace_back(new OsmapMappedFile(filename));
+			if(!sectionFiles.back()->isOpen)
+				cerr << "Couldn't open file " << filename << endl;
+			data = sectionFiles.back()->data;
+			size = sectionFiles.back()->size;
+		}
+		stats.bytes += size;
+
+		// Selected tiles must be in the section
+		int i = type - MAPPOINTS_SECTION;
+		if(tiled)
+			for(auto &tile : tiles)
+				if(tile.selected && tile.offset[i] + tile.length[i] > size){
+					cerr << "Tile (" << tile.x << ", " << tile.y << ", " << tile.z << ") out of the " << name << " section." << endl;
+					return false;
+				}
+
+		// Tiled sections are parsed from the selected tiles one after another, each one decompressed on its own.
+		// Concatenated messages parse as a single one with every tile's objects.
+		if(tiled && (partial || codec != NO_CODEC)){
+			sectionBuffers.emplace_back(new string);
+			string &buffer = *sectionBuffers.back(), raw;
+			for(auto &tile : tiles){
+				if(!tile.selected)
+					continue;
+				if(codec == NO_CODEC)
+					buffer.append(data + tile.offset[i], tile.length[i]);
+				else if(decompress(data + tile.offset[i], tile.length[i], codec, raw))
+					buffer += raw;
+				else {
+					cerr << "Couldn't decompress tile (" << tile.x << ", " << tile.y << ", " << tile.z << ") in the " << name << " section." << endl;
+					return false;
+				}
+			}
+			data = buffer.data();
+			size = buffer.size();
+			phaseEnd(name + (codec == NO_CODEC? " read" : " decompress"), start, 0, size);
+		} else if(sectionCodec != NO_CODEC){
+			// Compressed sections are parsed from a decompressed buffer
+			sectionBuffers.emplace_back(new string);
+			if(!decompress(data, size, sectionCodec, *sectionBuffers.back())){
+				cerr << "Couldn't decompress the " << name << " section." << endl;
+				return false;
+			}
+			data = sectionBuffers.back()->data();
+			size = sectionBuffers.back()->size();
+			phaseEnd(name + " decompress", start, 0, size);
+		}
+		return true;
+	};
+
+	// Parsing, timed in the thread it runs
+	auto timedParse = [this](const char *name, const char *data, size_t size, google::protobuf::MessageLite &message){
+		OsmapClock start;
+		bool parsed = parse(data, size, message);
+		phaseEnd(string(name) + " parse", start, 0, size);
+		return parsed;
+	};
+
+	bool concurrent = getThreads() != 1;
+
+	// Delimited features are streamed: keyframes are rebuilt while features are being parsed
+	bool streaming = concurrent && options[FEATURES_FILE_DELIMITED] && !tiled && !journalPending && !options[NO_KEYFRAMES_FILE];
+	launch policy = concurrent? launch::async : launch::deferred;
+	const char *mappointsData, *keyframesData, *featuresData, *databaseData;
+	size_t mappointsSize, keyframesSize, featuresSize, databaseSize;
+	unique_ptr<SerializedMappointArray> serializedMappointArray(new SerializedMappointArray);
+	unique_ptr<SerializedKeyframeArray> serializedKeyframeArray(new SerializedKeyframeArray);
+	unique_ptr<vector<SerializedKeyframeFeaturesArray>> serializedFeatures(new vector<SerializedKeyframeFeaturesArray>);
+	unique_ptr<SerializedKeyframeDatabase> serializedDatabase(new SerializedKeyframeDatabase);
+	future<bool> mappointsParsed, keyframesParsed, featuresParsed, databaseParsed;
+	bool sectionsRead = true;
+	if(!options[NO_MAPPOINTS_FILE]){
+		sectionsRead = getSection(MAPPOINTS_SECTION, "mappointsFile", mappointsData, mappointsSize);
+		if(sectionsRead)
+			mappointsParsed = async(policy, [&]{return timedParse("mappoints", mappointsData, mappointsSize, *serializedMappointArray);});
+	}
+	if(sectionsRead && !options[NO_KEYFRAMES_FILE]){
+		sectionsRead = getSection(KEYFRAMES_SECTION, "keyframesFile", keyframesData, keyframesSize);
+		if(sectionsRead)
+			keyframesParsed = async(policy, [&]{return timedParse("keyframes", keyframesData, keyframesSize, *serializedKeyframeArray);});
+	}
+	if(sectionsRead && !options[NO_FEATURES_FILE]){
+		sectionsRead = getSection(FEATURES_SECTION, "featuresFile", featuresData, featuresSize);
+		if(sectionsRead && concurrent && !streaming)
+			featuresParsed = async(launch::async, [&]{
+				OsmapClock start;
+				bool parsed = featuresParse(featuresData, featuresSize, *serializedFeatures);
+				phaseEnd("features parse", start, 0, featuresSize);
+				return parsed;
+			});
+	}
+	// Keyframe database, replacing the one rebuild would build, unless journal saves change keyframes
+	if(sectionsRead && options[KEYFRAME_DATABASE] && vocabularyMatches){
+		if(journalPending)
+			cout << "Keyframe database predates journal saves, it will be rebuilt." << endl;
+		else {
+			sectionsRead = getSection(DATABASE_SECTION, "databaseFile", databaseData, databaseSize);
+			if(sectionsRead)
+				databaseParsed = async(policy, [&]{return timedParse("database", databaseData, databaseSize, *serializedDatabase);});
+		}
+	}
+
+	// A section that couldn't be read fails the load, once the parsing already launched ends
+	if(!sectionsRead){
+		for(future<bool> *parsed : {&mappointsParsed, &keyframesParsed, &featuresParsed, &databaseParsed})
+			if(parsed->valid())
+				parsed->wait();
+		clearVectors();
+		journalFilename.clear();
+		if(pauseThreads)
+			system.mpViewer->Release();
+		cerr << "Couldn't read map sections from " << yamlFilename << ", map not loaded." << endl;
+		return;
+	}
 
 	// MapPoints
 	vectorMapPoints.clear();
 	if(!options[NO_MAPPOINTS_FILE]){
-		headerFile["mappointsFile"] >> filename;
-		MapPointsLoad(filename);
+		if(!mappointsParsed.get())
+			cerr << "Error while parsing mappoints." << endl;
+		if(tiled) mergeTiles(*serializedMappointArray);
+		MapPointsLoad(*serializedMappointArray);
+		serializedMappointArray.reset();
 	}
 
 
 	// KeyFrames
 	vectorKeyFrames.clear();
 	if(!options[NO_KEYFRAMES_FILE]){
-		headerFile["keyframesFile"] >> filename;
-		KeyFramesLoad(filename);
+		if(!keyframesParsed.get())
+			cerr << "Error while parsing keyframes." << endl;
+		if(tiled) mergeTiles(*serializedKeyframeArray);
+		KeyFramesLoad(*serializedKeyframeArray);
+		serializedKeyframeArray.reset();
+	}
+
+	// Keyframe database
+	if(databaseParsed.valid()){
+		if(!databaseParsed.get())
+			cerr << "Error while parsing keyframe database." << endl;
+		else {
+			OsmapClock start;
+			int nWords = deserialize(*serializedDatabase);
+			phaseEnd("database deserialize", start, max(nWords, 0));
+			keyFrameDatabaseLoaded = nWords >= 0;
+			if(keyFrameDatabaseLoaded)
+				cout << "Keyframe database words loaded: " << nWords << endl;
+			else
+				cerr << "Inconsistent keyframe database, it will be rebuilt." << endl;
+		}
+		serializedDatabase.reset();
 	}
 
 	// Features
 	if(!options[NO_FEATURES_FILE]){
-		headerFile["featuresFile"] >> filename;
-		cout << "Loading features from " << filename << " ..." << endl;
-		featuresLoad(filename);
+		cout << "Loading features ..." << endl;
+		if(streaming)
+			featuresLoadAndRebuild(featuresData, featuresSize);
+		else if(concurrent){
+			if(!featuresParsed.get())
+				cerr << "Error while parsing features." << endl;
+			featuresLoad(*serializedFeatures);
+			serializedFeatures.reset();
+		} else
+			featuresLoad(featuresData, featuresSize);
+	}
+
+	// Part of a tiled map: mappoints in loaded tiles observed only from tiles not loaded are left out
+	if(partial && !options[NO_FEATURES_FILE])
+		cout << "Mappoints observed only from tiles not loaded: " << eraseUnobservedMapPoints() << endl;
+
+	// Journal, incremental saves after this map
+	if(journalPending){
+		OsmapClock start;
+		journalEntries = journalLoad(journalFilename);
+		struct stat journalStat;
+		uint64_t journalSize = stat(journalFilename.c_str(), &journalStat)? 0 : journalStat.st_size;
+		stats.bytes += journalSize;
+		phaseEnd("journal load", start, journalEntries, journalSize);
+	}
+
+	// Journal saves change observations, so loaded normals, depths and covisibility graph may be stale: they are computed again
+	if(journalEntries){
+		mapPointRefKeyFrameIds.clear();
+		keyFrameConnections.clear();
 	}
 
 	// Close yaml file
 	headerFile.release();
 
+	// Map size: a container is read whole, otherwise the header adds to the sections
+	struct stat headerStat;
+	string headerFilename;
+	parsePath(yamlFilename, &headerFilename, NULL);
+	if(singleFile)
+		stats.bytes = containerFile->size;
+	else if(!stat(headerFilename.c_str(), &headerStat))
+		stats.bytes += headerStat.st_size;
+
 	// Rebuild
 	rebuild(noSetBad);
 
+	// New ids continue after the whole tiled map's, so they don't collide with ids in tiles not loaded
+	if(tiled){
+		if(MapPoint::nNextId < mapPointsNextId) MapPoint::nNextId = mapPointsNextId;
+		if(KeyFrame::nNextId < keyFramesNextId) KeyFrame::nNextId = keyFramesNextId;
+	}
+
 	// Copy to map
+	OsmapClock copyStart;
 	setMapPointsToMap();
 	setKeyFramesToMap();
+	phaseEnd("copy to map", copyStart, vectorMapPoints.size() + vectorKeyFrames.size());
+
+	// Journal checkpoint, so following saves append to the loaded journal
+	if(!journalFilename.empty())
+		journalFingerprints(NULL);
 
 	// Release temporary vectors
 	clearVectors();
@@ -297,94 +935,133 @@ void Osmap::mapLoad(string yamlFilename, bool noSetBad, bool pauseThreads){
 		// Invoked after viewer.Release() because of mutex.
 		system.mpFrameDrawer->Update(system.mpTracker);
 	}
+
+	statsEnd(callStart);
+	cout << "Map loaded in " << stats.wallTime << " s, " << stats.bytes << " bytes" << endl;
 }
 
 int Osmap::MapPointsSave(string filename){
 	ofstream file;
 	file.open(filename, std::ofstream::binary);
+	int nMP = MapPointsSave(file);
+	file.close();
+
+	return nMP;
+}
 
+int Osmap::MapPointsSave(ostream &file){
 	// Serialize
+	OsmapClock start;
 	SerializedMappointArray serializedMappointArray;
 	int nMP = serialize(vectorMapPoints, serializedMappointArray);
+	phaseEnd("mappoints serialize", start, nMP);
 
-	// Closing
+	// Writing
+	OsmapClock writeStart;
+	streampos begin = file.tellp();
 	if (!serializedMappointArray.SerializeToOstream(&file))
 		// Signals the error
 		nMP = -1;
-	file.close();
+	phaseEnd("mappoints write", writeStart, 0, (uint64_t)(file.tellp() - begin));
 
 	return nMP;
 }
 
 int Osmap::MapPointsLoad(string filename){
-	ifstream file;
-	file.open(filename, ifstream::binary);
-
 	SerializedMappointArray serializedMappointArray;
-	serializedMappointArray.ParseFromIstream(&file);
+	parseFile(filename, serializedMappointArray);
+	return MapPointsLoad(serializedMappointArray);
+}
+
+int Osmap::MapPointsLoad(const SerializedMappointArray &serializedMappointArray){
+	OsmapClock start;
 	int nMP = deserialize(serializedMappointArray, vectorMapPoints);
 	cout << "Mappoints loaded: " << nMP << endl;
 
-	file.close();
+	// Index by id, features refer to mappoints by id
+	indexMapPoints();
+	phaseEnd("mappoints deserialize", start, nMP);
+
 	return nMP;
 }
 
 int Osmap::KeyFramesSave(string filename){
 	ofstream file;
 	file.open(filename, std::ofstream::binary);
+	int nKF = KeyFramesSave(file);
+	file.close();
+
+	return nKF;
+}
 
+int Osmap::KeyFramesSave(ostream &file){
 	// Serialize
+	OsmapClock start;
 	SerializedKeyframeArray serializedKeyFrameArray;
 	int nKF = serialize(vectorKeyFrames, serializedKeyFrameArray);
+	phaseEnd("keyframes serialize", start, nKF);
 
-	// Closing
+	// Writing
+	OsmapClock writeStart;
+	streampos begin = file.tellp();
 	if (!serializedKeyFrameArray.SerializeToOstream(&file))
 		// Signals the error
 		nKF = -1;
-	file.close();
+	phaseEnd("keyframes write", writeStart, 0, (uint64_t)(file.tellp() - begin));
 
 	return nKF;
 }
 
 int Osmap::KeyFramesLoad(string filename){
-	ifstream file;
-	file.open(filename, ifstream::binary);
+	SerializedKeyframeArray serializedKeyFrameArray;
+	parseFile(filename, serializedKeyFrameArray);
+	return KeyFramesLoad(serializedKeyFrameArray);
+}
+
+int Osmap::KeyFramesLoad(const SerializedKeyframeArray &serializedKeyFrameArray){
 #ifndef OSMAP_DUMMY_MAP
 	if(!currentFrame.mTcw.dims)	// if map is no initialized, currentFrame has no pose, a pose is needed to create keyframes.
 		currentFrame.mTcw = Mat::eye(4, 4, CV_32F);
 #endif
-	SerializedKeyframeArray serializedKeyFrameArray;
-	serializedKeyFrameArray.ParseFromIstream(&file);
+	OsmapClock start;
 	int nKF = deserialize(serializedKeyFrameArray, vectorKeyFrames);
 	cout << "Keyframes loaded: "
 		<< nKF << endl;
-	file.close();
+
+	// getKeyFrame relies on ascending id order, as mapSave writes them.
+	if(!is_sorted(vectorKeyFrames.begin(), vectorKeyFrames.end(), [](const KeyFrame *a, const KeyFrame *b){return a->mnId < b->mnId;})){
+		cerr << "Keyframes file not in ascending id order, sorting." << endl;
+		sort(vectorKeyFrames.begin(), vectorKeyFrames.end(), [](const KeyFrame *a, const KeyFrame *b){return a->mnId < b->mnId;});
+	}
+	lastKeyFrameIdx = 0;
+	phaseEnd("keyframes deserialize", start, nKF);
 	return nKF;
 }
 
 int Osmap::featuresSave(string filename){
-	int nFeatures = 0;
 	ofstream file;
-
 	file.open(filename, ofstream::binary);
-	if(
-		options[FEATURES_FILE_DELIMITED] ||
-		(!options[FEATURES_FILE_NOT_DELIMITED] && countFeatures() > FEATURES_MESSAGE_LIMIT)
-	){
-		// Saving with delimited ad hoc file format
-		// Loop serializing blocks of no more than FEATURES_MESSAGE_LIMIT features, using Kendon Varda's function
+	int nFeatures = featuresSave(file);
+	file.close();
 
-		options.set(FEATURES_FILE_DELIMITED);
+	return nFeatures;
+}
 
-		// This Protocol Buffers stream must be deleted before closing file.  It happens automatically at }.
-		::google::protobuf::io::OstreamOutputStream protocolbuffersStream(&file);
-		vector<OsmapKeyFrame*> vectorBlock;
-		vectorBlock.reserve(FEATURES_MESSAGE_LIMIT/30);
+int Osmap::featuresSave(ostream &file){
+	int nFeatures = 0;
+
+	chooseFeaturesFileForm();
+	if(options[FEATURES_FILE_DELIMITED]){
+		// Saving with delimited ad hoc file format
+		// Loop serializing blocks of no more than FEATURES_MESSAGE_LIMIT features, using Kendon Varda's function
 
+		// Split keyframes in blocks
+		vector<vector<OsmapKeyFrame*>> vectorBlocks;
 		auto it = vectorKeyFrames.begin();
 		while(it != vectorKeyFrames.end()){
 			unsigned int n = (*it)->N;
-			vectorBlock.clear();
+			vectorBlocks.emplace_back();
+			vector<OsmapKeyFrame*> &vectorBlock = vectorBlocks.back();
 			do{
 				vectorBlock.push_back(*it);
 				++it;
@@ -392,86 +1069,1363 @@ int Osmap::featuresSave(string filename){
 				KeyFrame *KF = *it;
 				n += KF->N;
 			} while(n <= FEATURES_MESSAGE_LIMIT);
+		}
+
+		// This Protocol Buffers stream must be deleted before closing file.  It happens automatically at }.
+		::google::protobuf::io::OstreamOutputStream protocolbuffersStream(&file);
+		size_t nBlocks = vectorBlocks.size();
+		unsigned int nThreads = getThreads();
+		bool ok = true;
+		if(nThreads == 1 || nBlocks == 1){
+			for(auto &vectorBlock : vectorBlocks){
+				OsmapClock start;
+				SerializedKeyframeFeaturesArray serializedKeyframeFeaturesArray;
+				int nBlockFeatures = serialize(vectorBlock, serializedKeyframeFeaturesArray);
+				nFeatures += nBlockFeatures;
+				phaseEnd("features serialize", start, nBlockFeatures);
+				OsmapClock writeStart;
+				int64_t begin = protocolbuffersStream.ByteCount();
+				ok = writeDelimitedTo(serializedKeyframeFeaturesArray, &protocolbuffersStream) && ok;
+				phaseEnd("features write", writeStart, 0, protocolbuffersStream.ByteCount() - begin);
+			}
+		} else {
+			/*
+			 * Pipeline: worker threads serialize blocks concurrently, this thread writes them in order.
+			 * A block is serialized only when there are less than 2 blocks per thread waiting to be written, bounding memory.
+			 */
+			size_t capacity = 2*nThreads, nWritten = 0;
+			vector<unique_ptr<SerializedKeyframeFeaturesArray>> serializedBlocks(nBlocks);
+			vector<int> nBlockFeatures(nBlocks);
+			mutex blocksMutex;
+			condition_variable blocksCondition;
+			atomic<size_t> next(0);
+
+			auto worker = [&](){
+				for(size_t i; (i = next++) < nBlocks;){
+					{
+						unique_lock<mutex> lock(blocksMutex);
+						blocksCondition.wait(lock, [&]{return i < nWritten + capacity;});
+					}
+					OsmapClock start;
+					unique_ptr<SerializedKeyframeFeaturesArray> serializedKeyframeFeaturesArray(new SerializedKeyframeFeaturesArray);
+					nBlockFeatures[i] = serialize(vectorBlocks[i], *serializedKeyframeFeaturesArray);
+					phaseEnd("features serialize", start, nBlockFeatures[i]);
+					{
+						lock_guard<mutex> lock(blocksMutex);
+						serializedBlocks[i] = move(serializedKeyframeFeaturesArray);
+					}
+					blocksCondition.notify_all();
+				}
+			};
+			vector<thread> pool;
+			for(unsigned int i=0; i<nThreads; i++)
+				pool.emplace_back(worker);
+
+			// Writer
+			for(size_t i=0; i<nBlocks; i++){
+				unique_ptr<SerializedKeyframeFeaturesArray> serializedKeyframeFeaturesArray;
+				{
+					unique_lock<mutex> lock(blocksMutex);
+					blocksCondition.wait(lock, [&]{return (bool)serializedBlocks[i];});
+					serializedKeyframeFeaturesArray = move(serializedBlocks[i]);
+				}
+				OsmapClock start;
+				int64_t begin = protocolbuffersStream.ByteCount();
+				ok = writeDelimitedTo(*serializedKeyframeFeaturesArray, &protocolbuffersStream) && ok;
+				phaseEnd("features write", start, 0, protocolbuffersStream.ByteCount() - begin);
+				nFeatures += nBlockFeatures[i];
+				{
+					lock_guard<mutex> lock(blocksMutex);
+					nWritten++;
+				}
+				blocksCondition.notify_all();
+			}
 
-			SerializedKeyframeFeaturesArray serializedKeyframeFeaturesArray;
-			nFeatures += serialize(vectorBlock, serializedKeyframeFeaturesArray);
-			writeDelimitedTo(serializedKeyframeFeaturesArray, &protocolbuffersStream);
+			for(auto &t : pool)
+				t.join();
 		}
+		if(!ok)
+			nFeatures = -1;
 	}else{
-		options.set(FEATURES_FILE_NOT_DELIMITED);
+		OsmapClock start;
 		SerializedKeyframeFeaturesArray serializedKeyframeFeaturesArray;
 		nFeatures = serialize(vectorKeyFrames, serializedKeyframeFeaturesArray);
+		phaseEnd("features serialize", start, nFeatures);
+		OsmapClock writeStart;
+		streampos begin = file.tellp();
 		if (!serializedKeyframeFeaturesArray.SerializeToOstream(&file)){
 			cerr << "Error while serializing features file without delimitation." << endl;
 			nFeatures = -1;
 		}
+		phaseEnd("features write", writeStart, 0, (uint64_t)(file.tellp() - begin));
 	}
-	file.close();
 
 	return nFeatures;
 }
 
+int Osmap::keyFrameDatabaseSave(ostream &file){
+	// Serialize
+	OsmapClock start;
+	SerializedKeyframeDatabase serializedDatabase;
+	int nWords = serialize(&serializedDatabase);
+	phaseEnd("database serialize", start, max(nWords, 0));
+
+	// Writing
+	OsmapClock writeStart;
+	streampos begin = file.tellp();
+	if(!serializedDatabase.SerializeToOstream(&file))
+		// Signals the error
+		nWords = -1;
+	phaseEnd("database write", writeStart, 0, (uint64_t)(file.tellp() - begin));
+
+	return nWords;
+}
+
+void Osmap::chooseFeaturesFileForm(){
+	if(options[FEATURES_FILE_DELIMITED] || options[FEATURES_FILE_NOT_DELIMITED])
+		return;
+
+	if(!options[FEATURES_FILE_NOT_DELIMITED] && countFeatures() > FEATURES_MESSAGE_LIMIT)
+		options.set(FEATURES_FILE_DELIMITED);
+	else
+		options.set(FEATURES_FILE_NOT_DELIMITED);
+}
+
 int Osmap::featuresLoad(string filename){
+	OsmapMappedFile file(filename);
+	if(!file.isOpen)
+		cerr << "Couldn't open file " << filename << endl;
+	return featuresLoad(file.data, file.size);
+}
+
+int Osmap::featuresLoad(const char *data, size_t size){
 	int nFeatures = 0;
-	ifstream file;
-	file.open(filename, ifstream::binary);
-	auto *googleStream = new ::google::protobuf::io::IstreamInputStream(&file);
 	SerializedKeyframeFeaturesArray serializedKeyframeFeaturesArray;
 	if(options[FEATURES_FILE_DELIMITED]){
-		while(true)
-			if(readDelimitedFrom(googleStream, &serializedKeyframeFeaturesArray)){
-				nFeatures += deserialize(serializedKeyframeFeaturesArray);
-				cout << "Features deserialized in loop: "
-					 << nFeatures << endl;
-			}
-			else
-				break;
+		size_t offset = 0, blockOffset = 0;
+		OsmapClock start;
+		while(parseDelimited(data, size, offset, serializedKeyframeFeaturesArray)){
+			phaseEnd("features parse", start, 0, offset - blockOffset);
+			blockOffset = offset;
+			OsmapClock deserializeStart;
+			int nBlockFeatures = deserialize(serializedKeyframeFeaturesArray);
+			nFeatures += nBlockFeatures;
+			phaseEnd("features deserialize", deserializeStart, nBlockFeatures);
+			cout << "Features deserialized in loop: "
+				 << nFeatures << endl;
+			start = OsmapClock();
+		}
+		if(offset != size){
+			cerr << "Error while parsing features at byte " << offset << " of " << size << ", following features not loaded." << endl;
+			return -1;
+		}
 	} else {
 		// Not delimited, pure Protocol Buffers
-		serializedKeyframeFeaturesArray.ParseFromIstream(&file);
+		OsmapClock start;
+		if(!parse(data, size, serializedKeyframeFeaturesArray))
+			cerr << "Error while parsing features." << endl;
+		phaseEnd("features parse", start, 0, size);
+		OsmapClock deserializeStart;
 		nFeatures = deserialize(serializedKeyframeFeaturesArray);
-	  }
+		phaseEnd("features deserialize", deserializeStart, nFeatures);
+	}
 	cout << "Features loaded: " << nFeatures << endl;
-	file.close();
 	return nFeatures;
 }
 
-void Osmap::getMapPointsFromMap(){
-	  vectorMapPoints.clear();
-	  vectorMapPoints.reserve(map.mspMapPoints.size());
-	  std::transform(map.mspMapPoints.begin(), map.mspMapPoints.end(), std::back_inserter(vectorMapPoints), [](MapPoint *pMP)->OsmapMapPoint*{return static_cast<OsmapMapPoint*>(pMP);});
-	  sort(vectorMapPoints.begin(), vectorMapPoints.end(), [](const MapPoint* a, const MapPoint* b){return a->mnId < b->mnId;});
-}
+int Osmap::featuresLoad(const vector<SerializedKeyframeFeaturesArray> &serializedFeatures){
+	OsmapClock start;
+	int nFeatures = 0;
+	for(auto &serializedKeyframeFeaturesArray : serializedFeatures)
+		nFeatures += deserialize(serializedKeyframeFeaturesArray);
+	phaseEnd("features deserialize", start, nFeatures);
 
-void Osmap::setMapPointsToMap(){
-	map.mspMapPoints.clear();
-	copy(vectorMapPoints.begin(), vectorMapPoints.end(), inserter(map.mspMapPoints, map.mspMapPoints.end()));
+	cout << "Features loaded: " << nFeatures << endl;
+	return nFeatures;
 }
 
-void Osmap::getKeyFramesFromMap(){
-	// Order keyframes by mnId
-	vectorKeyFrames.clear();
-	vectorKeyFrames.reserve(map.mspKeyFrames.size());
-	std::transform(map.mspKeyFrames.begin(), map.mspKeyFrames.end(), std::back_inserter(vectorKeyFrames), [](KeyFrame *pKF)->OsmapKeyFrame*{return static_cast<OsmapKeyFrame*>(pKF);});
-	sort(vectorKeyFrames.begin(), vectorKeyFrames.end(), [](const KeyFrame *a, const KeyFrame *b){return a->mnId < b->mnId;});
+int Osmap::featuresLoadAndRebuild(const char *data, size_t size){
+	/*
+	 * Pipeline: the reader thread parses blocks, worker threads deserialize and rebuild keyframes concurrently, this thread links them in order.
+	 * The reader waits while 2 blocks are not completely linked, bounding memory: a parsed block is as big as FEATURES_MESSAGE_LIMIT features.
+	 * Items are the keyframes in the blocks, in file order.  A block is released when its last keyframe is linked.
+	 */
+	struct Item{
+		size_t block;
+		int index;
+		OsmapKeyFrame *pKF;
+		bool ready;
+	};
+	const size_t capacity = 2;
+	deque<unique_ptr<SerializedKeyframeFeaturesArray>> blocks;
+	deque<size_t> blocksRemaining;
+	deque<Item> items;
+	size_t nextItem = 0, nBlocksReleased = 0;
+	bool readerDone = false, parsed = false;
+	unordered_set<OsmapKeyFrame*> found;	// Keyframes streamed or linked without features, each one is deserialized only once
+	mutex pipelineMutex;
+	condition_variable pipelineCondition;
+
+	if(!keyFrameDatabaseLoaded)
+		keyFrameDatabase.clear();
+
+	// Keyframes looked up by binary search, because getKeyFrame is not thread safe and this thread uses it linking connections
+	auto findKeyFrame = [this](unsigned int id) -> OsmapKeyFrame*{
+		if(options[DENSE_IDS])
+			return id < vectorKeyFrames.size()? vectorKeyFrames[id] : NULL;
+		auto it = lower_bound(vectorKeyFrames.begin(), vectorKeyFrames.end(), id, [](const KeyFrame *a, unsigned int id){return a->mnId < id;});
+		return it != vectorKeyFrames.end() && (*it)->mnId == id? *it : NULL;
+	};
+
+	thread reader([&](){
+		size_t offset = 0;
+		while(true){
+			{
+				unique_lock<mutex> lock(pipelineMutex);
+				pipelineCondition.wait(lock, [&]{return blocks.size() - nBlocksReleased < capacity;});
+			}
+			OsmapClock start;
+			size_t blockOffset = offset;
+			unique_ptr<SerializedKeyframeFeaturesArray> block(new SerializedKeyframeFeaturesArray);
+			if(!parseDelimited(data, size, offset, *block))
+				break;
+			phaseEnd("features parse", start, 0, offset - blockOffset);
+
+			int n = block->feature_size(), nColumnar = block->columnarfeature_size();
+			vector<Item> blockItems;
+			unique_lock<mutex> foundLock(pipelineMutex);
+			for(int i=0; i<n+nColumnar; i++){
+				unsigned int KFid = i<n? block->feature(i).keyframe_id() : block->columnarfeature(i-n).keyframe_id();
+				OsmapKeyFrame *pKF = findKeyFrame(KFid);
+				if(!pKF)
+					cerr << "KeyFrame id "<< KFid << "not found while deserializing features: skipped.  Inconsistence between keyframes and features serialization files." << endl;
+				else if(!found.insert(pKF).second)
+					cerr << "KeyFrame id "<< KFid << " features repeated or out of order while deserializing features: skipped." << endl;
+				else
+					blockItems.push_back({0, i, pKF, false});
+			}
+			foundLock.unlock();
+			if(blockItems.empty())
+				continue;
+
+			{
+				lock_guard<mutex> lock(pipelineMutex);
+				for(auto &item : blockItems){
+					item.block = blocks.size();
+					items.push_back(item);
+				}
+				blocks.push_back(move(block));
+				blocksRemaining.push_back(blockItems.size());
+			}
+			pipelineCondition.notify_all();
+		}
+		{
+			lock_guard<mutex> lock(pipelineMutex);
+			readerDone = true;
+			parsed = offset == size;
+		}
+		pipelineCondition.notify_all();
+	});
+
+	// Each worker times its keyframes apart, and adds them to stats when done
+	auto worker = [&](){
+		OsmapPhase deserializePhase, rebuildPhase;
+		deserializePhase.name = "features deserialize";
+		rebuildPhase.name = "rebuild keyframes";
+		while(true){
+			size_t i;
+			Item item;
+			const SerializedKeyframeFeaturesArray *pBlock;
+			{
+				unique_lock<mutex> lock(pipelineMutex);
+				pipelineCondition.wait(lock, [&]{return nextItem < items.size() || readerDone;});
+				if(nextItem >= items.size())
+					break;
+				i = nextItem++;
+				item = items[i];
+				pBlock = blocks[item.block].get();
+			}
+			OsmapClock start;
+			int n = pBlock->feature_size();
+			if(item.index < n)
+				deserialize(pBlock->feature(item.index), item.pKF);
+			else
+				deserialize(pBlock->columnarfeature(item.index - n), item.pKF);
+			phaseRun(deserializePhase, start, item.pKF->N);
+			OsmapClock rebuildStart;
+			rebuildKeyFrame(item.pKF);
+			phaseRun(rebuildPhase, rebuildStart, 1);
+			{
+				lock_guard<mutex> lock(pipelineMutex);
+				items[i].ready = true;
+			}
+			pipelineCondition.notify_all();
+		}
+		if(deserializePhase.runs){
+			phaseAdd(deserializePhase);
+			phaseAdd(rebuildPhase);
+		}
+	};
+	vector<thread> pool;
+	for(unsigned int i=0; i<getThreads(); i++)
+		pool.emplace_back(worker);
+
+	// Linker
+	int nFeatures = 0;
+	OsmapPhase linkPhase;
+	linkPhase.name = "rebuild links";
+
+	/*
+	 * Keyframes without features in the file, before pUntil or all if NULL, are rebuilt and linked here, so every keyframe is linked in mnId order.
+	 * The file is in mnId order: a keyframe not streamed before a greater id one has no features in it.
+	 */
+	size_t nextKF = 0;
+	auto linkWithoutFeatures = [&](const OsmapKeyFrame *pUntil){
+		for(; nextKF < vectorKeyFrames.size() && (!pUntil || vectorKeyFrames[nextKF]->mnId < pUntil->mnId); nextKF++){
+			OsmapKeyFrame *pKF = vectorKeyFrames[nextKF];
+			{
+				lock_guard<mutex> lock(pipelineMutex);
+				if(!found.insert(pKF).second)
+					continue;
+			}
+			OsmapClock start;
+			rebuildKeyFrame(pKF);
+			linkKeyFrame(pKF);
+			phaseRun(linkPhase, start, 1);
+			keyFramesRebuilt.insert(pKF);
+			nFeatures += pKF->N;
+		}
+	};
+
+	for(size_t i=0; ; i++){
+		OsmapKeyFrame *pKF;
+		size_t block;
+		{
+			unique_lock<mutex> lock(pipelineMutex);
+			pipelineCondition.wait(lock, [&]{return (i < items.size() && items[i].ready) || (readerDone && i >= items.size());});
+			if(i >= items.size())
+				break;
+			pKF = items[i].pKF;
+			block = items[i].block;
+		}
+		linkWithoutFeatures(pKF);
+		OsmapClock start;
+		linkKeyFrame(pKF);
+		phaseRun(linkPhase, start, 1);
+		keyFramesRebuilt.insert(pKF);
+		nFeatures += pKF->N;
+		{
+			lock_guard<mutex> lock(pipelineMutex);
+			if(!--blocksRemaining[block]){
+				blocks[block].reset();
+				nBlocksReleased++;
+			}
+		}
+		pipelineCondition.notify_all();
+	}
+
+	reader.join();
+	for(auto &t : pool)
+		t.join();
+	linkWithoutFeatures(NULL);
+	if(linkPhase.runs)
+		phaseAdd(linkPhase);
+	if(!parsed)
+		cerr << "Error while parsing features." << endl;
+	cout << "Features loaded: " << nFeatures << ", keyframes rebuilt: " << keyFramesRebuilt.size() << endl;
+	return nFeatures;
 }
 
-void Osmap::setKeyFramesToMap(){
-	map.mspKeyFrames.clear();
-	copy(vectorKeyFrames.begin(), vectorKeyFrames.end(), inserter(map.mspKeyFrames, map.mspKeyFrames.end()));
+bool Osmap::featuresParse(string filename, vector<SerializedKeyframeFeaturesArray> &serializedFeatures){
+	OsmapMappedFile file(filename);
+	if(!file.isOpen){
+		cerr << "Couldn't open file " << filename << endl;
+		return false;
+	}
+	return featuresParse(file.data, file.size, serializedFeatures);
 }
 
+bool Osmap::featuresParse(const char *data, size_t size, vector<SerializedKeyframeFeaturesArray> &serializedFeatures){
+	if(!options[FEATURES_FILE_DELIMITED]){
+		serializedFeatures.resize(1);
+		return parse(data, size, serializedFeatures[0]);
+	}
 
+	size_t offset = 0;
+	while(true){
+		serializedFeatures.emplace_back();
+		if(!parseDelimited(data, size, offset, serializedFeatures.back())){
+			serializedFeatures.pop_back();
+			break;
+		}
+	}
+	return offset == size;
+}
 
-void Osmap::clearVectors(){
-	keyframeid2vectorkIdx.clear();
-	vectorKeyFrames.clear();
-	vectorMapPoints.clear();
-	vectorK.clear();
+bool Osmap::parseFile(string filename, google::protobuf::MessageLite &message){
+	OsmapMappedFile file(filename);
+	if(!file.isOpen){
+		cerr << "Couldn't open file " << filename << endl;
+		return false;
+	}
+	if(!parse(file.data, file.size, message)){
+		cerr << "Error while parsing file " << filename << endl;
+		return false;
+	}
+	return true;
 }
 
-void Osmap::parsePath(const string &path, string *filename, string *pathDirectory){
-	size_t pos = path.find_last_of("\\/");
+bool Osmap::parse(const char *data, size_t size, google::protobuf::MessageLite &message){
+	if(size > INT_MAX){
+		cerr << "Message too big to be parsed: " << size << " bytes." << endl;
+		return false;
+	}
+	google::protobuf::io::CodedInputStream input((const uint8_t*)data, size);
+#if GOOGLE_PROTOBUF_VERSION < 3011000
+	input.SetTotalBytesLimit(INT_MAX, INT_MAX);
+#else
+	input.SetTotalBytesLimit(INT_MAX);
+#endif
+	return message.ParseFromCodedStream(&input) && input.ConsumedEntireMessage();
+}
+
+bool Osmap::parseDelimited(const char *data, size_t size, size_t &offset, google::protobuf::MessageLite &message){
+	message.Clear();
+
+	// Size prefix, a varint32
+	size_t position = offset;
+	uint32_t messageSize = 0;
+	int shift = 0;
+	while(true){
+		if(position >= size || shift > 28) return false;
+		uint8_t byte = data[position++];
+		messageSize |= (uint32_t)(byte & 0x7F) << shift;
+		if(!(byte & 0x80)) break;
+		shift += 7;
+	}
+	if(position + messageSize > size){
+		cerr << "Truncated delimited message." << endl;
+		return false;
+	}
+
+	if(!parse(data + position, messageSize, message))
+		return false;
+	offset = position + messageSize;
+	return true;
+}
+
+/*
+ * Single file container numbers are little endian, regardless of the platform.
+ */
+static const char containerMagic[4] = {'O', 'S', 'M', 'P'};
+static const uint32_t containerVersion = 1;
+
+static void writeLittleEndian(ostream &file, uint64_t value, int bytes){
+	char buffer[8];
+	for(int i=0; i<bytes; i++)
+		buffer[i] = (char)(value >> (8*i));
+	file.write(buffer, bytes);
+}
+
+static uint64_t readLittleEndian(const char *data, int bytes){
+	uint64_t value = 0;
+	for(int i=0; i<bytes; i++)
+		value |= (uint64_t)(uint8_t)data[i] << (8*i);
+	return value;
+}
+
+void Osmap::writeContainerHeader(ostream &file, const vector<OsmapSection> &sectionTable){
+	file.write(containerMagic, 4);
+	writeLittleEndian(file, containerVersion, 4);
+	writeLittleEndian(file, sectionTable.size(), 4);
+	writeLittleEndian(file, 0, 4);
+	for(auto &section : sectionTable){
+		writeLittleEndian(file, section.type, 4);
+		writeLittleEndian(file, section.codec, 4);
+		writeLittleEndian(file, section.offset, 8);
+		writeLittleEndian(file, section.length, 8);
+	}
+}
+
+bool Osmap::readContainerHeader(const char *data, size_t size, vector<OsmapSection> &sectionTable){
+	sectionTable.clear();
+	if(size < 16 || memcmp(data, containerMagic, 4)){
+		cerr << "Not an osmap container." << endl;
+		return false;
+	}
+	uint32_t version = readLittleEndian(data + 4, 4);
+	if(version != containerVersion){
+		cerr << "Unknown osmap container version " << version << endl;
+		return false;
+	}
+	uint64_t nSections = readLittleEndian(data + 8, 4);
+	if(16 + 24*nSections > size){
+		cerr << "Truncated osmap container section table." << endl;
+		return false;
+	}
+	for(uint64_t i=0; i<nSections; i++){
+		const char *entry = data + 16 + 24*i;
+		OsmapSection section;
+		section.type   = readLittleEndian(entry, 4);
+		section.codec  = readLittleEndian(entry + 4, 4);
+		section.offset = readLittleEndian(entry + 8, 8);
+		section.length = readLittleEndian(entry + 16, 8);
+		if(section.offset > size || section.length > size - section.offset){
+			cerr << "Section " << section.type << " exceeds the osmap container." << endl;
+			return false;
+		}
+		if(section.codec >= CODECS_SIZE){
+			cerr << "Unknown codec " << section.codec << " in section " << section.type << endl;
+			return false;
+		}
+		sectionTable.push_back(section);
+	}
+	return true;
+}
+
+bool Osmap::compress(const string &raw, ostream &file){
+	// Chunks are compressed independently, each one to its own buffer
+	size_t nChunks = (raw.size() + OSMAP_CHUNK_SIZE - 1) / OSMAP_CHUNK_SIZE;
+	vector<string> chunks(nChunks);
+	atomic<bool> ok(true);
+	parallelFor(nChunks, [&](size_t i){
+#if defined(OSMAP_LZ4) || defined(OSMAP_ZSTD)
+		const char *src = raw.data() + i*OSMAP_CHUNK_SIZE;
+		size_t srcSize = min((size_t)OSMAP_CHUNK_SIZE, raw.size() - i*OSMAP_CHUNK_SIZE);
+#endif
+		string &chunk = chunks[i];
+		size_t n = 0;
+		switch(codec){
+#ifdef OSMAP_LZ4
+		case LZ4_CODEC:
+			chunk.resize(LZ4_compressBound(srcSize));
+			n = LZ4_compress_default(src, &chunk[0], srcSize, chunk.size());
+			break;
+#endif
+#ifdef OSMAP_ZSTD
+		case ZSTD_CODEC:
+			chunk.resize(ZSTD_compressBound(srcSize));
+			n = ZSTD_compress(&chunk[0], chunk.size(), src, srcSize, OSMAP_ZSTD_LEVEL);
+			if(ZSTD_isError(n)) n = 0;
+			break;
+#endif
+		default:
+			break;
+		}
+		if(!n) ok = false;
+		chunk.resize(n);
+	});
+	if(!ok){
+		cerr << "Error while compressing with codec " << codec << endl;
+		return false;
+	}
+
+	// Written in order, each chunk prefixed with its sizes
+	for(size_t i=0; i<nChunks; i++){
+		writeLittleEndian(file, min((size_t)OSMAP_CHUNK_SIZE, raw.size() - i*OSMAP_CHUNK_SIZE), 4);
+		writeLittleEndian(file, chunks[i].size(), 4);
+		file.write(chunks[i].data(), chunks[i].size());
+	}
+	return (bool)file;
+}
+
+bool Osmap::decompress(const char *data, size_t size, Codecs sectionCodec, string &raw){
+	raw.clear();
+	if(!codecAvailable(sectionCodec)){
+		cerr << "Codec " << sectionCodec << " not available in this build, section can't be loaded." << endl;
+		return false;
+	}
+
+	// Chunks' sizes first, to know where each chunk is and where it goes
+	struct Chunk{
+		const char *src;
+		size_t srcSize, dst, dstSize;
+	};
+	vector<Chunk> chunks;
+	size_t offset = 0, total = 0;
+	while(offset < size){
+		if(size - offset < 8){
+			cerr << "Truncated compressed section." << endl;
+			return false;
+		}
+		Chunk chunk;
+		chunk.dstSize = readLittleEndian(data + offset, 4);
+		chunk.srcSize = readLittleEndian(data + offset + 4, 4);
+		offset += 8;
+		if(chunk.srcSize > size - offset){
+			cerr << "Truncated compressed section." << endl;
+			return false;
+		}
+		chunk.src = data + offset;
+		chunk.dst = total;
+		chunks.push_back(chunk);
+		offset += chunk.srcSize;
+		total += chunk.dstSize;
+	}
+
+	raw.resize(total);
+	atomic<bool> ok(true);
+	parallelFor(chunks.size(), [&](size_t i){
+		const Chunk &chunk = chunks[i];
+		long long n = -1;
+		switch(sectionCodec){
+#ifdef OSMAP_LZ4
+		case LZ4_CODEC:
+			n = LZ4_decompress_safe(chunk.src, &raw[chunk.dst], chunk.srcSize, chunk.dstSize);
+			break;
+#endif
+#ifdef OSMAP_ZSTD
+		case ZSTD_CODEC:{
+			size_t result = ZSTD_decompress(&raw[chunk.dst], chunk.dstSize, chunk.src, chunk.srcSize);
+			if(!ZSTD_isError(result)) n = result;
+			break;
+		}
+#endif
+		default:
+			break;
+		}
+		if(n != (long long)chunk.dstSize) ok = false;
+	});
+	if(!ok){
+		cerr << "Error while decompressing with codec " << sectionCodec << endl;
+		raw.clear();
+	}
+	return ok;
+}
+
+bool Osmap::codecAvailable(Codecs codec){
+	switch(codec){
+	case NO_CODEC:
+		return true;
+#ifdef OSMAP_LZ4
+	case LZ4_CODEC:
+		return true;
+#endif
+#ifdef OSMAP_ZSTD
+	case ZSTD_CODEC:
+		return true;
+#endif
+	default:
+		return false;
+	}
+}
+
+/*
+ * JOURNAL option: compares fingerprints of objects with the ones of the last save, and replaces the latter.
+ * ids are in ascending order, objects with ids from watermark on are new.
+ * @returns positions of objects created or modified.  Ids no longer present are added to erased, if not NULL.
+ */
+static vector<size_t> journalChanges(const vector<unsigned int> &ids, const vector<size_t> &current, unsigned int watermark,
+		unordered_map<unsigned int, size_t> &fingerprints, google::protobuf::RepeatedField<uint32_t> *erased){
+	vector<size_t> changed;
+	unordered_map<unsigned int, size_t> updated;
+	updated.reserve(ids.size());
+	for(size_t i=0; i<ids.size(); i++){
+		if(ids[i] >= watermark)
+			changed.push_back(i);
+		else {
+			auto it = fingerprints.find(ids[i]);
+			if(it == fingerprints.end() || it->second != current[i])
+				changed.push_back(i);
+		}
+		updated[ids[i]] = current[i];
+	}
+
+	if(erased){
+		for(auto &fingerprint : fingerprints)
+			if(!updated.count(fingerprint.first))
+				erased->Add(fingerprint.first);
+		sort(erased->begin(), erased->end());
+	}
+	fingerprints.swap(updated);
+	return changed;
+}
+
+bitset<32> Osmap::getJournalOptions(){
+	bitset<32> journalOptions;
+	for(int option : {NO_MAPPOINTS_FILE, NO_KEYFRAMES_FILE, NO_FEATURES_FILE, NO_FEATURES_DESCRIPTORS, ONLY_MAPPOINTS_FEATURES, JOURNAL})
+		journalOptions[option] = options[option];
+	journalOptions.set(K_IN_KEYFRAME);
+	return journalOptions;
+}
+
+/**
+ * FNV-1a like hash, 8 bytes at a time.  Used for vocabulary and journal fingerprints.
+ */
+struct OsmapHash{
+	uint64_t hash = 14695981039346656037ULL;
+	void add(const void *data, size_t size){
+		const uchar *bytes = (const uchar*)data;
+		for(size_t i=0; i<size; i+=8){
+			uint64_t chunk = 0;
+			memcpy(&chunk, bytes + i, min<size_t>(8, size - i));
+			hash = (hash ^ chunk) * 1099511628211ULL;
+		}
+	}
+	void add(const Mat &m){
+		for(int row=0; row<m.rows; row++)
+			add(m.ptr(row), m.cols*m.elemSize());
+	}
+	void add(unsigned int n){
+		add(&n, sizeof(n));
+	}
+};
+
+uint64_t Osmap::vocabularyFingerprint(){
+	ORBVocabulary *pVocabulary = currentFrame.mpORBvocabulary;
+	if(!pVocabulary || !pVocabulary->size())
+		return 0;
+
+	// On the number of words, and every word's descriptor and weight
+	OsmapHash hash;
+	unsigned int n = pVocabulary->size();
+	hash.add(n);
+	for(unsigned int i=0; i<n; i++){
+		double weight = pVocabulary->getWordWeight(i);
+		hash.add(pVocabulary->getWord(i));
+		hash.add(&weight, sizeof(weight));
+	}
+	return hash.hash;
+}
+
+size_t Osmap::journalFingerprint(const OsmapMapPoint &mappoint){
+	OsmapHash hash;
+	hash.add(mappoint.mWorldPos);
+	hash.add(mappoint.mnVisible);
+	hash.add(mappoint.mnFound);
+	hash.add(mappoint.mDescriptor);
+	return hash.hash;
+}
+
+size_t Osmap::journalFingerprint(const OsmapKeyFrame &keyframe){
+	OsmapHash hash;
+	hash.add(keyframe.Tcw);
+	// Like serialize, only loop edges to previous keyframes
+	for(auto loopKF : keyframe.mspLoopEdges)
+		if(keyframe.mnId > loopKF->mnId)
+			hash.add(loopKF->mnId);
+	return hash.hash;
+}
+
+size_t Osmap::journalFeaturesFingerprint(const OsmapKeyFrame &keyframe){
+	OsmapHash hash;
+	for(auto pMP : keyframe.mvpMapPoints)
+		hash.add(pMP? pMP->mnId + 1 : 0);
+	return hash.hash;
+}
+
+void Osmap::journalFingerprints(SerializedJournalEntry *entry){
+	bitset<32> savedOptions = options;
+	options = getJournalOptions();
+
+	// MapPoints, hashed concurrently.  Only changed ones are serialized.
+	if(!options[NO_MAPPOINTS_FILE]){
+		size_t n = vectorMapPoints.size();
+		vector<unsigned int> ids(n);
+		vector<size_t> fingerprints(n);
+		parallelFor(n, [&](size_t i){
+			ids[i] = vectorMapPoints[i]->mnId;
+			fingerprints[i] = journalFingerprint(*vectorMapPoints[i]);
+		});
+		vector<size_t> changed = journalChanges(ids, fingerprints, mapPointWatermark, mapPointFingerprints, entry? entry->mutable_erasedmappointsids() : NULL);
+		if(entry){
+			entry->set_mappointwatermark(mapPointWatermark);
+			vector<SerializedMappoint*> messages;
+			for(size_t i : changed)
+				messages.push_back(entry->add_mappoint());
+			parallelFor(changed.size(), [&](size_t i){
+				serialize(*vectorMapPoints[changed[i]], messages[i]);
+			});
+		}
+		if(n) mapPointWatermark = max(entry? mapPointWatermark : 0, ids.back() + 1);
+	}
+
+	// KeyFrames
+	if(!options[NO_KEYFRAMES_FILE]){
+		size_t n = vectorKeyFrames.size();
+		vector<unsigned int> ids(n);
+		vector<size_t> fingerprints(n);
+		parallelFor(n, [&](size_t i){
+			ids[i] = vectorKeyFrames[i]->mnId;
+			fingerprints[i] = journalFingerprint(*vectorKeyFrames[i]);
+		});
+		vector<size_t> changed = journalChanges(ids, fingerprints, keyFrameWatermark, keyFrameFingerprints, entry? entry->mutable_erasedkeyframesids() : NULL);
+		if(entry){
+			entry->set_keyframewatermark(keyFrameWatermark);
+			vector<SerializedKeyframe*> messages;
+			for(size_t i : changed)
+				messages.push_back(entry->add_keyframe());
+			parallelFor(changed.size(), [&](size_t i){
+				serialize(*vectorKeyFrames[changed[i]], messages[i]);
+			});
+		}
+	}
+
+	// Features, by keyframe.  Features of erased keyframes are erased with them.
+	if(!options[NO_FEATURES_FILE]){
+		size_t n = vectorKeyFrames.size();
+		vector<unsigned int> ids(n);
+		vector<size_t> fingerprints(n);
+		parallelFor(n, [&](size_t i){
+			ids[i] = vectorKeyFrames[i]->mnId;
+			fingerprints[i] = journalFeaturesFingerprint(*vectorKeyFrames[i]);
+		});
+		vector<size_t> changed = journalChanges(ids, fingerprints, keyFrameWatermark, featuresFingerprints, NULL);
+		if(entry){
+			vector<SerializedKeyframeFeatures*> messages;
+			for(size_t i : changed)
+				messages.push_back(entry->add_features());
+			parallelFor(changed.size(), [&](size_t i){
+				serialize(*vectorKeyFrames[changed[i]], messages[i]);
+			});
+		}
+	}
+	if(!vectorKeyFrames.empty())
+		keyFrameWatermark = max(entry? keyFrameWatermark : 0, vectorKeyFrames.back()->mnId + 1);
+
+	options = savedOptions;
+}
+
+int Osmap::journalSave(string filename){
+	SerializedJournalEntry entry;
+	journalFingerprints(&entry);
+	int n = entry.mappoint_size() + entry.keyframe_size() + entry.features_size() + entry.erasedmappointsids_size() + entry.erasedkeyframesids_size();
+
+	// Appended, a save interrupted midway only loses its own entry
+	ofstream file(filename, ofstream::binary | ofstream::app);
+	{
+		// This Protocol Buffers stream must be deleted before closing file.  It happens automatically at }.
+		::google::protobuf::io::OstreamOutputStream protocolbuffersStream(&file);
+		if(!writeDelimitedTo(entry, &protocolbuffersStream))
+			n = -1;
+	}
+	file.close();
+	if(!file)
+		n = -1;
+
+	if(n < 0){
+		// Fingerprints are ahead of the journal, the next save must be a whole one
+		cerr << "Error while appending to journal " << filename << endl;
+		journalFilename.clear();
+	} else {
+		journalEntries++;
+		cout << "Journal " << filename << ", save " << journalEntries << ": " << entry.mappoint_size() << " mappoints, " << entry.keyframe_size() << " keyframes, "
+			 << entry.features_size() << " keyframes' features, " << entry.erasedmappointsids_size() << " mappoints and " << entry.erasedkeyframesids_size() << " keyframes erased." << endl;
+	}
+	return n;
+}
+
+int Osmap::journalLoad(string filename){
+	OsmapMappedFile file(filename);
+	if(!file.isOpen)
+		return 0;
+
+	bitset<32> savedOptions = options;
+	options = getJournalOptions();
+	auto mapPointLess = [](const MapPoint *a, unsigned int id){return a->mnId < id;};
+	auto keyFrameLess = [](const KeyFrame *a, unsigned int id){return a->mnId < id;};
+
+	int nEntries = 0;
+	size_t offset = 0;
+	SerializedJournalEntry entry;
+	while(offset < file.size && parseDelimited(file.data, file.size, offset, entry)){
+		// Erased keyframes and mappoints, and then their references in the remaining keyframes
+		set<KeyFrame*> erasedKeyFrames;
+		set<MapPoint*> erasedMapPoints;
+		for(unsigned int id : entry.erasedkeyframesids()){
+			auto it = lower_bound(vectorKeyFrames.begin(), vectorKeyFrames.end(), id, keyFrameLess);
+			if(it != vectorKeyFrames.end() && (*it)->mnId == id){
+				erasedKeyFrames.insert(*it);
+				vectorKeyFrames.erase(it);
+			}
+		}
+		for(unsigned int id : entry.erasedmappointsids()){
+			auto it = lower_bound(vectorMapPoints.begin(), vectorMapPoints.end(), id, mapPointLess);
+			if(it != vectorMapPoints.end() && (*it)->mnId == id){
+				erasedMapPoints.insert(*it);
+				vectorMapPoints.erase(it);
+			}
+		}
+		if(!erasedKeyFrames.empty() || !erasedMapPoints.empty()){
+			for(auto pKF : vectorKeyFrames){
+				for(auto &pMP : pKF->mvpMapPoints)
+					if(pMP && erasedMapPoints.count(pMP))
+						pMP = NULL;
+				for(auto pErasedKF : erasedKeyFrames)
+					pKF->mspLoopEdges.erase(pErasedKF);
+			}
+			for(auto pKF : erasedKeyFrames) delete pKF;
+			for(auto pMP : erasedMapPoints) delete pMP;
+		}
+
+		// MapPoints, updated in place so references to them remain valid, or created
+		for(const SerializedMappoint &serializedMappoint : entry.mappoint()){
+			auto it = lower_bound(vectorMapPoints.begin(), vectorMapPoints.end(), serializedMappoint.id(), mapPointLess);
+			if(it != vectorMapPoints.end() && (*it)->mnId == serializedMappoint.id())
+				deserialize(serializedMappoint, *it);
+			else
+				vectorMapPoints.insert(it, deserialize(serializedMappoint));
+		}
+		indexMapPoints();
+
+		// KeyFrames, in ascending id order, so loop edges are found
+		for(const SerializedKeyframe &serializedKeyframe : entry.keyframe()){
+			auto it = lower_bound(vectorKeyFrames.begin(), vectorKeyFrames.end(), serializedKeyframe.id(), keyFrameLess);
+			if(it != vectorKeyFrames.end() && (*it)->mnId == serializedKeyframe.id())
+				deserialize(serializedKeyframe, *it);
+			else
+				vectorKeyFrames.insert(it, deserialize(serializedKeyframe));
+		}
+
+		// Features, replacing the keyframe's ones
+		for(const SerializedKeyframeFeatures &serializedKeyframeFeatures : entry.features())
+			deserialize(serializedKeyframeFeatures);
+
+		nEntries++;
+	}
+	if(offset < file.size)
+		cerr << "Journal " << filename << " is truncated after " << nEntries << " saves, the rest is ignored." << endl;
+
+	options = savedOptions;
+	cout << "Journal saves replayed: " << nEntries << endl;
+	return nEntries;
+}
+
+/*
+ * Camera center in world coordinates, -R^t t, from a 4x4 pose.  Feature pager and tiles use it.
+ */
+static void poseCenter(const Mat &Tcw, float *center){
+	for(int i=0; i<3; i++)
+		center[i] = -(Tcw.at<float>(0,i)*Tcw.at<float>(0,3) + Tcw.at<float>(1,i)*Tcw.at<float>(1,3) + Tcw.at<float>(2,i)*Tcw.at<float>(2,3));
+}
+
+bool Osmap::pageOpen(string filename){
+	pageClose();
+	pageFileDescriptor = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if(pageFileDescriptor < 0){
+		cerr << "Couldn't create page file " << filename << endl;
+		return false;
+	}
+	pageFilename = filename;
+	pageFileSize = 0;
+	return true;
+}
+
+void Osmap::pageClose(){
+	if(pageFileDescriptor < 0)
+		return;
+	pageInAll();
+	pages.clear();
+	close(pageFileDescriptor);
+	unlink(pageFilename.c_str());
+	pageFileDescriptor = -1;
+	pageFilename.clear();
+	pageFileSize = 0;
+}
+
+int Osmap::pageUpdate(const Mat &Tcw){
+	if(pageFileDescriptor < 0)
+		return 0;
+
+	/*
+	 * Local mapping, loop closing with its global bundle adjustment, and relocalization read features of any keyframe.
+	 * Pages out only in localization mode, with local mapping stopped, no global bundle adjustment running and tracking not lost.
+	 * Otherwise every keyframe is paged in.
+	 */
+	if(!system.mpTracker->mbOnlyTracking || !system.mpLocalMapper->isStopped() || system.mpLoopCloser->isRunningGBA()
+			|| system.mpTracker->mState == ORB_SLAM2::Tracking::LOST){
+		pageInAll();
+		return 0;
+	}
+	if(Tcw.empty())
+		return 0;
+
+	float camera[3];
+	poseCenter(Tcw, camera);
+
+#ifdef OSMAP_DUMMY_MAP
+	vector<KeyFrame*> keyframes(map.mspKeyFrames.begin(), map.mspKeyFrames.end());
+#else
+	vector<KeyFrame*> keyframes = map.GetAllKeyFrames();
+#endif
+
+	// Seeds: keyframes closer than pageInDistance, and resident ones closer than pageOutDistance
+	vector<float> distances(keyframes.size());
+	unordered_set<KeyFrame*> pinned, frontier;
+	for(size_t i=0; i<keyframes.size(); i++){
+		KeyFrame *pKF = keyframes[i];
+		float center[3];
+#ifdef OSMAP_DUMMY_MAP
+		poseCenter(static_cast<OsmapKeyFrame*>(pKF)->Tcw, center);
+#else
+		poseCenter(pKF->GetPose(), center);
+#endif
+		float dx = center[0]-camera[0], dy = center[1]-camera[1], dz = center[2]-camera[2];
+		distances[i] = sqrt(dx*dx + dy*dy + dz*dz);
+
+		auto it = pages.find(pKF);
+		bool paged = it != pages.end() && it->second.paged;
+		if(distances[i] < pageInDistance || (!paged && distances[i] <= pageOutDistance))
+			frontier.insert(pKF);
+	}
+
+	/*
+	 * Pinned keyframes: seeds, and keyframes two mappoint observations away from them.
+	 * They make up the local map of tracking and local mapping, and the keyframes fusion and local bundle adjustment read features from.
+	 */
+	pinned = frontier;
+	for(int level=0; level<2; level++){
+		unordered_set<KeyFrame*> next;
+		for(KeyFrame *pKF : frontier){
+#ifdef OSMAP_DUMMY_MAP
+			vector<MapPoint*> &mapPoints = pKF->mvpMapPoints;
+#else
+			vector<MapPoint*> mapPoints = pKF->GetMapPointMatches();
+#endif
+			for(MapPoint *pMP : mapPoints){
+				if(!pMP) continue;
+#ifdef OSMAP_DUMMY_MAP
+				std::map<KeyFrame*, size_t> &observations = pMP->mObservations;
+#else
+				std::map<KeyFrame*, size_t> observations = pMP->GetObservations();
+#endif
+				for(auto &observation : observations)
+					if(pinned.insert(observation.first).second)
+						next.insert(observation.first);
+			}
+		}
+		frontier.swap(next);
+	}
+
+	int nPaged = 0;
+	for(size_t i=0; i<keyframes.size(); i++){
+		KeyFrame *pKF = keyframes[i];
+		OsmapKeyFrame *pOKF = static_cast<OsmapKeyFrame*>(pKF);
+		auto it = pages.find(pKF);
+		if(it == pages.end() || !it->second.paged){
+			// In memory, paged out if far and not pinned
+			if(distances[i] > pageOutDistance && !pinned.count(pKF) && !pOKF->mbBad && pageOut(pOKF, pages[pKF]))
+				nPaged++;
+		} else {
+			OsmapPage &page = it->second;
+			if(pinned.count(pKF))
+				// Pinned: paged in right away
+				pageIn(pOKF, page, page.loading.valid()? page.loading.get() : pageRead(page));
+			else if(page.loading.valid()){
+				// Being read
+				if(page.loading.wait_for(chrono::seconds(0)) == future_status::ready)
+					pageIn(pOKF, page, page.loading.get());
+			} else if(distances[i] <= pageOutDistance)
+				// Approaching: read ahead
+				page.loading = async(launch::async, [this, &page]{return pageRead(page);});
+			if(page.paged)
+				nPaged++;
+		}
+	}
+
+	log("Keyframes paged out:", nPaged);
+	return nPaged;
+}
+
+void Osmap::pageInAll(){
+	for(auto &keyframePage : pages){
+		OsmapPage &page = keyframePage.second;
+		if(page.paged)
+			pageIn(static_cast<OsmapKeyFrame*>(keyframePage.first), page, page.loading.valid()? page.loading.get() : pageRead(page));
+	}
+}
+
+bool Osmap::pageOut(OsmapKeyFrame *pKF, OsmapPage &page){
+#ifndef OSMAP_DUMMY_MAP
+	unique_lock<mutex> lock(pKF->mMutexFeatures);
+#endif
+	// Written once, keypoints and descriptors don't change.  Plain encoding, lossless, whatever the options.
+	if(!page.size){
+		SerializedKeyframeFeatures serializedKeyframeFeatures;
+		serializedKeyframeFeatures.set_keyframe_id(pKF->mnId);
+		for(int i=0; i<pKF->N; i++){
+			SerializedFeature *feature = serializedKeyframeFeatures.add_feature();
+			const KeyPoint &kp = pKF->mvKeysUn[i];
+			SerializedKeypoint *keypoint = feature->mutable_keypoint();
+			keypoint->set_ptx(kp.pt.x);
+			keypoint->set_pty(kp.pt.y);
+			keypoint->set_angle(kp.angle);
+			keypoint->set_octave(kp.octave);
+			serialize(pKF->mDescriptors.row(i), feature->mutable_briefdescriptor());
+		}
+
+		string record = serializedKeyframeFeatures.SerializeAsString();
+		if(pwrite(pageFileDescriptor, record.data(), record.size(), pageFileSize) != (ssize_t)record.size()){
+			cerr << "Couldn't write keyframe " << pKF->mnId << " features to page file " << pageFilename << endl;
+			return false;
+		}
+		page.offset = pageFileSize;
+		page.size = record.size();
+		pageFileSize += record.size();
+	}
+
+	// Release features, N and mvpMapPoints remain
+	vector<KeyPoint>().swap(const_cast<vector<KeyPoint>&>(pKF->mvKeysUn));
+	const_cast<Mat&>(pKF->mDescriptors) = Mat();
+	for(auto &column : pKF->mGrid)
+		for(auto &cell : column)
+			vector<size_t>().swap(cell);
+#ifndef OSMAP_DUMMY_MAP
+	pKF->mFeatVec.clear();
+#endif
+	page.paged = true;
+	return true;
+}
+
+void Osmap::pageIn(OsmapKeyFrame *pKF, OsmapPage &page, const string &record){
+	SerializedKeyframeFeatures serializedKeyframeFeatures;
+	int n = pKF->N;
+	if(!serializedKeyframeFeatures.ParseFromString(record) || serializedKeyframeFeatures.feature_size() != n){
+		cerr << "Couldn't read keyframe " << pKF->mnId << " features from page file " << pageFilename << ", left paged out." << endl;
+		return;
+	}
+
+	// Features are decoded aside, and then swapped in.  Plain encoding, as pageOut writes them.
+	vector<KeyPoint> keys(n);
+	Mat descriptors(n, 32, CV_8UC1);
+	for(int i=0; i<n; i++){
+		const SerializedFeature &feature = serializedKeyframeFeatures.feature(i);
+		const SerializedKeypoint &keypoint = feature.keypoint();
+		keys[i].pt.x = keypoint.ptx();
+		keys[i].pt.y = keypoint.pty();
+		keys[i].angle = keypoint.angle();
+		keys[i].octave = keypoint.octave();
+		Mat descriptor;
+		deserialize(feature.briefdescriptor(), descriptor);
+		descriptor.copyTo(descriptors.row(i));
+	}
+
+#ifndef OSMAP_DUMMY_MAP
+	// BoW feature vector, leaving mBowVec untouched as the keyframe database uses it
+	DBoW2::BowVector bowVec;
+	DBoW2::FeatureVector featVec;
+	pKF->mpORBvocabulary->transform(Converter::toDescriptorVector(descriptors), bowVec, featVec, 4);
+	unique_lock<mutex> lock(pKF->mMutexFeatures);
+	pKF->mFeatVec = featVec;
+#endif
+	const_cast<vector<KeyPoint>&>(pKF->mvKeysUn).swap(keys);
+	const_cast<Mat&>(pKF->mDescriptors) = descriptors;
+	rebuildGrid(pKF);
+	page.paged = false;
+}
+
+string Osmap::pageRead(const OsmapPage &page){
+	string record(page.size, '\0');
+	size_t done = 0;
+	while(done < page.size){
+		ssize_t n = pread(pageFileDescriptor, &record[done], page.size - done, page.offset + done);
+		if(n <= 0){
+			record.clear();
+			break;
+		}
+		done += n;
+	}
+	return record;
+}
+
+void Osmap::getTiles(){
+	// Tiles by cell, ordered
+	std::map<tuple<int, int, int>, OsmapTile> cells;
+	auto cellOf = [this](const float *position){
+		return make_tuple((int)floor(position[0]/tileSize), (int)floor(position[1]/tileSize), (int)floor(position[2]/tileSize));
+	};
+
+	// Mappoints by position
+	unordered_map<const MapPoint*, tuple<int, int, int>> mappointCells;
+	for(OsmapMapPoint *pMP : vectorMapPoints){
+		float position[3];
+		for(int i=0; i<3; i++)
+			position[i] = pMP->mWorldPos.at<float>(i);
+		auto cell = cellOf(position);
+		cells[cell].mappoints.push_back(pMP);
+		mappointCells[pMP] = cell;
+	}
+
+	// Keyframes by camera center, with the mappoints they observe in other cells
+	for(OsmapKeyFrame *pKF : vectorKeyFrames){
+		float center[3];
+		poseCenter(pKF->Tcw, center);
+		auto cell = cellOf(center);
+		OsmapTile &tile = cells[cell];
+		tile.keyframes.push_back(pKF);
+		for(MapPoint *pMP : pKF->mvpMapPoints){
+			auto it = mappointCells.find(pMP);
+			if(it != mappointCells.end() && it->second != cell)
+				tile.mappoints.push_back(static_cast<OsmapMapPoint*>(pMP));
+		}
+	}
+
+	tiles.clear();
+	tiles.reserve(cells.size());
+	for(auto &cell : cells){
+		OsmapTile &tile = cell.second;
+		tie(tile.x, tile.y, tile.z) = cell.first;
+		sort(tile.mappoints.begin(), tile.mappoints.end(), [](const MapPoint* a, const MapPoint* b){return a->mnId < b->mnId;});
+		tile.mappoints.erase(unique(tile.mappoints.begin(), tile.mappoints.end()), tile.mappoints.end());
+		tiles.push_back(move(tile));
+	}
+	cout << "Tiles: " << tiles.size() << endl;
+}
+
+int Osmap::tilesSave(ostream &file, SectionTypes type){
+	int n = 0, i = type - MAPPOINTS_SECTION;
+	bool ok = true;
+	string name = sectionNames[type];
+	for(auto &tile : tiles){
+		// Tile serialized in memory
+		OsmapClock start;
+		int nTile = 0;
+		string raw;
+		if(type == MAPPOINTS_SECTION){
+			SerializedMappointArray serializedMappointArray;
+			nTile = serialize(tile.mappoints, serializedMappointArray);
+			ok &= serializedMappointArray.SerializeToString(&raw);
+		} else if(type == KEYFRAMES_SECTION){
+			SerializedKeyframeArray serializedKeyframeArray;
+			nTile = serialize(tile.keyframes, serializedKeyframeArray);
+			ok &= serializedKeyframeArray.SerializeToString(&raw);
+		} else {
+			// Delimited blocks of no more than FEATURES_MESSAGE_LIMIT features, like in featuresSave
+			::google::protobuf::io::StringOutputStream protocolbuffersStream(&raw);
+			auto it = tile.keyframes.begin();
+			while(it != tile.keyframes.end()){
+				vector<OsmapKeyFrame*> vectorBlock;
+				unsigned int nBlock = 0;
+				do{
+					nBlock += (*it)->N;
+					vectorBlock.push_back(*it);
+					++it;
+				} while(it != tile.keyframes.end() && nBlock + (*it)->N <= FEATURES_MESSAGE_LIMIT);
+				SerializedKeyframeFeaturesArray serializedKeyframeFeaturesArray;
+				nTile += serialize(vectorBlock, serializedKeyframeFeaturesArray);
+				ok &= writeDelimitedTo(serializedKeyframeFeaturesArray, &protocolbuffersStream);
+			}
+		}
+
+		n += nTile;
+		phaseEnd(name + " serialize", start, nTile, raw.size());
+
+		// Each tile compressed on its own, so it can be decompressed without the others
+		OsmapClock writeStart;
+		uint64_t offset = file.tellp();
+		if(codec == NO_CODEC)
+			file.write(raw.data(), raw.size());
+		else
+			ok &= compress(raw, file);
+		tile.length[i] = (uint64_t)file.tellp() - offset;
+		phaseEnd(name + (codec == NO_CODEC? " write" : " compress"), writeStart, 0, tile.length[i]);
+	}
+
+	// Mappoints in several tiles are counted once
+	if(type == MAPPOINTS_SECTION)
+		n = vectorMapPoints.size();
+
+	return ok && file? n : -1;
+}
+
+void Osmap::mergeTiles(SerializedMappointArray &serializedMappointArray){
+	auto &mappoints = *serializedMappointArray.mutable_mappoint();
+	sort(mappoints.pointer_begin(), mappoints.pointer_end(), [](const SerializedMappoint *a, const SerializedMappoint *b){return a->id() < b->id();});
+
+	// Repeated ones are adjacent, the first of each id is kept
+	int n = 0;
+	for(int i=0; i<mappoints.size(); i++)
+		if(!n || mappoints.Get(i).id() != mappoints.Get(n-1).id())
+			mappoints.SwapElements(i, n++);
+	mappoints.DeleteSubrange(n, mappoints.size() - n);
+}
+
+void Osmap::mergeTiles(SerializedKeyframeArray &serializedKeyframeArray){
+	auto &keyframes = *serializedKeyframeArray.mutable_keyframe();
+	sort(keyframes.pointer_begin(), keyframes.pointer_end(), [](const SerializedKeyframe *a, const SerializedKeyframe *b){return a->id() < b->id();});
+
+	// Loop edges only to loaded keyframes
+	unordered_set<unsigned int> ids;
+	for(auto &serializedKeyframe : keyframes)
+		ids.insert(serializedKeyframe.id());
+	for(auto &serializedKeyframe : keyframes){
+		auto &loops = *serializedKeyframe.mutable_loopedgesids();
+		int n = 0;
+		for(unsigned int id : loops)
+			if(ids.count(id))
+				loops.Set(n++, id);
+		loops.Truncate(n);
+	}
+}
+
+int Osmap::eraseUnobservedMapPoints(){
+	unordered_set<MapPoint*> observed;
+	for(auto *pKF : vectorKeyFrames)
+		for(MapPoint *pMP : pKF->mvpMapPoints)
+			if(pMP)
+				observed.insert(pMP);
+
+	size_t n = vectorMapPoints.size();
+	vectorMapPoints.erase(remove_if(vectorMapPoints.begin(), vectorMapPoints.end(), [&](OsmapMapPoint *pMP){
+		if(observed.count(pMP))
+			return false;
+		delete pMP;
+		return true;
+	}), vectorMapPoints.end());
+
+	// Features are already linked, the index must not keep deleted mappoints
+	indexMapPoints();
+
+	return n - vectorMapPoints.size();
+}
+
+void Osmap::getMapPointsFromMap(){
+	  OsmapClock start;
+	  vectorMapPoints.clear();
+	  vectorMapPoints.reserve(map.mspMapPoints.size());
+	  std::transform(map.mspMapPoints.begin(), map.mspMapPoints.end(), std::back_inserter(vectorMapPoints), [](MapPoint *pMP)->OsmapMapPoint*{return static_cast<OsmapMapPoint*>(pMP);});
+	  sort(vectorMapPoints.begin(), vectorMapPoints.end(), [](const MapPoint* a, const MapPoint* b){return a->mnId < b->mnId;});
+	  phaseEnd("getMapPointsFromMap", start, vectorMapPoints.size());
+}
+
+void Osmap::setMapPointsToMap(){
+	map.mspMapPoints.clear();
+	copy(vectorMapPoints.begin(), vectorMapPoints.end(), inserter(map.mspMapPoints, map.mspMapPoints.end()));
+}
+
+void Osmap::getKeyFramesFromMap(){
+	// Order keyframes by mnId
+	OsmapClock start;
+	vectorKeyFrames.clear();
+	vectorKeyFrames.reserve(map.mspKeyFrames.size());
+	std::transform(map.mspKeyFrames.begin(), map.mspKeyFrames.end(), std::back_inserter(vectorKeyFrames), [](KeyFrame *pKF)->OsmapKeyFrame*{return static_cast<OsmapKeyFrame*>(pKF);});
+	sort(vectorKeyFrames.begin(), vectorKeyFrames.end(), [](const KeyFrame *a, const KeyFrame *b){return a->mnId < b->mnId;});
+	phaseEnd("getKeyFramesFromMap", start, vectorKeyFrames.size());
+}
+
+void Osmap::setKeyFramesToMap(){
+	map.mspKeyFrames.clear();
+	copy(vectorKeyFrames.begin(), vectorKeyFrames.end(), inserter(map.mspKeyFrames, map.mspKeyFrames.end()));
+}
+
+
+
+void Osmap::clearVectors(){
+	keyframeid2vectorkIdx.clear();
+	vectorKeyFrames.clear();
+	vectorMapPoints.clear();
+	mapPointsDenseIndex.clear();
+	mapPointsHashIndex.clear();
+	lastKeyFrameIdx = 0;
+	vectorK.clear();
+	tiles.clear();
+	keyFrameConnections.clear();
+	mapPointRefKeyFrameIds.clear();
+	keyFramesRebuilt.clear();
+}
+
+void Osmap::parsePath(const string &path, string *filename, string *pathDirectory){
+	size_t pos = path.find_last_of("\\/");
 	if(std::string::npos == pos)
 		// No directory separator, file is assumed.
 		pos = 0;
@@ -515,78 +2469,39 @@ void Osmap::depurate(){
 
 void Osmap::rebuild(bool noSetBad){
 	/*
-	 * On every KeyFrame:
-	 * - Builds the map database
-	 * - UpdateConnections to rebuild covisibility graph
-	 * - MapPoint::AddObservation on each point to rebuild MapPoint:mObservations y MapPoint:mObs
+	 * Stages:
+	 * - Keyframe-local stages on every KeyFrame, in parallel: BoW, pose and grid
+	 * - On every KeyFrame in mnId order:
+	 *   - Builds the map database, unless it was loaded
+	 *   - MapPoint::AddObservation on each point to rebuild MapPoint:mObservations y MapPoint:mObs
+	 *   - UpdateConnections to rebuild covisibility graph
+	 * - Spanning tree repair
+	 * - Mappoint-local stages on every MapPoint, in parallel: UpdateNormalAndDepth
 	 */
 	cout << "Rebuilding map:" << endl;
-	keyFrameDatabase.clear();
+	if(!keyFrameDatabaseLoaded && keyFramesRebuilt.empty())
+		keyFrameDatabase.clear();
 
 	if(noSetBad)
 		options.set(NO_SET_BAD);
 
-	log("Processing", vectorKeyFrames.size(), "keyframes");
-	for(auto *pKF : vectorKeyFrames){
-		LOGV(pKF);
-		LOGV(pKF->mnId);
-
-		pKF->mbNotErase = !pKF->mspLoopEdges.empty();
-		LOGV(pKF->mbNotErase);
-
-		// Build BoW vectors
-		pKF->ComputeBoW();
-		log("BoW computed");
-
-		// Build many pose matrices
-		pKF->SetPose(pKF->Tcw);
-		log("Pose set");
-
-		/*
-		 * Rebuilding grid.
-		 * Code from Frame::AssignFeaturesToGrid()
-		 */
-		std::vector<std::size_t> grid[pKF->mnGridCols][pKF->mnGridRows];
-		int nReserve = 0.5f*pKF->N/(pKF->mnGridCols*pKF->mnGridRows);
-		for(int i=0; i<pKF->mnGridCols;i++)
-			for (int j=0; j<pKF->mnGridRows;j++)
-				grid[i][j].reserve(nReserve);
-		log("Grid built");
-
-		for(int i=0;i<pKF->N;i++){
-			const cv::KeyPoint &kp = pKF->mvKeysUn[i];
-			int posX = round((kp.pt.x-pKF->mnMinX)*pKF->mfGridElementWidthInv);
-			int posY = round((kp.pt.y-pKF->mnMinY)*pKF->mfGridElementHeightInv);
-
-			//Keypoint's coordinates are undistorted, which could cause to go out of the image
-			if(!(posX<0 || posX>=pKF->mnGridCols || posY<0 || posY>=pKF->mnGridRows))
-				grid[posX][posY].push_back(i);
-		}
-		log("Grid full");
-
-		pKF->mGrid.resize(pKF->mnGridCols);
-		for(int i=0; i < pKF->mnGridCols;i++){
-			pKF->mGrid[i].resize(pKF->mnGridRows);
-			for(int j=0; j < pKF->mnGridRows; j++)
-				pKF->mGrid[i][j] = grid[i][j];
-		}
-		log("Grid fitted");
-
-		// Append keyframe to the database
-		keyFrameDatabase.add(pKF);
-
-		// Rebuild MapPoints obvervations
-		size_t n = pKF->mvpMapPoints.size();
-		for(size_t i=0; i<n; i++){
-			MapPoint *pMP = pKF->mvpMapPoints[i];
-			if(pMP)
-				pMP->AddObservation(pKF, i);
-		}
-		log("Observations rebuilt");
-
-		// Calling UpdateConnections in mnId order rebuilds the covisibility graph and the spanning tree.
-		pKF->UpdateConnections();
-	}
+	// Keyframes rebuilt while loading features are skipped
+	size_t nPending = vectorKeyFrames.size() - keyFramesRebuilt.size();
+	log("Processing", nPending, "keyframes");
+	OsmapClock start;
+	parallelFor(vectorKeyFrames.size(), [&](size_t i){
+		if(!keyFramesRebuilt.count(vectorKeyFrames[i]))
+			rebuildKeyFrame(vectorKeyFrames[i]);
+	});
+	if(nPending)
+		phaseEnd("rebuild keyframes", start, nPending);
+
+	start = OsmapClock();
+	for(auto *pKF : vectorKeyFrames)
+		if(!keyFramesRebuilt.count(pKF))
+			linkKeyFrame(pKF);
+	if(nPending)
+		phaseEnd("rebuild links", start, nPending);
 
 	// Last KeyFrame's id
 	map.mnMaxKFid = vectorKeyFrames.back()->mnId;
@@ -595,57 +2510,140 @@ void Osmap::rebuild(bool noSetBad){
 	KeyFrame::nNextId = map.mnMaxKFid + 1;
 
 	// Retry on isolated keyframes
+	start = OsmapClock();
+	int nIsolated = 0;
 	for(auto *pKF : vectorKeyFrames)
 		if(pKF->mConnectedKeyFrameWeights.empty()){
+			nIsolated++;
 			log("Isolated keyframe pKF:", pKF);
 			pKF->UpdateConnections();
-			if(!options[NO_SET_BAD] && pKF->mConnectedKeyFrameWeights.empty() && pKF->mnId){
-				// If this keyframe is isolated (and it isn't keyframe zero), erase it.
+			if(!options[NO_SET_BAD] && pKF->mConnectedKeyFrameWeights.empty() && pKF != vectorKeyFrames.front()){
+				// If this keyframe is isolated (and it isn't the first one), erase it.
 				cerr << "Isolated keyframe " << pKF->mnId << " set bad." << endl;
 				pKF->SetBadFlag();
 			}
 		}
+	phaseEnd("rebuild isolated", start, nIsolated);
 
 
 
 	/*
 	 * Check and fix the spanning tree created with UpdateConnections.
-	 * Rebuilds the spanning tree asigning a mpParent to every orphan KeyFrame without, except that with id 0.
- 	 * It ends when every KeyFrame has a parent.
+	 * Keyframes hanging from the root through their parents are in the tree.  The root is the first keyframe, id 0 unless only part of a tiled map is loaded.
+	 * A breadth first traversal of the covisibility graph from them attaches every keyframe it reaches out of the tree, with its subtree,
+	 * to the keyframe's strongest connection already in the tree.  One pass, each keyframe and connection visited once.
+	 * A reached keyframe out of the tree is an orphan, or hangs from a parent cycle, which is broken this way.
+	 * Orphans left are unreachable from the root: each one roots its own component, traversed the same way, and components are reported.
 	 */
+	start = OsmapClock();
+	KeyFrame *root = vectorKeyFrames.front();
 
 	// mvpKeyFrameOrigins should be empty at this point, and must contain only one element, the first keyframe.
 	map.mvpKeyFrameOrigins.clear();
 	map.mvpKeyFrameOrigins.push_back(*vectorKeyFrames.begin());
 
-	// Number of parents assigned in each iteration and in total.  Usually 0.
-	int nParents = -1, nParentsTotal = 0;
 	log("Rebuilding spanning tree.");
-	while(nParents){
-		nParents = 0;
-		for(auto pKF: vectorKeyFrames)
-			if(!pKF->mpParent && pKF->mnId)	// Process all keyframes without parent, exccept id 0
-				for(auto *pConnectedKF : pKF->mvpOrderedConnectedKeyFrames){
-					auto poConnectedKF = static_cast<OsmapKeyFrame*>(pConnectedKF);
-					if(poConnectedKF->mpParent || poConnectedKF->mnId == 0){	// Parent found: not orphan or id 0
-						nParents++;
-						pKF->ChangeParent(pConnectedKF);
+	size_t nKF = vectorKeyFrames.size();
+
+	// Keyframes' positions by id, -1 for keyframes not loaded
+	vector<int> positionById(vectorKeyFrames.back()->mnId + 1, -1);
+	for(size_t i=0; i<nKF; i++)
+		positionById[vectorKeyFrames[i]->mnId] = i;
+	auto position = [&](KeyFrame *pKF){
+		int i = pKF && pKF->mnId < positionById.size()? positionById[pKF->mnId] : -1;
+		return i >= 0 && vectorKeyFrames[i] == pKF? i : -1;
+	};
+
+	// Children by position, from parents
+	vector<vector<size_t>> children(nKF);
+	for(size_t i=0; i<nKF; i++){
+		int parent = position(vectorKeyFrames[i]->mpParent);
+		if(parent >= 0)
+			children[parent].push_back(i);
+	}
+
+	// Keyframes in the tree, in the order they are traversed.  A keyframe joins with its subtree.
+	vector<bool> inTree(nKF, false);
+	vector<size_t> queue;
+	queue.reserve(nKF);
+	auto addSubtree = [&](size_t i){
+		inTree[i] = true;
+		queue.push_back(i);
+		for(size_t j = queue.size() - 1; j < queue.size(); j++)
+			for(size_t child : children[queue[j]])
+				if(!inTree[child]){
+					inTree[child] = true;
+					queue.push_back(child);
+				}
+	};
+
+	int nParents = 0;
+	size_t head = 0;
+	auto traverse = [&](){
+		for(; head < queue.size(); head++)
+			for(auto *pConnectedKF : vectorKeyFrames[queue[head]]->mvpOrderedConnectedKeyFrames){
+				int i = position(pConnectedKF);
+				OsmapKeyFrame *pOrphan = i >= 0? vectorKeyFrames[i] : NULL;
+				if(!pOrphan || inTree[i] || pOrphan->mbBad)
+					continue;
+
+				// Orphan's strongest connection in the tree, at least the keyframe that reached it
+				KeyFrame *pParent = vectorKeyFrames[queue[head]];
+				for(auto *pCandidate : pOrphan->mvpOrderedConnectedKeyFrames){
+					int candidate = position(pCandidate);
+					if(candidate >= 0 && inTree[candidate]){
+						pParent = pCandidate;
 						break;
 					}
 				}
-		nParentsTotal += nParents;
-		log("Parents assigned in this loop:", nParents);
-	}
-	log("Parents assigned in total:", nParentsTotal);
+#ifndef OSMAP_DUMMY_MAP
+				if(pOrphan->mpParent)
+					pOrphan->mpParent->EraseChild(pOrphan);
+#endif
+				pOrphan->ChangeParent(pParent);
+				nParents++;
+				addSubtree(i);
+			}
+	};
+	addSubtree(0);
+	traverse();
+	log("Parents assigned:", nParents);
+
+	// Components unreachable from the root, each one rooted on its first orphan
+	int nComponents = 0;
+	size_t nUnreachable = 0;
+	for(size_t i=0; i<nKF; i++)
+		if(!inTree[i] && !vectorKeyFrames[i]->mpParent && !vectorKeyFrames[i]->mbBad){
+			size_t first = queue.size();
+			addSubtree(i);
+			traverse();
+			nComponents++;
+			nUnreachable += queue.size() - first;
+			log("Unreachable component from keyframe", vectorKeyFrames[i]->mnId, "keyframes:", queue.size() - first);
+		}
+	if(nComponents)
+		cerr << "Keyframes unreachable from the root keyframe " << root->mnId << ": " << nUnreachable << ", connected components: " << nComponents << endl;
+
+	// Keyframes left have a parent, but their parents' chain ends in a cycle not reachable from any orphan
+	size_t nLeft = 0;
+	for(size_t i=0; i<nKF; i++)
+		nLeft += !inTree[i] && !vectorKeyFrames[i]->mbBad;
+	if(nLeft)
+		cerr << "Keyframes in parent cycles: " << nLeft << endl;
+	phaseEnd("rebuild spanning tree", start, nParents);
 
 	/*
 	 * On every MapPoint:
-	 * - Rebuilds mpRefKF as the first observation, which should be the KeyFrame with the lowest id
-	 * - Rebuilds many properties with UpdateNormalAndDepth()
+	 * - Rebuilds mpRefKF as the saved one, or else as the first observation, which should be the KeyFrame with the lowest id
+	 * - Rebuilds many properties with UpdateNormalAndDepth(), unless they were loaded
+	 *
+	 * Setting bad flags touches keyframes and map, so it is done serially, before the parallel stage.
 	 */
 	log("Processing", vectorMapPoints.size(), "mappoints.");
+	start = OsmapClock();
+	vector<OsmapMapPoint*> vectorGoodMapPoints;
+	vectorGoodMapPoints.reserve(vectorMapPoints.size());
 	for(OsmapMapPoint *pMP : vectorMapPoints){
-		LOGV(pMP)
 		LOGV(pMP->mnId)
 		// Rebuilds mpRefKF.  Requires mObservations.
 		if(!options[NO_SET_BAD] && pMP->mnId && pMP->mObservations.empty()){
@@ -653,19 +2651,128 @@ void Osmap::rebuild(bool noSetBad){
 			pMP->SetBadFlag();
 			continue;
 		}
+		if(pMP->mObservations.empty())
+			continue;
 
 		// Asumes the first observation in mappoint has the lowest mnId.  Processed keyframes in mnId order ensures this.
 		auto pair = (*pMP->mObservations.begin());
 		pMP->mpRefKF = pair.first;
 
-		/* UpdateNormalAndDepth() requires prior rebuilding of mpRefKF, and rebuilds:
-		 * - mNormalVector
-		 * - mfMinDistance
-		 * - mfMaxDistance
-		 */
-		pMP->UpdateNormalAndDepth();
+		// Saved reference keyframe, if it was loaded and still observes the mappoint
+		auto itRef = mapPointRefKeyFrameIds.find(pMP);
+		if(itRef != mapPointRefKeyFrameIds.end()){
+			KeyFrame *pRefKF = itRef->second? getKeyFrame(itRef->second - 1) : NULL;
+			if(pRefKF && pMP->mObservations.count(pRefKF))
+				pMP->mpRefKF = pRefKF;
+			continue;
+		}
+		vectorGoodMapPoints.push_back(pMP);
+	}
+	phaseEnd("rebuild mappoints", start, vectorMapPoints.size());
+
+	/* UpdateNormalAndDepth() requires prior rebuilding of mpRefKF, and rebuilds:
+	 * - mNormalVector
+	 * - mfMinDistance
+	 * - mfMaxDistance
+	 */
+	start = OsmapClock();
+	parallelFor(vectorGoodMapPoints.size(), [&](size_t i){
+		vectorGoodMapPoints[i]->UpdateNormalAndDepth();
+	});
+	phaseEnd("rebuild normal and depth", start, vectorGoodMapPoints.size());
+
+	MapPoint::nNextId = vectorMapPoints.back()->mnId + 1;
+}
+
+void Osmap::linkKeyFrame(OsmapKeyFrame *pKF){
+	LOGV(pKF->mnId);
+
+	// Append keyframe to the database
+	if(!keyFrameDatabaseLoaded)
+		keyFrameDatabase.add(pKF);
+
+	// Rebuild MapPoints obvervations
+	size_t n = pKF->mvpMapPoints.size();
+	for(size_t i=0; i<n; i++){
+		MapPoint *pMP = pKF->mvpMapPoints[i];
+		if(pMP)
+			pMP->AddObservation(pKF, i);
+	}
+	log("Observations rebuilt");
+
+	// Calling UpdateConnections in mnId order rebuilds the covisibility graph and the spanning tree, unless they were saved.
+	if(!linkConnections(pKF))
+		pKF->UpdateConnections();
+}
+
+void Osmap::rebuildKeyFrame(OsmapKeyFrame *pKF){
+	pKF->mbNotErase = !pKF->mspLoopEdges.empty();
+
+	// Build BoW vectors, unless they were loaded
+	if(pKF->mBowVec.empty() || pKF->mFeatVec.empty())
+		pKF->ComputeBoW();
+
+	// Build many pose matrices
+	pKF->SetPose(pKF->Tcw);
+
+	rebuildGrid(pKF);
+}
+
+bool Osmap::linkConnections(OsmapKeyFrame *pKF){
+	auto it = keyFrameConnections.find(pKF);
+	if(it == keyFrameConnections.end())
+		return false;
+	OsmapConnections &connections = it->second;
+
+	pKF->mConnectedKeyFrameWeights.clear();
+	pKF->mvpOrderedConnectedKeyFrames.clear();
+	pKF->mvOrderedWeights.clear();
+	for(size_t i=0; i<connections.ids.size(); i++){
+		KeyFrame *pConnectedKF = getKeyFrame(connections.ids[i]);
+		if(!pConnectedKF)
+			continue;
+		pKF->mConnectedKeyFrameWeights[pConnectedKF] = connections.weights[i];
+		pKF->mvpOrderedConnectedKeyFrames.push_back(pConnectedKF);
+		pKF->mvOrderedWeights.push_back(connections.weights[i]);
+	}
+
+	// Parent, later UpdateConnections calls don't change it
+	KeyFrame *pParent = connections.parentId? getKeyFrame(connections.parentId - 1) : NULL;
+	if(pParent){
+		pKF->ChangeParent(pParent);
+		pKF->mbFirstConnection = false;
+	}
+
+	return true;
+}
+
+void Osmap::rebuildGrid(OsmapKeyFrame *pKF){
+	/*
+	 * Rebuilding grid.
+	 * Code from Frame::AssignFeaturesToGrid()
+	 */
+	std::vector<std::size_t> grid[pKF->mnGridCols][pKF->mnGridRows];
+	int nReserve = 0.5f*pKF->N/(pKF->mnGridCols*pKF->mnGridRows);
+	for(int i=0; i<pKF->mnGridCols;i++)
+		for (int j=0; j<pKF->mnGridRows;j++)
+			grid[i][j].reserve(nReserve);
+
+	for(int i=0;i<pKF->N;i++){
+		const cv::KeyPoint &kp = pKF->mvKeysUn[i];
+		int posX = round((kp.pt.x-pKF->mnMinX)*pKF->mfGridElementWidthInv);
+		int posY = round((kp.pt.y-pKF->mnMinY)*pKF->mfGridElementHeightInv);
+
+		//Keypoint's coordinates are undistorted, which could cause to go out of the image
+		if(!(posX<0 || posX>=pKF->mnGridCols || posY<0 || posY>=pKF->mnGridRows))
+			grid[posX][posY].push_back(i);
+	}
+
+	pKF->mGrid.resize(pKF->mnGridCols);
+	for(int i=0; i < pKF->mnGridCols;i++){
+		pKF->mGrid[i].resize(pKF->mnGridRows);
+		for(int j=0; j < pKF->mnGridRows; j++)
+			pKF->mGrid[i][j] = grid[i][j];
 	}
-	MapPoint::nNextId = vectorMapPoints.back()->mnId + 1;
 }
 
 void Osmap::getVectorKFromKeyframes(){
@@ -730,9 +2837,211 @@ int Osmap::countFeatures(){
 }
 
 
+unsigned int Osmap::getThreads(){
+	if(threads)
+		return threads;
+
+	unsigned int n = thread::hardware_concurrency();
+	return n? n : 1;
+}
+
+void Osmap::parallelFor(size_t n, const function<void(size_t)> &task){
+	size_t nThreads = min<size_t>(getThreads(), n);
+	if(nThreads <= 1){
+		for(size_t i=0; i<n; i++)
+			task(i);
+		return;
+	}
+
+	// Each thread takes the next unprocessed index until there are no more
+	atomic<size_t> next(0);
+	auto worker = [&](){
+		for(size_t i; (i = next++) < n;)
+			task(i);
+	};
+
+	vector<thread> pool;
+	for(size_t i=1; i<nThreads; i++)
+		pool.emplace_back(worker);
+	worker();
+	for(auto &t : pool)
+		t.join();
+}
+
+
+// Statistics
+OsmapClock::OsmapClock(){
+	wallTime = chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+	timespec cpu;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu);
+	cpuTime = cpu.tv_sec + cpu.tv_nsec * 1e-9;
+}
+
+void Osmap::phaseEnd(const string &name, const OsmapClock &start, uint64_t objects, uint64_t bytes){
+	OsmapPhase phase;
+	phase.name = name;
+	phaseRun(phase, start, objects, bytes);
+	phaseAdd(phase);
+}
+
+void Osmap::statsEnd(const OsmapClock &start){
+	OsmapClock end;
+	stats.wallTime = end.wallTime - start.wallTime;
+	stats.cpuTime = end.cpuTime - start.cpuTime;
+}
+
+void Osmap::phaseAdd(const OsmapPhase &phase){
+	lock_guard<mutex> lock(statsMutex);
+	auto it = find_if(stats.phases.begin(), stats.phases.end(), [&](const OsmapPhase &p){return p.name == phase.name;});
+	if(it == stats.phases.end()){
+		OsmapPhase added;
+		added.name = phase.name;
+		it = stats.phases.insert(it, added);
+	}
+	it->wallTime += phase.wallTime;
+	it->cpuTime += phase.cpuTime;
+	it->objects += phase.objects;
+	it->bytes += phase.bytes;
+	it->runs += phase.runs;
+	log("Phase", it->name, it->wallTime, "s");
+	if(progress)
+		progress(*it);
+}
+
+
+// Quantization
+static const uint64_t positionSteps = (1 << 21) - 1;	// 21 bits per axis
+static const double rotationUnit = 1.0 / (1 << 19);
+static const float keypointSteps = 16;	// per pixel
+
+// Translation unit: the coarsest positions' resolution among axes.
+static double positionResolution(const float *boundingBox){
+	double extent = max(max(boundingBox[3] - boundingBox[0], boundingBox[4] - boundingBox[1]), boundingBox[5] - boundingBox[2]);
+	return extent > 0? extent / positionSteps : 1e-6;
+}
+
+void Osmap::getBoundingBox(){
+	bool first = true;
+	for(auto pMP : map.mspMapPoints){
+		if(pMP->mWorldPos.empty()) continue;
+		for(int i=0; i<3; i++){
+			float coordinate = pMP->mWorldPos.at<float>(i,0);
+			if(first || coordinate < boundingBox[i])   boundingBox[i]   = coordinate;
+			if(first || coordinate > boundingBox[i+3]) boundingBox[i+3] = coordinate;
+		}
+		first = false;
+	}
+	if(first)
+		fill(boundingBox, boundingBox + 6, 0.0f);
+}
+
+OsmapQuantizationError Osmap::quantizationError(){
+	OsmapQuantizationError error;
+	Mat position;
+	for(auto pMP : vectorMapPoints){
+		if(pMP->mWorldPos.empty()) continue;
+		dequantizePosition(quantizePosition(pMP->mWorldPos), position);
+		for(int i=0; i<3; i++)
+			error.position = max(error.position, fabs(position.at<float>(i,0) - pMP->mWorldPos.at<float>(i,0)));
+	}
+	for(auto pKF : vectorKeyFrames){
+		// Poses through their messages, as they can be encoded in many ways
+		SerializedPose serializedPose;
+		Mat pose;
+		serialize(pKF->Tcw, &serializedPose);
+		deserialize(serializedPose, pose);
+		for(int i=0; i<12; i++)
+			error.pose = max(error.pose, fabs(((const float*)pose.data)[i] - ((const float*)pKF->Tcw.data)[i]));
+		for(auto &kp : pKF->mvKeysUn){
+			error.keypoint = max(error.keypoint, fabs(dequantizeKeypointCoordinate(quantizeKeypointCoordinate(kp.pt.x)) - kp.pt.x));
+			error.keypoint = max(error.keypoint, fabs(dequantizeKeypointCoordinate(quantizeKeypointCoordinate(kp.pt.y)) - kp.pt.y));
+			float angleError = fabs(dequantizeAngle(quantizeAngle(kp.angle)) - kp.angle);
+			error.angle = max(error.angle, min(angleError, 360 - angleError));
+		}
+	}
+	return error;
+}
+
+uint64_t Osmap::quantizePosition(const Mat &position){
+	uint64_t quantized = 0;
+	for(int i=0; i<3; i++){
+		double extent = boundingBox[i+3] - boundingBox[i];
+		long long q = extent > 0? llround((position.at<float>(i,0) - boundingBox[i]) / extent * positionSteps) : 0;
+		q = max(0LL, min((long long)positionSteps, q));
+		quantized |= (uint64_t)q << (21*i);
+	}
+	return quantized;
+}
+
+void Osmap::dequantizePosition(uint64_t quantized, Mat &position){
+	position = Mat(3,1,CV_32F);
+	for(int i=0; i<3; i++){
+		double extent = boundingBox[i+3] - boundingBox[i];
+		position.at<float>(i,0) = boundingBox[i] + ((quantized >> (21*i)) & positionSteps) * extent / positionSteps;
+	}
+}
+
+int32_t Osmap::quantizePoseElement(float element, bool translation){
+	double unit = translation? positionResolution(boundingBox) : rotationUnit;
+	return (int32_t) max((double)INT_MIN, min((double)INT_MAX, (double)llround(element / unit)));
+}
+
+float Osmap::dequantizePoseElement(int32_t quantized, bool translation){
+	double unit = translation? positionResolution(boundingBox) : rotationUnit;
+	return quantized * unit;
+}
+
+int32_t Osmap::quantizeKeypointCoordinate(float coordinate){
+	return lround(coordinate * keypointSteps);
+}
+
+float Osmap::dequantizeKeypointCoordinate(int32_t quantized){
+	return quantized / keypointSteps;
+}
+
+uint32_t Osmap::quantizeAngle(float angle){
+	return (uint32_t) lround(angle * 256 / 360) & 0xFF;
+}
+
+float Osmap::dequantizeAngle(uint32_t quantized){
+	return quantized * 360.0f / 256;
+}
+
+
 // Utilities
+void Osmap::indexMapPoints(){
+  mapPointsDenseIndex.clear();
+  mapPointsHashIndex.clear();
+
+  unsigned int maxId = 0;
+  for(auto pMP : vectorMapPoints)
+	if(pMP->mnId > maxId)
+	  maxId = pMP->mnId;
+
+  if(maxId <= 4 * vectorMapPoints.size()){
+	// Compact ids: dense table
+	mapPointsDenseIndex.assign(maxId + 1, NULL);
+	for(auto pMP : vectorMapPoints)
+	  mapPointsDenseIndex[pMP->mnId] = pMP;
+  } else {
+	// Sparse ids: hash map
+	mapPointsHashIndex.reserve(vectorMapPoints.size());
+	for(auto pMP : vectorMapPoints)
+	  mapPointsHashIndex[pMP->mnId] = pMP;
+  }
+  log("MapPoints indexed, max id", maxId, mapPointsDenseIndex.empty()? "hash index" : "dense index");
+}
+
 MapPoint *Osmap::getMapPoint(unsigned int id){
-  //for(auto pMP : map.mspMapPoints)
+  if(!mapPointsDenseIndex.empty())
+	return id < mapPointsDenseIndex.size()? mapPointsDenseIndex[id] : NULL;
+
+  if(!mapPointsHashIndex.empty()){
+	auto it = mapPointsHashIndex.find(id);
+	return it == mapPointsHashIndex.end()? NULL : it->second;
+  }
+
+  // No index, linear search
   for(auto pMP : vectorMapPoints)
     if(pMP->mnId == id)
     	return pMP;
@@ -741,11 +3050,48 @@ MapPoint *Osmap::getMapPoint(unsigned int id){
   return NULL;
 }
 
+MapPoint *Osmap::getFeatureMapPoint(unsigned int mappointId){
+  if(!mappointId)
+	return NULL;
+  if(options[DENSE_IDS])
+	return mappointId <= vectorMapPoints.size()? vectorMapPoints[mappointId-1] : NULL;
+  return getMapPoint(mappointId);
+}
+
+unsigned int Osmap::getMapPointDenseId(const MapPoint *pMP){
+  auto it = lower_bound(vectorMapPoints.begin(), vectorMapPoints.end(), pMP->mnId, [](const MapPoint *a, unsigned int id){return a->mnId < id;});
+  return it != vectorMapPoints.end() && *it == pMP? it - vectorMapPoints.begin() + 1 : 0;
+}
+
+const uchar *Osmap::getDescriptorReference(const MapPoint *pMP){
+  if(!pMP || pMP->mDescriptor.total() != 32 || !pMP->mDescriptor.isContinuous())
+	return NULL;
+  auto it = lower_bound(vectorMapPoints.begin(), vectorMapPoints.end(), pMP->mnId, [](const MapPoint *a, unsigned int id){return a->mnId < id;});
+  return it != vectorMapPoints.end() && *it == pMP? pMP->mDescriptor.data : NULL;
+}
+
+int Osmap::getKeyFrameDenseId(const KeyFrame *pKF){
+  auto it = lower_bound(vectorKeyFrames.begin(), vectorKeyFrames.end(), pKF->mnId, [](const KeyFrame *a, unsigned int id){return a->mnId < id;});
+  return it != vectorKeyFrames.end() && *it == pKF? it - vectorKeyFrames.begin() : -1;
+}
+
 OsmapKeyFrame *Osmap::getKeyFrame(unsigned int id){
-  //for(auto it = map.mspKeyFrames.begin(); it != map.mspKeyFrames.end(); ++it)
-  for(auto pKF : vectorKeyFrames)
-	if(pKF->mnId == id)
-	  return pKF;
+  size_t n = vectorKeyFrames.size();
+
+  // Expected access: the same keyframe or the next one
+  if(lastKeyFrameIdx < n){
+	if(vectorKeyFrames[lastKeyFrameIdx]->mnId == id)
+	  return vectorKeyFrames[lastKeyFrameIdx];
+	if(lastKeyFrameIdx+1 < n && vectorKeyFrames[lastKeyFrameIdx+1]->mnId == id)
+	  return vectorKeyFrames[++lastKeyFrameIdx];
+  }
+
+  // Binary search, vectorKeyFrames is in ascending id order
+  auto it = lower_bound(vectorKeyFrames.begin(), vectorKeyFrames.end(), id, [](const KeyFrame *pKF, unsigned int id){return pKF->mnId < id;});
+  if(it != vectorKeyFrames.end() && (*it)->mnId == id){
+	lastKeyFrameIdx = it - vectorKeyFrames.begin();
+	return *it;
+  }
 
   // If not found
   return NULL;
@@ -794,30 +3140,228 @@ void Osmap::deserialize(const SerializedDescriptor &serializedDescriptor, Mat &m
 	((unsigned int*)m.data)[i] = serializedDescriptor.block(i);
 }
 
+/*
+ * DESCRIPTOR_RESIDUALS: XOR of two 32 bytes descriptors.
+ */
+static inline void xorDescriptor(const uchar *a, const uchar *b, uchar *result){
+#ifdef __SSE2__
+  for(int i=0; i<32; i+=16)
+	_mm_storeu_si128((__m128i*)(result+i), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a+i)), _mm_loadu_si128((const __m128i*)(b+i))));
+#elif defined __ARM_NEON
+  for(int i=0; i<32; i+=16)
+	vst1q_u8(result+i, veorq_u8(vld1q_u8(a+i), vld1q_u8(b+i)));
+#else
+  for(int i=0; i<32; i++)
+	result[i] = a[i] ^ b[i];
+#endif
+}
+
+/*
+ * Appends the residual of descriptor against reference: a varint mask with a bit per nonzero byte of their XOR, followed by those bytes.
+ * Equal descriptors take a single zero byte.
+ */
+static void encodeResidual(const uchar *descriptor, const uchar *reference, string &residual){
+  uchar xored[32];
+  xorDescriptor(descriptor, reference, xored);
+  uint32_t mask = 0;
+  for(int i=0; i<32; i++)
+	if(xored[i]) mask |= 1u << i;
+  do {
+	residual.push_back((char)((mask & 0x7F) | (mask > 0x7F? 0x80 : 0)));
+	mask >>= 7;
+  } while(mask);
+  for(int i=0; i<32; i++)
+	if(xored[i]) residual.push_back((char)xored[i]);
+}
+
+/*
+ * Rebuilds a descriptor from its residual against reference.
+ * @returns bytes consumed from data, 0 if the residual is truncated.
+ */
+static size_t decodeResidual(const char *data, size_t size, const uchar *reference, uchar *descriptor){
+  uint32_t mask = 0;
+  size_t offset = 0;
+  for(int shift = 0;; shift += 7){
+	if(offset >= size || shift > 28) return 0;
+	uint8_t byte = data[offset++];
+	mask |= (uint32_t)(byte & 0x7F) << shift;
+	if(!(byte & 0x80)) break;
+  }
+  uchar xored[32] = {0};
+  for(int i=0; mask; i++, mask >>= 1)
+	if(mask & 1){
+	  if(offset >= size) return 0;
+	  xored[i] = data[offset++];
+	}
+  xorDescriptor(reference, xored, descriptor);
+  return offset;
+}
+
+/*
+ * Descriptor of a loaded mappoint, reference for the residuals of its features.  NULL if it has none.
+ */
+static const uchar *mappointDescriptor(const MapPoint *pMP){
+  return pMP && pMP->mDescriptor.total() == 32 && pMP->mDescriptor.isContinuous()? pMP->mDescriptor.data : NULL;
+}
+
 // Pose ================================================================================================
-void Osmap::serialize(const Mat &m, SerializedPose *serializedPose){
-  float *pElement = (float*) m.data;
-  for(unsigned int i = 0; i<12; i++)
-    serializedPose->add_element(pElement[i]);
+/*
+ * Pose values: the first 12 elements of the pose matrix, or with QUATERNION_POSES the rotation quaternion w, x, y, z and the translation.
+ */
+static int poseToValues(const Mat &m, bool quaternion, float *values){
+  const float *pElement = (const float*) m.data;
+  if(!quaternion){
+	memcpy(values, pElement, 12*sizeof(float));
+	return 12;
+  }
+
+  // Rotation matrix to quaternion, from its largest component
+  double r00 = pElement[0], r01 = pElement[1], r02 = pElement[2],
+		 r10 = pElement[4], r11 = pElement[5], r12 = pElement[6],
+		 r20 = pElement[8], r21 = pElement[9], r22 = pElement[10];
+  double w, x, y, z, trace = r00 + r11 + r22;
+  if(trace > 0){
+	double s = 2*sqrt(trace + 1);
+	w = s/4; x = (r21 - r12)/s; y = (r02 - r20)/s; z = (r10 - r01)/s;
+  } else if(r00 > r11 && r00 > r22){
+	double s = 2*sqrt(1 + r00 - r11 - r22);
+	w = (r21 - r12)/s; x = s/4; y = (r01 + r10)/s; z = (r02 + r20)/s;
+  } else if(r11 > r22){
+	double s = 2*sqrt(1 + r11 - r00 - r22);
+	w = (r02 - r20)/s; x = (r01 + r10)/s; y = s/4; z = (r12 + r21)/s;
+  } else {
+	double s = 2*sqrt(1 + r22 - r00 - r11);
+	w = (r10 - r01)/s; x = (r02 + r20)/s; y = (r12 + r21)/s; z = s/4;
+  }
+  double sign = w < 0? -1 : 1;	// q and -q are the same rotation, w >= 0 keeps consecutive quaternions close
+  values[0] = sign*w; values[1] = sign*x; values[2] = sign*y; values[3] = sign*z;
+  values[4] = pElement[3]; values[5] = pElement[7]; values[6] = pElement[11];
+  return 7;
 }
 
-void Osmap::deserialize(const SerializedPose &serializedPose, Mat &m){
-  assert(serializedPose.element_size() == 12);
+static void valuesToPose(const float *values, bool quaternion, Mat &m){
   m = Mat::eye(4,4,CV_32F);
   float *pElement = (float*) m.data;
-  for(unsigned int i = 0; i<12; i++)
-	pElement[i] = serializedPose.element(i);
+  if(!quaternion){
+	memcpy(pElement, values, 12*sizeof(float));
+	return;
+  }
+
+  // Normalized quaternion to rotation matrix, orthonormal
+  double w = values[0], x = values[1], y = values[2], z = values[3];
+  double norm = sqrt(w*w + x*x + y*y + z*z);
+  if(norm > 0){
+	w /= norm; x /= norm; y /= norm; z /= norm;
+  } else
+	w = 1;
+  pElement[0] = 1 - 2*(y*y + z*z); pElement[1] = 2*(x*y - z*w);     pElement[2]  = 2*(x*z + y*w);
+  pElement[4] = 2*(x*y + z*w);     pElement[5] = 1 - 2*(x*x + z*z); pElement[6]  = 2*(y*z - x*w);
+  pElement[8] = 2*(x*z - y*w);     pElement[9] = 2*(y*z + x*w);     pElement[10] = 1 - 2*(x*x + y*y);
+  pElement[3] = values[4]; pElement[7] = values[5]; pElement[11] = values[6];
+}
+
+static bool isTranslation(int i, bool quaternion){
+  return quaternion? i >= 4 : i%4 == 3;
+}
+
+/*
+ * POSE_DELTAS: float bits as an int preserving order, so close floats have close ints, even across zero.
+ */
+static int32_t floatToOrderedBits(float value){
+  int32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits < 0? bits ^ 0x7FFFFFFF : bits;
+}
+
+static float orderedBitsToFloat(int32_t bits){
+  float value;
+  bits = bits < 0? bits ^ 0x7FFFFFFF : bits;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+void Osmap::serialize(const Mat &m, SerializedPose *serializedPose){
+  bool quaternion = options[QUATERNION_POSES];
+  float values[12];
+  int n = poseToValues(m, quaternion, values);
+  for(int i=0; i<n; i++)
+	if(options[QUANTIZED])
+	  serializedPose->add_quantized(quantizePoseElement(values[i], isTranslation(i, quaternion)));
+	else if(quaternion)
+	  serializedPose->add_quaternion(values[i]);
+	else
+	  serializedPose->add_element(values[i]);
+}
+
+void Osmap::deserialize(const SerializedPose &serializedPose, Mat &m){
+  bool quaternion = options[QUATERNION_POSES];
+  int n = quaternion? 7 : 12;
+  float values[12];
+  if(options[QUANTIZED]){
+	assert(serializedPose.quantized_size() == n);
+	for(int i=0; i<n; i++)
+	  values[i] = dequantizePoseElement(serializedPose.quantized(i), isTranslation(i, quaternion));
+  } else if(quaternion){
+	assert(serializedPose.quaternion_size() == n);
+	for(int i=0; i<n; i++)
+	  values[i] = serializedPose.quaternion(i);
+  } else {
+	assert(serializedPose.element_size() == n);
+	for(int i=0; i<n; i++)
+	  values[i] = serializedPose.element(i);
+  }
+  valuesToPose(values, quaternion, m);
+}
+
+void Osmap::serializePoseDelta(SerializedPose &serializedPose, vector<int32_t> &previous){
+  // Pose values as ints, then replaced by their differences
+  vector<int32_t> values;
+  if(options[QUANTIZED])
+	values.assign(serializedPose.quantized().begin(), serializedPose.quantized().end());
+  else
+	for(float value : options[QUATERNION_POSES]? serializedPose.quaternion() : serializedPose.element())
+	  values.push_back(floatToOrderedBits(value));
+  previous.resize(values.size(), 0);
+
+  serializedPose.Clear();
+  for(size_t i=0; i<values.size(); i++)
+	serializedPose.add_delta((int32_t)((uint32_t)values[i] - (uint32_t)previous[i]));
+  previous = values;
+}
+
+void Osmap::deserializePoseDelta(const SerializedPose &serializedPose, vector<int32_t> &previous, Mat &m){
+  // Pose values as ints, back to the message they were taken from
+  previous.resize(serializedPose.delta_size(), 0);
+  SerializedPose values;
+  for(int i=0; i<serializedPose.delta_size(); i++){
+	previous[i] = (int32_t)((uint32_t)previous[i] + (uint32_t)serializedPose.delta(i));
+	if(options[QUANTIZED])
+	  values.add_quantized(previous[i]);
+	else if(options[QUATERNION_POSES])
+	  values.add_quaternion(orderedBitsToFloat(previous[i]));
+	else
+	  values.add_element(orderedBitsToFloat(previous[i]));
+  }
+  deserialize(values, m);
 }
 
 
 // Position ================================================================================================
 void Osmap::serialize(const Mat &m, SerializedPosition *serializedPosition){
+  if(options[QUANTIZED]){
+	serializedPosition->set_quantized(quantizePosition(m));
+	return;
+  }
   serializedPosition->set_x(m.at<float>(0,0));
   serializedPosition->set_y(m.at<float>(1,0));
   serializedPosition->set_z(m.at<float>(2,0));
 }
 
 void Osmap::deserialize(const SerializedPosition &serializedPosition, Mat &m){
+  if(options[QUANTIZED]){
+	dequantizePosition(serializedPosition.quantized(), m);
+	return;
+  }
   m = Mat(3,1,CV_32F);
   m.at<float>(0,0) = serializedPosition.x();
   m.at<float>(1,0) = serializedPosition.y();
@@ -826,16 +3370,28 @@ void Osmap::deserialize(const SerializedPosition &serializedPosition, Mat &m){
 
 // KeyPoint ================================================================================================
 void Osmap::serialize(const KeyPoint &kp, SerializedKeypoint *serializedKeypoint){
+  serializedKeypoint->set_octave(kp.octave);
+  if(options[QUANTIZED]){
+	serializedKeypoint->set_quantizedptx(quantizeKeypointCoordinate(kp.pt.x));
+	serializedKeypoint->set_quantizedpty(quantizeKeypointCoordinate(kp.pt.y));
+	serializedKeypoint->set_quantizedangle(quantizeAngle(kp.angle));
+	return;
+  }
   serializedKeypoint->set_ptx(kp.pt.x);
   serializedKeypoint->set_pty(kp.pt.y);
-  serializedKeypoint->set_octave(kp.octave);
   serializedKeypoint->set_angle(kp.angle);
 }
 
 void Osmap::deserialize(const SerializedKeypoint &serializedKeypoint, KeyPoint &kp){
+  kp.octave = serializedKeypoint.octave();
+  if(options[QUANTIZED]){
+	kp.pt.x  = dequantizeKeypointCoordinate(serializedKeypoint.quantizedptx());
+	kp.pt.y  = dequantizeKeypointCoordinate(serializedKeypoint.quantizedpty());
+	kp.angle = dequantizeAngle(serializedKeypoint.quantizedangle());
+	return;
+  }
   kp.pt.x   = serializedKeypoint.ptx();
   kp.pt.y   = serializedKeypoint.pty();
-  kp.octave = serializedKeypoint.octave();
   kp.angle  = serializedKeypoint.angle();
 }
 
@@ -843,24 +3399,49 @@ void Osmap::deserialize(const SerializedKeypoint &serializedKeypoint, KeyPoint &
 
 // MapPoint ================================================================================================
 void Osmap::serialize(const OsmapMapPoint &mappoint, SerializedMappoint *serializedMappoint){
-  serializedMappoint->set_id(mappoint.mnId);
+  if(!options[DENSE_IDS])
+	serializedMappoint->set_id(mappoint.mnId);
   serialize(mappoint.mWorldPos, serializedMappoint->mutable_position());
   serializedMappoint->set_visible(mappoint.mnVisible);
   serializedMappoint->set_found(mappoint.mnFound);
   //if(options[NO_FEATURES_DESCRIPTORS])	// This is the only descriptor to serialize	** This line is disable to force mappoint descriptor serialization, while it's not being reconstructed in rebuild. **
     serialize(mappoint.mDescriptor, serializedMappoint->mutable_briefdescriptor());
+
+  // Normal, depth range and reference keyframe, only if it is saved
+  if(options[NORMAL_AND_DEPTH] && mappoint.mNormalVector.total() == 3){
+	for(int i=0; i<3; i++)
+	  serializedMappoint->add_normal(mappoint.mNormalVector.at<float>(i,0));
+	serializedMappoint->set_mindistance(mappoint.mfMinDistance);
+	serializedMappoint->set_maxdistance(mappoint.mfMaxDistance);
+	int refPosition = mappoint.mpRefKF? getKeyFrameDenseId(mappoint.mpRefKF) : -1;
+	if(refPosition >= 0)
+	  serializedMappoint->set_refkeyframeid((options[DENSE_IDS]? refPosition : mappoint.mpRefKF->mnId) + 1);
+  }
 }
 
 OsmapMapPoint *Osmap::deserialize(const SerializedMappoint &serializedMappoint){
   OsmapMapPoint *pMappoint = new OsmapMapPoint(this);
+  deserialize(serializedMappoint, pMappoint);
+  return pMappoint;
+}
 
+void Osmap::deserialize(const SerializedMappoint &serializedMappoint, OsmapMapPoint *pMappoint){
   pMappoint->mnId        = serializedMappoint.id();
   pMappoint->mnVisible   = serializedMappoint.visible();
   pMappoint->mnFound     = serializedMappoint.found();
   if(serializedMappoint.has_briefdescriptor()) deserialize(serializedMappoint.briefdescriptor(), pMappoint->mDescriptor);
   if(serializedMappoint.has_position())        deserialize(serializedMappoint.position(),        pMappoint->mWorldPos  );
 
-  return pMappoint;
+  // Reference keyframe may be not loaded yet, it is linked on rebuilding
+  if(options[NORMAL_AND_DEPTH] && serializedMappoint.normal_size() == 3){
+	pMappoint->mNormalVector = Mat(3,1,CV_32F);
+	for(int i=0; i<3; i++)
+	  pMappoint->mNormalVector.at<float>(i,0) = serializedMappoint.normal(i);
+	pMappoint->mfMinDistance = serializedMappoint.mindistance();
+	pMappoint->mfMaxDistance = serializedMappoint.maxdistance();
+	mapPointRefKeyFrameIds[pMappoint] = serializedMappoint.refkeyframeid();
+  } else
+	mapPointRefKeyFrameIds.erase(pMappoint);
 }
 
 int Osmap::serialize(const vector<OsmapMapPoint*>& vectorMP, SerializedMappointArray &serializedMappointArray){
@@ -873,8 +3454,13 @@ int Osmap::serialize(const vector<OsmapMapPoint*>& vectorMP, SerializedMappointA
 
 int Osmap::deserialize(const SerializedMappointArray &serializedMappointArray, vector<OsmapMapPoint*>& vectorMapPoints){
   int i, n = serializedMappointArray.mappoint_size();
-  for(i=0; i<n; i++)
+  if(options[NORMAL_AND_DEPTH])
+	mapPointRefKeyFrameIds.reserve(mapPointRefKeyFrameIds.size() + n);
+  for(i=0; i<n; i++){
 	vectorMapPoints.push_back(deserialize(serializedMappointArray.mappoint(i)));
+	if(options[DENSE_IDS])
+	  vectorMapPoints.back()->mnId = i;
+  }
 
   return i;
 }
@@ -882,13 +3468,44 @@ int Osmap::deserialize(const SerializedMappointArray &serializedMappointArray, v
 
 // KeyFrame ================================================================================================
 void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedKeyframe *serializedKeyframe){
-  serializedKeyframe->set_id(keyframe.mnId);
   serialize(keyframe.Tcw, serializedKeyframe->mutable_pose());
-  serializedKeyframe->set_timestamp(keyframe.mTimeStamp);
   if(options[K_IN_KEYFRAME])
 	serialize(keyframe.mK, serializedKeyframe->mutable_kmatrix());
   else
 	serializedKeyframe->set_kindex(keyframeid2vectorkIdx[keyframe.mnId]);
+
+  /*
+   * Covisibility graph and parent, only to saved keyframes.  Ordered connections are by descending weight.
+   * A weak edge is kept if it is the strongest of either keyframe, so both keyframes keep it and the loaded graph is symmetric.
+   */
+  if(options[COVISIBILITY]){
+	auto strongest = [this](const OsmapKeyFrame &kf) -> const KeyFrame*{
+	  for(auto pConnectedKF : kf.mvpOrderedConnectedKeyFrames)
+		if(kf.mConnectedKeyFrameWeights.count(pConnectedKF) && getKeyFrameDenseId(pConnectedKF) >= 0)
+		  return pConnectedKF;
+	  return NULL;
+	};
+	const KeyFrame *pStrongest = strongest(keyframe);
+	for(auto pConnectedKF : keyframe.mvpOrderedConnectedKeyFrames){
+	  auto weight = keyframe.mConnectedKeyFrameWeights.find(pConnectedKF);
+	  int position = getKeyFrameDenseId(pConnectedKF);
+	  if(weight == keyframe.mConnectedKeyFrameWeights.end() || position < 0)
+		continue;
+	  if(weight->second < covisibilityThreshold && pConnectedKF != pStrongest && strongest(*static_cast<OsmapKeyFrame*>(pConnectedKF)) != &keyframe)
+		continue;
+	  serializedKeyframe->add_covisibleids(options[DENSE_IDS]? position : pConnectedKF->mnId);
+	  serializedKeyframe->add_covisibleweights(weight->second);
+	}
+	int parentPosition = keyframe.mpParent? getKeyFrameDenseId(keyframe.mpParent) : -1;
+	if(parentPosition >= 0)
+	  serializedKeyframe->set_parentid((options[DENSE_IDS]? parentPosition : keyframe.mpParent->mnId) + 1);
+  }
+
+  // With DENSE_IDS, id, timestamp and loop edges depend on the previous keyframes, they are serialized with the keyframes array.
+  if(options[DENSE_IDS])
+	return;
+  serializedKeyframe->set_id(keyframe.mnId);
+  serializedKeyframe->set_timestamp(keyframe.mTimeStamp);
   if(!keyframe.mspLoopEdges.empty())
 	for(auto loopKF : keyframe.mspLoopEdges)
 		// Only serialize id of keyframes already serialized, to easy deserialization.
@@ -897,12 +3514,17 @@ void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedKeyframe *seriali
 }
 
 OsmapKeyFrame *Osmap::deserialize(const SerializedKeyframe &serializedKeyframe){
-	OsmapKeyFrame *pKeyframe = new OsmapKeyFrame(this);
+  OsmapKeyFrame *pKeyframe = new OsmapKeyFrame(this);
+  deserialize(serializedKeyframe, pKeyframe);
+  return pKeyframe;
+}
 
+void Osmap::deserialize(const SerializedKeyframe &serializedKeyframe, OsmapKeyFrame *pKeyframe){
   pKeyframe->mnId = serializedKeyframe.id();
   const_cast<double&>(pKeyframe->mTimeStamp) = serializedKeyframe.timestamp();
 
-  if(serializedKeyframe.has_pose())
+  // With POSE_DELTAS pose depends on the previous keyframe, it is deserialized with the keyframes array.
+  if(serializedKeyframe.has_pose() && !options[POSE_DELTAS])
 	  deserialize(serializedKeyframe.pose(), pKeyframe->Tcw);
 
   if(serializedKeyframe.has_kmatrix())
@@ -912,22 +3534,63 @@ OsmapKeyFrame *Osmap::deserialize(const SerializedKeyframe &serializedKeyframe){
 	  // serialized with default no K_IN_KEYFRAME option, K list in yaml
 	  const_cast<cv::Mat&>(pKeyframe->mK) = *vectorK[serializedKeyframe.kindex()];
 
-  if(serializedKeyframe.loopedgesids_size()){
+  // Covisibility graph and parent refer to keyframes maybe not loaded yet, they are linked on rebuilding
+  if(options[COVISIBILITY]){
+	OsmapConnections &connections = keyFrameConnections[pKeyframe];
+	connections.ids.assign(serializedKeyframe.covisibleids().begin(), serializedKeyframe.covisibleids().end());
+	connections.weights.assign(serializedKeyframe.covisibleweights().begin(), serializedKeyframe.covisibleweights().end());
+	connections.weights.resize(connections.ids.size());
+	connections.parentId = serializedKeyframe.parentid();
+  } else
+	keyFrameConnections.erase(pKeyframe);
+
+  if(serializedKeyframe.loopedgesids_size() && !options[DENSE_IDS]){
 	// Only ids of keyframes already deserialized and present on vectorKeyFrames
 	for(int i=0; i<serializedKeyframe.loopedgesids_size(); i++){
 	  unsigned int loopEdgeId = serializedKeyframe.loopedgesids(i);
 	  OsmapKeyFrame *loopEdgeKF = getKeyFrame(loopEdgeId);
+	  if(!loopEdgeKF){
+		cerr << "Loop edge to keyframe " << loopEdgeId << " not found while deserializing keyframe " << pKeyframe->mnId << ": skipped." << endl;
+		continue;
+	  }
 	  loopEdgeKF->mspLoopEdges.insert(pKeyframe);
 	  pKeyframe->mspLoopEdges.insert(loopEdgeKF);
 	}
   }
-
-  return pKeyframe;
 }
 
 int Osmap::serialize(const vector<OsmapKeyFrame*>& vectorKF, SerializedKeyframeArray &serializedKeyframeArray){
-  for(auto pKF: vectorKF)
-    serialize(*pKF, serializedKeyframeArray.add_keyframe());
+  uint64_t previousTimestamp = 0;
+  vector<int32_t> previousPose;
+  for(auto pKF: vectorKF){
+	SerializedKeyframe *serializedKeyframe = serializedKeyframeArray.add_keyframe();
+    serialize(*pKF, serializedKeyframe);
+
+	if(options[POSE_DELTAS])
+	  serializePoseDelta(*serializedKeyframe->mutable_pose(), previousPose);
+
+	if(options[DENSE_IDS]){
+	  // Timestamp, as the difference between its bits and the previous timestamp's bits.  Close timestamps have close representations.
+	  uint64_t timestamp;
+	  memcpy(&timestamp, &pKF->mTimeStamp, sizeof(timestamp));
+	  serializedKeyframe->set_timestampdelta((int64_t)(timestamp - previousTimestamp));
+	  previousTimestamp = timestamp;
+
+	  // Loop edges to already serialized keyframes, from the closest one backwards
+	  int position = getKeyFrameDenseId(pKF);
+	  vector<int> loopPositions;
+	  for(auto loopKF : pKF->mspLoopEdges){
+		int loopPosition = getKeyFrameDenseId(loopKF);
+		if(loopPosition >= 0 && loopPosition < position)
+		  loopPositions.push_back(loopPosition);
+	  }
+	  sort(loopPositions.rbegin(), loopPositions.rend());
+	  for(int loopPosition : loopPositions){
+		serializedKeyframe->add_loopedgesdeltas(position - loopPosition);
+		position = loopPosition;
+	  }
+	}
+  }
 
   return vectorKF.size();
 }
@@ -936,8 +3599,35 @@ int Osmap::serialize(const vector<OsmapKeyFrame*>& vectorKF, SerializedKeyframeA
 
 int Osmap::deserialize(const SerializedKeyframeArray &serializedKeyframeArray, vector<OsmapKeyFrame*>& vectorKeyFrames){
   int i, n = serializedKeyframeArray.keyframe_size();
-  for(i=0; i<n; i++)
-	  vectorKeyFrames.push_back(deserialize(serializedKeyframeArray.keyframe(i)));
+  uint64_t timestamp = 0;
+  vector<int32_t> previousPose;
+  for(i=0; i<n; i++){
+	  const SerializedKeyframe &serializedKeyframe = serializedKeyframeArray.keyframe(i);
+	  OsmapKeyFrame *pKF = deserialize(serializedKeyframe);
+
+	  if(options[POSE_DELTAS])
+		deserializePoseDelta(serializedKeyframe.pose(), previousPose, pKF->Tcw);
+
+	  if(options[DENSE_IDS]){
+		pKF->mnId = vectorKeyFrames.size();
+		timestamp += (uint64_t)serializedKeyframe.timestampdelta();
+		memcpy(&const_cast<double&>(pKF->mTimeStamp), &timestamp, sizeof(timestamp));
+
+		// Loop edges by position, no lookup needed
+		int position = pKF->mnId;
+		for(int j=0; j<serializedKeyframe.loopedgesdeltas_size(); j++){
+		  position -= serializedKeyframe.loopedgesdeltas(j);
+		  if(position < 0){
+			cerr << "Loop edge out of range while deserializing keyframe " << pKF->mnId << ": skipped." << endl;
+			break;
+		  }
+		  OsmapKeyFrame *loopEdgeKF = vectorKeyFrames[position];
+		  loopEdgeKF->mspLoopEdges.insert(pKF);
+		  pKF->mspLoopEdges.insert(loopEdgeKF);
+		}
+	  }
+	  vectorKeyFrames.push_back(pKF);
+  }
 
   return i;
 }
@@ -945,7 +3635,7 @@ int Osmap::deserialize(const SerializedKeyframeArray &serializedKeyframeArray, v
 
 // Feature ================================================================================================
 void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedKeyframeFeatures *serializedKeyframeFeatures){
-  serializedKeyframeFeatures->set_keyframe_id(keyframe.mnId);
+  serializedKeyframeFeatures->set_keyframe_id(options[DENSE_IDS]? getKeyFrameDenseId(&keyframe) : keyframe.mnId);
   for(int i=0; i<keyframe.N; i++){
 	if(!options[ONLY_MAPPOINTS_FEATURES] || keyframe.mvpMapPoints[i]){	// If chosen to only save mappoints features, check if there is a mappoint.
 		SerializedFeature &serializedFeature = *serializedKeyframeFeatures->add_feature();
@@ -955,51 +3645,362 @@ void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedKeyframeFeatures
 
 		// If there is a MapPoint, serialize it
 		if(keyframe.mvpMapPoints[i])
-		  serializedFeature.set_mappoint_id(keyframe.mvpMapPoints[i]->mnId);
+		  serializedFeature.set_mappoint_id(options[DENSE_IDS]? getMapPointDenseId(keyframe.mvpMapPoints[i]) : keyframe.mvpMapPoints[i]->mnId);
 
 		// Serialize descriptor but skip if chosen to not do so.
-		if(!options[NO_FEATURES_DESCRIPTORS])	//
-		  serialize(keyframe.mDescriptors.row(i), serializedFeature.mutable_briefdescriptor());
+		if(!options[NO_FEATURES_DESCRIPTORS]){
+		  const uchar *reference = options[DESCRIPTOR_RESIDUALS]? getDescriptorReference(keyframe.mvpMapPoints[i]) : NULL;
+		  if(reference){
+			// Residual against the mappoint descriptor, left empty if they are equal
+			string residual;
+			encodeResidual(keyframe.mDescriptors.ptr(i), reference, residual);
+			if(residual.size() > 1)
+			  serializedFeature.set_descriptorresidual(residual);
+		  } else
+			serialize(keyframe.mDescriptors.row(i), serializedFeature.mutable_briefdescriptor());
+		}
 	}
   }
+
+  // Bag of words index features, they must keep their positions
+  if(options[BOW] && !options[ONLY_MAPPOINTS_FEATURES])
+	serialize(keyframe, serializedKeyframeFeatures->mutable_bow());
 }
 
 OsmapKeyFrame *Osmap::deserialize(const SerializedKeyframeFeatures &serializedKeyframeFeatures){
   unsigned int KFid = serializedKeyframeFeatures.keyframe_id();
   OsmapKeyFrame *pKF = getKeyFrame(KFid);
-  if(pKF){
-	  int n = serializedKeyframeFeatures.feature_size();
-	  const_cast<int&>(pKF->N) = n;
-	  const_cast<std::vector<cv::KeyPoint>&>(pKF->mvKeysUn).resize(n);
-	  pKF->mvpMapPoints.resize(n);
-	  const_cast<cv::Mat&>(pKF->mDescriptors) = Mat(n, 32, CV_8UC1);	// n descriptors
+  if(pKF)
+	  deserialize(serializedKeyframeFeatures, pKF);
+  else
+	  cerr << "KeyFrame id "<< KFid << "not found while deserializing features: skipped.  Inconsistence between keyframes and features serialization files." << endl;
+
+  return pKF;
+}
+
+void Osmap::deserialize(const SerializedKeyframeFeatures &serializedKeyframeFeatures, OsmapKeyFrame *pKF){
+  int n = serializedKeyframeFeatures.feature_size();
+  const_cast<int&>(pKF->N) = n;
+  const_cast<std::vector<cv::KeyPoint>&>(pKF->mvKeysUn).resize(n);
+  pKF->mvpMapPoints.resize(n);
+  const_cast<cv::Mat&>(pKF->mDescriptors) = Mat(n, 32, CV_8UC1);	// n descriptors
 
 // ORB-SLAM2 needs to have set mvuRight and mvDepth even though they are not used in monocular.  DUMMY_MAP and OS1 don't have these properties.
 #if !defined OSMAP_DUMMY_MAP && !defined OS1
-	  const_cast<std::vector<float>&>(pKF->mvuRight) = vector<float>(n,-1.0f);
-	  const_cast<std::vector<float>&>(pKF->mvDepth) = vector<float>(n,-1.0f);
+  const_cast<std::vector<float>&>(pKF->mvuRight) = vector<float>(n,-1.0f);
+  const_cast<std::vector<float>&>(pKF->mvDepth) = vector<float>(n,-1.0f);
 #endif
-	  for(int i=0; i<n; i++){
-		const SerializedFeature &feature = serializedKeyframeFeatures.feature(i);
-		if(feature.mappoint_id())		  pKF->mvpMapPoints[i] = getMapPoint(feature.mappoint_id());
-		if(feature.has_keypoint())    	  deserialize(feature.keypoint(), const_cast<cv::KeyPoint&>(pKF->mvKeysUn[i]));
-		if(feature.has_briefdescriptor()){
-			Mat descriptor;
-			deserialize(feature.briefdescriptor(), descriptor);
-			descriptor.copyTo(pKF->mDescriptors.row(i));
-		}
-	  }
+  for(int i=0; i<n; i++){
+	const SerializedFeature &feature = serializedKeyframeFeatures.feature(i);
+	if(feature.mappoint_id())		  pKF->mvpMapPoints[i] = getFeatureMapPoint(feature.mappoint_id());
+	if(feature.has_keypoint())    	  deserialize(feature.keypoint(), const_cast<cv::KeyPoint&>(pKF->mvKeysUn[i]));
+	if(feature.has_briefdescriptor()){
+		Mat descriptor;
+		deserialize(feature.briefdescriptor(), descriptor);
+		descriptor.copyTo(pKF->mDescriptors.row(i));
+	} else if(options[DESCRIPTOR_RESIDUALS] && !options[NO_FEATURES_DESCRIPTORS]){
+		const uchar *reference = mappointDescriptor(pKF->mvpMapPoints[i]);
+		const string &residual = feature.descriptorresidual();
+		if(!reference)
+		  cerr << "Feature " << i << " of keyframe " << pKF->mnId << " without mappoint descriptor to decode its residual." << endl;
+		else if(residual.empty())
+		  memcpy(pKF->mDescriptors.ptr(i), reference, 32);
+		else if(!decodeResidual(residual.data(), residual.size(), reference, pKF->mDescriptors.ptr(i)))
+		  cerr << "Truncated descriptor residual in feature " << i << " of keyframe " << pKF->mnId << "." << endl;
+	}
+  }
+
+  // Bag of words, restored if computed with this vocabulary, otherwise left empty for rebuild to compute them
+  pKF->mBowVec.clear();
+  pKF->mFeatVec.clear();
+  if(serializedKeyframeFeatures.has_bow() && vocabularyMatches)
+	deserialize(serializedKeyframeFeatures.bow(), pKF);
+}
+
+
+void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedKeyframeColumnarFeatures *serializedKeyframeColumnarFeatures){
+  serializedKeyframeColumnarFeatures->set_keyframe_id(options[DENSE_IDS]? getKeyFrameDenseId(&keyframe) : keyframe.mnId);
+
+  // Chosen features
+  vector<int> features;
+  features.reserve(keyframe.N);
+  for(int i=0; i<keyframe.N; i++)
+	if(!options[ONLY_MAPPOINTS_FEATURES] || keyframe.mvpMapPoints[i])	// If chosen to only save mappoints features, check if there is a mappoint.
+	  features.push_back(i);
+  int n = features.size();
+
+  // KeyPoints and MapPoints
+  bool quantized = options[QUANTIZED];
+  if(quantized){
+	serializedKeyframeColumnarFeatures->mutable_quantizedptx()->Reserve(n);
+	serializedKeyframeColumnarFeatures->mutable_quantizedpty()->Reserve(n);
+	serializedKeyframeColumnarFeatures->mutable_quantizedangle()->reserve(n);
   } else {
-	  cerr << "KeyFrame id "<< KFid << "not found while deserializing features: skipped.  Inconsistence between keyframes and features serialization files." << endl;
+	serializedKeyframeColumnarFeatures->mutable_ptx()->Reserve(n);
+	serializedKeyframeColumnarFeatures->mutable_pty()->Reserve(n);
+	serializedKeyframeColumnarFeatures->mutable_angle()->Reserve(n);
   }
-  return pKF;
+  serializedKeyframeColumnarFeatures->mutable_octave()->Reserve(n);
+  serializedKeyframeColumnarFeatures->mutable_mappoint_id()->Reserve(n);
+  for(int i : features){
+	const KeyPoint &kp = keyframe.mvKeysUn[i];
+	if(quantized){
+	  serializedKeyframeColumnarFeatures->add_quantizedptx(quantizeKeypointCoordinate(kp.pt.x));
+	  serializedKeyframeColumnarFeatures->add_quantizedpty(quantizeKeypointCoordinate(kp.pt.y));
+	  serializedKeyframeColumnarFeatures->mutable_quantizedangle()->push_back((char)quantizeAngle(kp.angle));
+	} else {
+	  serializedKeyframeColumnarFeatures->add_ptx(kp.pt.x);
+	  serializedKeyframeColumnarFeatures->add_pty(kp.pt.y);
+	  serializedKeyframeColumnarFeatures->add_angle(kp.angle);
+	}
+	serializedKeyframeColumnarFeatures->add_octave(kp.octave);
+	MapPoint *pMP = keyframe.mvpMapPoints[i];
+	serializedKeyframeColumnarFeatures->add_mappoint_id(!pMP? 0 : options[DENSE_IDS]? getMapPointDenseId(pMP) : pMP->mnId);
+  }
+
+  // Descriptors, 32 bytes each, in one blob.  Skip if chosen to not do so.
+  if(!options[NO_FEATURES_DESCRIPTORS] && options[DESCRIPTOR_RESIDUALS]){
+	// Residuals of features with mappoint, whole descriptors of the others
+	string &blob = *serializedKeyframeColumnarFeatures->mutable_briefdescriptors();
+	blob.reserve(32*n);
+	for(int i : features){
+	  const uchar *reference = getDescriptorReference(keyframe.mvpMapPoints[i]);
+	  if(reference)
+		encodeResidual(keyframe.mDescriptors.ptr(i), reference, blob);
+	  else
+		blob.append((const char*)keyframe.mDescriptors.ptr(i), 32);
+	}
+  } else if(!options[NO_FEATURES_DESCRIPTORS]){
+	string &blob = *serializedKeyframeColumnarFeatures->mutable_briefdescriptors();
+	blob.resize(32*n);
+	char *pBlob = &blob[0];
+	for(int i : features){
+	  memcpy(pBlob, keyframe.mDescriptors.ptr(i), 32);
+	  pBlob += 32;
+	}
+  }
+
+  // Bag of words index features, they must keep their positions
+  if(options[BOW] && !options[ONLY_MAPPOINTS_FEATURES])
+	serialize(keyframe, serializedKeyframeColumnarFeatures->mutable_bow());
+}
+
+void Osmap::deserialize(const SerializedKeyframeColumnarFeatures &serializedKeyframeColumnarFeatures, OsmapKeyFrame *pKF){
+  bool quantized = options[QUANTIZED];
+  int n = serializedKeyframeColumnarFeatures.octave_size();
+  bool sizesOk = quantized?
+	serializedKeyframeColumnarFeatures.quantizedptx_size() == n && serializedKeyframeColumnarFeatures.quantizedpty_size() == n && serializedKeyframeColumnarFeatures.quantizedangle().size() == (size_t)n :
+	serializedKeyframeColumnarFeatures.ptx_size() == n && serializedKeyframeColumnarFeatures.pty_size() == n && serializedKeyframeColumnarFeatures.angle_size() == n;
+  if(!sizesOk || serializedKeyframeColumnarFeatures.mappoint_id_size() != n){
+	cerr << "Columns of different size in features of keyframe " << pKF->mnId << ": skipped." << endl;
+	return;
+  }
+  const_cast<int&>(pKF->N) = n;
+  std::vector<cv::KeyPoint> &keys = const_cast<std::vector<cv::KeyPoint>&>(pKF->mvKeysUn);
+  keys.resize(n);
+  pKF->mvpMapPoints.assign(n, NULL);
+  const_cast<cv::Mat&>(pKF->mDescriptors) = Mat(n, 32, CV_8UC1);	// n descriptors
+
+// ORB-SLAM2 needs to have set mvuRight and mvDepth even though they are not used in monocular.  DUMMY_MAP and OS1 don't have these properties.
+#if !defined OSMAP_DUMMY_MAP && !defined OS1
+  const_cast<std::vector<float>&>(pKF->mvuRight) = vector<float>(n,-1.0f);
+  const_cast<std::vector<float>&>(pKF->mvDepth) = vector<float>(n,-1.0f);
+#endif
+
+  const float *ptx = serializedKeyframeColumnarFeatures.ptx().data();
+  const float *pty = serializedKeyframeColumnarFeatures.pty().data();
+  const float *angle = serializedKeyframeColumnarFeatures.angle().data();
+  const int32_t *quantizedPtx = serializedKeyframeColumnarFeatures.quantizedptx().data();
+  const int32_t *quantizedPty = serializedKeyframeColumnarFeatures.quantizedpty().data();
+  const uint8_t *quantizedAngle = (const uint8_t*) serializedKeyframeColumnarFeatures.quantizedangle().data();
+  const uint32_t *octave = serializedKeyframeColumnarFeatures.octave().data();
+  const uint32_t *mappointId = serializedKeyframeColumnarFeatures.mappoint_id().data();
+  for(int i=0; i<n; i++){
+	KeyPoint &kp = keys[i];
+	if(quantized){
+	  kp.pt.x  = dequantizeKeypointCoordinate(quantizedPtx[i]);
+	  kp.pt.y  = dequantizeKeypointCoordinate(quantizedPty[i]);
+	  kp.angle = dequantizeAngle(quantizedAngle[i]);
+	} else {
+	  kp.pt.x  = ptx[i];
+	  kp.pt.y  = pty[i];
+	  kp.angle = angle[i];
+	}
+	kp.octave = octave[i];
+	if(mappointId[i]) pKF->mvpMapPoints[i] = getFeatureMapPoint(mappointId[i]);
+  }
+
+  const string &blob = serializedKeyframeColumnarFeatures.briefdescriptors();
+  if(options[DESCRIPTOR_RESIDUALS] && !blob.empty()){
+	// Features with mappoint have their residual, the others their whole descriptor
+	size_t offset = 0;
+	for(int i=0; i<n; i++){
+	  const uchar *reference = mappointDescriptor(pKF->mvpMapPoints[i]);
+	  size_t consumed = 0;
+	  if(reference)
+		consumed = decodeResidual(blob.data() + offset, blob.size() - offset, reference, pKF->mDescriptors.ptr(i));
+	  else if(blob.size() - offset >= 32){
+		memcpy(pKF->mDescriptors.ptr(i), blob.data() + offset, 32);
+		consumed = 32;
+	  }
+	  if(!consumed){
+		cerr << "Truncated descriptors in features of keyframe " << pKF->mnId << ": " << n-i << " skipped." << endl;
+		break;
+	  }
+	  offset += consumed;
+	}
+  } else if(blob.size() == 32*(size_t)n && n)
+	memcpy(pKF->mDescriptors.data, blob.data(), blob.size());
+  else if(!blob.empty())
+	cerr << "Descriptors of wrong size in features of keyframe " << pKF->mnId << ": skipped." << endl;
+
+  // Bag of words, restored if computed with this vocabulary, otherwise left empty for rebuild to compute them
+  pKF->mBowVec.clear();
+  pKF->mFeatVec.clear();
+  if(serializedKeyframeColumnarFeatures.has_bow() && vocabularyMatches)
+	deserialize(serializedKeyframeColumnarFeatures.bow(), pKF);
+}
+
+void Osmap::serialize(const OsmapKeyFrame &keyframe, SerializedBow *serializedBow){
+  unsigned int previous = 0;
+  for(auto &word : keyframe.mBowVec){
+	serializedBow->add_worddelta(word.first - previous);
+	serializedBow->add_wordvalue(word.second);
+	previous = word.first;
+  }
+
+  previous = 0;
+  for(auto &node : keyframe.mFeatVec){
+	serializedBow->add_nodedelta(node.first - previous);
+	serializedBow->add_nodesize(node.second.size());
+	for(unsigned int i : node.second)
+	  serializedBow->add_nodefeature(i);
+	previous = node.first;
+  }
+}
+
+void Osmap::deserialize(const SerializedBow &serializedBow, OsmapKeyFrame *pKF){
+  int nWords = serializedBow.worddelta_size(), nNodes = serializedBow.nodedelta_size();
+  if(serializedBow.wordvalue_size() != nWords || serializedBow.nodesize_size() != nNodes){
+	cerr << "Bag of words of keyframe " << pKF->mnId << " of wrong size: computed again." << endl;
+	return;
+  }
+
+  // Ascending ids, each one inserted at the end
+  unsigned int id = 0;
+  for(int i=0; i<nWords; i++){
+	id += serializedBow.worddelta(i);
+	pKF->mBowVec.insert(pKF->mBowVec.end(), make_pair(id, serializedBow.wordvalue(i)));
+  }
+
+  // Features' indices must be in range and add up to nodes' sizes
+  id = 0;
+  int j = 0, nFeatures = serializedBow.nodefeature_size();
+  bool ok = true;
+  for(int i=0; i<nNodes && ok; i++){
+	id += serializedBow.nodedelta(i);
+	int end = j + serializedBow.nodesize(i);
+	ok = end <= nFeatures;
+	vector<unsigned int> &features = pKF->mFeatVec.insert(pKF->mFeatVec.end(), make_pair(id, vector<unsigned int>()))->second;
+	for(; ok && j < end; j++){
+	  features.push_back(serializedBow.nodefeature(j));
+	  ok = features.back() < (unsigned int)pKF->N;
+	}
+  }
+  if(!ok || j != nFeatures){
+	cerr << "Bag of words of keyframe " << pKF->mnId << " doesn't match its features: computed again." << endl;
+	pKF->mBowVec.clear();
+	pKF->mFeatVec.clear();
+  }
+}
+
+
+// Keyframe database ================================================================================================
+int Osmap::serialize(SerializedKeyframeDatabase *serializedDatabase){
+  OsmapKeyFrameDatabase &database = static_cast<OsmapKeyFrameDatabase&>(keyFrameDatabase);
+  unique_lock<mutex> lock(database.mMutex);
+
+  int nWords = 0;
+  unsigned int lastWord = 0;
+  vector<unsigned int> ids;
+  for(unsigned int word=0; word<database.mvInvertedFile.size(); word++){
+	// Only saved keyframes, by id or by position, ascending
+	ids.clear();
+	for(KeyFrame *pKF : database.mvInvertedFile[word]){
+	  int position = getKeyFrameDenseId(pKF);
+	  if(position >= 0)
+		ids.push_back(options[DENSE_IDS]? position : pKF->mnId);
+	}
+	if(ids.empty())
+	  continue;
+	sort(ids.begin(), ids.end());
+
+	serializedDatabase->add_worddelta(word - lastWord);
+	serializedDatabase->add_nkeyframes(ids.size());
+	unsigned int lastId = 0;
+	for(unsigned int id : ids){
+	  serializedDatabase->add_keyframedelta(id - lastId);
+	  lastId = id;
+	}
+	lastWord = word;
+	nWords++;
+  }
+  return nWords;
+}
+
+int Osmap::deserialize(const SerializedKeyframeDatabase &serializedDatabase){
+  // Words must be ascending without repetitions and in the vocabulary, and their keyframes add up to keyframedelta size
+  int nWords = serializedDatabase.worddelta_size();
+  if(serializedDatabase.nkeyframes_size() != nWords)
+	return -1;
+  ORBVocabulary *pVocabulary = currentFrame.mpORBvocabulary;
+  unsigned int vocabularySize = pVocabulary? pVocabulary->size() : 0;
+  vector<unsigned int> words(nWords);
+  vector<size_t> offsets(nWords + 1, 0);
+  unsigned int word = 0;
+  for(int i=0; i<nWords; i++){
+	unsigned int delta = serializedDatabase.worddelta(i);
+	if((i && !delta) || delta >= vocabularySize - word)
+	  return -1;
+	word += delta;
+	words[i] = word;
+	offsets[i+1] = offsets[i] + serializedDatabase.nkeyframes(i);
+  }
+  if(offsets[nWords] != (size_t)serializedDatabase.keyframedelta_size())
+	return -1;
+
+  OsmapKeyFrameDatabase &database = static_cast<OsmapKeyFrameDatabase&>(keyFrameDatabase);
+  database.clear();
+  if(nWords && database.mvInvertedFile.size() <= words.back())
+	database.mvInvertedFile.resize(words.back() + 1);
+
+  // Keyframes by id, a direct lookup.  Ids are dense enough, with gaps only where keyframes were culled.
+  vector<KeyFrame*> keyFramesById(vectorKeyFrames.empty()? 0 : vectorKeyFrames.back()->mnId + 1, NULL);
+  for(OsmapKeyFrame *pKF : vectorKeyFrames)
+	keyFramesById[pKF->mnId] = pKF;
+
+  // Each word's list on its own
+  parallelFor(nWords, [&](size_t i){
+	list<KeyFrame*> &keyFrames = database.mvInvertedFile[words[i]];
+	unsigned int id = 0;
+	for(size_t j=offsets[i]; j<offsets[i+1]; j++){
+	  id += serializedDatabase.keyframedelta(j);
+	  if(id < keyFramesById.size() && keyFramesById[id])
+		keyFrames.push_back(keyFramesById[id]);
+	}
+  });
+
+  return nWords;
 }
 
 
 int Osmap::serialize(const vector<OsmapKeyFrame*> &vectorKF, SerializedKeyframeFeaturesArray &serializedKeyframeFeaturesArray){
   unsigned int nFeatures = 0;
   for(auto pKF:vectorKF){
-    serialize(*pKF, serializedKeyframeFeaturesArray.add_feature());
+	if(options[COLUMNAR_FEATURES])
+	  serialize(*pKF, serializedKeyframeFeaturesArray.add_columnarfeature());
+	else
+	  serialize(*pKF, serializedKeyframeFeaturesArray.add_feature());
     nFeatures += pKF->N;
   }
 
@@ -1008,13 +4009,37 @@ int Osmap::serialize(const vector<OsmapKeyFrame*> &vectorKF, SerializedKeyframeF
 
 
 int Osmap::deserialize(const SerializedKeyframeFeaturesArray &serializedKeyframeFeaturesArray){
-  int nFeatures = 0, i, n = serializedKeyframeFeaturesArray.feature_size();
-  for(i=0; i<n; i++){
-    KeyFrame *pKF=deserialize(serializedKeyframeFeaturesArray.feature(i));
-	if(pKF)
-		nFeatures += pKF->N;
+  int nFeatures = 0, i,
+	n = serializedKeyframeFeaturesArray.feature_size(),
+	nColumnar = serializedKeyframeFeaturesArray.columnarfeature_size();
+
+  // Look up keyframes first, because getKeyFrame is not thread safe.  Then each keyframe is deserialized on its own, so only once.
+  vector<OsmapKeyFrame*> vectorKF(n + nColumnar);
+  unordered_set<OsmapKeyFrame*> found;
+  for(i=0; i<n+nColumnar; i++){
+	unsigned int KFid = i<n? serializedKeyframeFeaturesArray.feature(i).keyframe_id() : serializedKeyframeFeaturesArray.columnarfeature(i-n).keyframe_id();
+	vectorKF[i] = !options[DENSE_IDS]? getKeyFrame(KFid) : KFid < vectorKeyFrames.size()? vectorKeyFrames[KFid] : NULL;
+	if(!vectorKF[i])
+	  cerr << "KeyFrame id "<< KFid << "not found while deserializing features: skipped.  Inconsistence between keyframes and features serialization files." << endl;
+	else if(!found.insert(vectorKF[i]).second){
+	  cerr << "KeyFrame id "<< KFid << " features repeated while deserializing features: repetition skipped." << endl;
+	  vectorKF[i] = NULL;
+	}
   }
 
+  parallelFor(n + nColumnar, [&](size_t j){
+	if(!vectorKF[j])
+	  return;
+	if((int)j < n)
+	  deserialize(serializedKeyframeFeaturesArray.feature(j), vectorKF[j]);
+	else
+	  deserialize(serializedKeyframeFeaturesArray.columnarfeature(j-n), vectorKF[j]);
+  });
+
+  for(auto pKF : vectorKF)
+	if(pKF)
+	  nFeatures += pKF->N;
+
   return nFeatures;
 }
 
@@ -1077,6 +4102,35 @@ bool Osmap::readDelimitedFrom(
 };
 
 
+// Memory mapped file
+OsmapMappedFile::OsmapMappedFile(const std::string &filename){
+	int fd = open(filename.c_str(), O_RDONLY);
+	if(fd < 0)
+		return;
+	isOpen = true;
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0){
+		void *p = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(p != MAP_FAILED){
+			madvise(p, fileStat.st_size, MADV_SEQUENTIAL);
+			madvise(p, fileStat.st_size, MADV_WILLNEED);
+			data = (const char*) p;
+			size = fileStat.st_size;
+		} else
+			isOpen = false;
+	}
+
+	// The mapping remains valid after closing the descriptor
+	close(fd);
+}
+
+OsmapMappedFile::~OsmapMappedFile(){
+	if(data)
+		munmap((void*)data, size);
+}
+
+
 /*
  * Orbslam adapter.  Class wrappers.
  */
@@ -5,659 +5,738 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR SerializedDescriptor::SerializedDescriptor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.block_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedDescriptorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedDescriptorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedDescriptorDefaultTypeInternal() {}
+  union {
+    SerializedDescriptor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedDescriptorDefaultTypeInternal _SerializedDescriptor_default_instance_;
+PROTOBUF_CONSTEXPR SerializedPose::SerializedPose(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.element_)*/{}
+  , /*decltype(_impl_.quantized_)*/{}
+  , /*decltype(_impl_._quantized_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.quaternion_)*/{}
+  , /*decltype(_impl_.delta_)*/{}
+  , /*decltype(_impl_._delta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedPoseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedPoseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedPoseDefaultTypeInternal() {}
+  union {
+    SerializedPose _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedPoseDefaultTypeInternal _SerializedPose_default_instance_;
+PROTOBUF_CONSTEXPR SerializedPosition::SerializedPosition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.quantized_)*/uint64_t{0u}
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedPositionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedPositionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedPositionDefaultTypeInternal() {}
+  union {
+    SerializedPosition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedPositionDefaultTypeInternal _SerializedPosition_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeypoint::SerializedKeypoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ptx_)*/0
+  , /*decltype(_impl_.pty_)*/0
+  , /*decltype(_impl_.angle_)*/0
+  , /*decltype(_impl_.octave_)*/0
+  , /*decltype(_impl_.quantizedptx_)*/0
+  , /*decltype(_impl_.quantizedpty_)*/0
+  , /*decltype(_impl_.quantizedangle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeypointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeypointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeypointDefaultTypeInternal() {}
+  union {
+    SerializedKeypoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeypointDefaultTypeInternal _SerializedKeypoint_default_instance_;
+PROTOBUF_CONSTEXPR SerializedK::SerializedK(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.fx_)*/0
+  , /*decltype(_impl_.fy_)*/0
+  , /*decltype(_impl_.cx_)*/0
+  , /*decltype(_impl_.cy_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKDefaultTypeInternal() {}
+  union {
+    SerializedK _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKDefaultTypeInternal _SerializedK_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKArray::SerializedKArray(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.k_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKArrayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKArrayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKArrayDefaultTypeInternal() {}
+  union {
+    SerializedKArray _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKArrayDefaultTypeInternal _SerializedKArray_default_instance_;
+PROTOBUF_CONSTEXPR SerializedMappoint::SerializedMappoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.normal_)*/{}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.briefdescriptor_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.visible_)*/0
+  , /*decltype(_impl_.found_)*/0
+  , /*decltype(_impl_.mindistance_)*/0
+  , /*decltype(_impl_.maxdistance_)*/0
+  , /*decltype(_impl_.refkeyframeid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedMappointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedMappointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedMappointDefaultTypeInternal() {}
+  union {
+    SerializedMappoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedMappointDefaultTypeInternal _SerializedMappoint_default_instance_;
+PROTOBUF_CONSTEXPR SerializedMappointArray::SerializedMappointArray(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mappoint_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedMappointArrayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedMappointArrayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedMappointArrayDefaultTypeInternal() {}
+  union {
+    SerializedMappointArray _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedMappointArrayDefaultTypeInternal _SerializedMappointArray_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframe::SerializedKeyframe(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.loopedgesids_)*/{}
+  , /*decltype(_impl_._loopedgesids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.loopedgesdeltas_)*/{}
+  , /*decltype(_impl_._loopedgesdeltas_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.covisibleids_)*/{}
+  , /*decltype(_impl_._covisibleids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.covisibleweights_)*/{}
+  , /*decltype(_impl_._covisibleweights_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pose_)*/nullptr
+  , /*decltype(_impl_.kmatrix_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.kindex_)*/0u
+  , /*decltype(_impl_.timestamp_)*/0
+  , /*decltype(_impl_.timestampdelta_)*/int64_t{0}
+  , /*decltype(_impl_.parentid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeDefaultTypeInternal() {}
+  union {
+    SerializedKeyframe _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeDefaultTypeInternal _SerializedKeyframe_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframeArray::SerializedKeyframeArray(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keyframe_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeArrayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeArrayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeArrayDefaultTypeInternal() {}
+  union {
+    SerializedKeyframeArray _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeArrayDefaultTypeInternal _SerializedKeyframeArray_default_instance_;
+PROTOBUF_CONSTEXPR SerializedFeature::SerializedFeature(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.descriptorresidual_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.keypoint_)*/nullptr
+  , /*decltype(_impl_.briefdescriptor_)*/nullptr
+  , /*decltype(_impl_.mappoint_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedFeatureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedFeatureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedFeatureDefaultTypeInternal() {}
+  union {
+    SerializedFeature _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedFeatureDefaultTypeInternal _SerializedFeature_default_instance_;
+PROTOBUF_CONSTEXPR SerializedBow::SerializedBow(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.worddelta_)*/{}
+  , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.wordvalue_)*/{}
+  , /*decltype(_impl_.nodedelta_)*/{}
+  , /*decltype(_impl_._nodedelta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodesize_)*/{}
+  , /*decltype(_impl_._nodesize_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodefeature_)*/{}
+  , /*decltype(_impl_._nodefeature_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedBowDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedBowDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedBowDefaultTypeInternal() {}
+  union {
+    SerializedBow _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedBowDefaultTypeInternal _SerializedBow_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframeFeatures::SerializedKeyframeFeatures(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.feature_)*/{}
+  , /*decltype(_impl_.bow_)*/nullptr
+  , /*decltype(_impl_.keyframe_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeFeaturesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeFeaturesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeFeaturesDefaultTypeInternal() {}
+  union {
+    SerializedKeyframeFeatures _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeFeaturesDefaultTypeInternal _SerializedKeyframeFeatures_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframeColumnarFeatures::SerializedKeyframeColumnarFeatures(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ptx_)*/{}
+  , /*decltype(_impl_.pty_)*/{}
+  , /*decltype(_impl_.angle_)*/{}
+  , /*decltype(_impl_.octave_)*/{}
+  , /*decltype(_impl_._octave_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.mappoint_id_)*/{}
+  , /*decltype(_impl_._mappoint_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.quantizedptx_)*/{}
+  , /*decltype(_impl_._quantizedptx_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.quantizedpty_)*/{}
+  , /*decltype(_impl_._quantizedpty_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.briefdescriptors_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.quantizedangle_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bow_)*/nullptr
+  , /*decltype(_impl_.keyframe_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeColumnarFeaturesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeColumnarFeaturesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeColumnarFeaturesDefaultTypeInternal() {}
+  union {
+    SerializedKeyframeColumnarFeatures _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeColumnarFeaturesDefaultTypeInternal _SerializedKeyframeColumnarFeatures_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframeFeaturesArray::SerializedKeyframeFeaturesArray(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.feature_)*/{}
+  , /*decltype(_impl_.columnarfeature_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeFeaturesArrayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeFeaturesArrayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeFeaturesArrayDefaultTypeInternal() {}
+  union {
+    SerializedKeyframeFeaturesArray _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeFeaturesArrayDefaultTypeInternal _SerializedKeyframeFeaturesArray_default_instance_;
+PROTOBUF_CONSTEXPR SerializedJournalEntry::SerializedJournalEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mappoint_)*/{}
+  , /*decltype(_impl_.keyframe_)*/{}
+  , /*decltype(_impl_.features_)*/{}
+  , /*decltype(_impl_.erasedmappointsids_)*/{}
+  , /*decltype(_impl_._erasedmappointsids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.erasedkeyframesids_)*/{}
+  , /*decltype(_impl_._erasedkeyframesids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.mappointwatermark_)*/0u
+  , /*decltype(_impl_.keyframewatermark_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedJournalEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedJournalEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedJournalEntryDefaultTypeInternal() {}
+  union {
+    SerializedJournalEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedJournalEntryDefaultTypeInternal _SerializedJournalEntry_default_instance_;
+PROTOBUF_CONSTEXPR SerializedKeyframeDatabase::SerializedKeyframeDatabase(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.worddelta_)*/{}
+  , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nkeyframes_)*/{}
+  , /*decltype(_impl_._nkeyframes_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.keyframedelta_)*/{}
+  , /*decltype(_impl_._keyframedelta_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SerializedKeyframeDatabaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SerializedKeyframeDatabaseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SerializedKeyframeDatabaseDefaultTypeInternal() {}
+  union {
+    SerializedKeyframeDatabase _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SerializedKeyframeDatabaseDefaultTypeInternal _SerializedKeyframeDatabase_default_instance_;
+static ::_pb::Metadata file_level_metadata_osmap_2eproto[17];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_osmap_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_osmap_2eproto = nullptr;
 
-namespace protobuf_osmap_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SerializedDescriptor;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SerializedK;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SerializedKeypoint;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SerializedPose;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_SerializedPosition;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_SerializedKeyframeFeatures;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_SerializedFeature;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_SerializedKeyframe;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_osmap_2eproto ::google::protobuf::internal::SCCInfo<2> scc_info_SerializedMappoint;
-}  // namespace protobuf_osmap_2eproto
-class SerializedDescriptorDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedDescriptor>
-      _instance;
-} _SerializedDescriptor_default_instance_;
-class SerializedPoseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedPose>
-      _instance;
-} _SerializedPose_default_instance_;
-class SerializedPositionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedPosition>
-      _instance;
-} _SerializedPosition_default_instance_;
-class SerializedKeypointDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKeypoint>
-      _instance;
-} _SerializedKeypoint_default_instance_;
-class SerializedKDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedK>
-      _instance;
-} _SerializedK_default_instance_;
-class SerializedKArrayDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKArray>
-      _instance;
-} _SerializedKArray_default_instance_;
-class SerializedMappointDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedMappoint>
-      _instance;
-} _SerializedMappoint_default_instance_;
-class SerializedMappointArrayDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedMappointArray>
-      _instance;
-} _SerializedMappointArray_default_instance_;
-class SerializedKeyframeDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKeyframe>
-      _instance;
-} _SerializedKeyframe_default_instance_;
-class SerializedKeyframeArrayDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKeyframeArray>
-      _instance;
-} _SerializedKeyframeArray_default_instance_;
-class SerializedFeatureDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedFeature>
-      _instance;
-} _SerializedFeature_default_instance_;
-class SerializedKeyframeFeaturesDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKeyframeFeatures>
-      _instance;
-} _SerializedKeyframeFeatures_default_instance_;
-class SerializedKeyframeFeaturesArrayDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<SerializedKeyframeFeaturesArray>
-      _instance;
-} _SerializedKeyframeFeaturesArray_default_instance_;
-namespace protobuf_osmap_2eproto {
-static void InitDefaultsSerializedDescriptor() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedDescriptor_default_instance_;
-    new (ptr) ::SerializedDescriptor();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedDescriptor::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SerializedDescriptor =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSerializedDescriptor}, {}};
-
-static void InitDefaultsSerializedPose() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedPose_default_instance_;
-    new (ptr) ::SerializedPose();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedPose::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SerializedPose =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSerializedPose}, {}};
-
-static void InitDefaultsSerializedPosition() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedPosition_default_instance_;
-    new (ptr) ::SerializedPosition();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedPosition::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SerializedPosition =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSerializedPosition}, {}};
-
-static void InitDefaultsSerializedKeypoint() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKeypoint_default_instance_;
-    new (ptr) ::SerializedKeypoint();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKeypoint::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SerializedKeypoint =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSerializedKeypoint}, {}};
-
-static void InitDefaultsSerializedK() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedK_default_instance_;
-    new (ptr) ::SerializedK();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedK::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_SerializedK =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsSerializedK}, {}};
-
-static void InitDefaultsSerializedKArray() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKArray_default_instance_;
-    new (ptr) ::SerializedKArray();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKArray::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SerializedKArray =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSerializedKArray}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedK.base,}};
-
-static void InitDefaultsSerializedMappoint() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedMappoint_default_instance_;
-    new (ptr) ::SerializedMappoint();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedMappoint::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_SerializedMappoint =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsSerializedMappoint}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedPosition.base,
-      &protobuf_osmap_2eproto::scc_info_SerializedDescriptor.base,}};
-
-static void InitDefaultsSerializedMappointArray() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedMappointArray_default_instance_;
-    new (ptr) ::SerializedMappointArray();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedMappointArray::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SerializedMappointArray =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSerializedMappointArray}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedMappoint.base,}};
-
-static void InitDefaultsSerializedKeyframe() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKeyframe_default_instance_;
-    new (ptr) ::SerializedKeyframe();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKeyframe::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_SerializedKeyframe =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsSerializedKeyframe}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedPose.base,
-      &protobuf_osmap_2eproto::scc_info_SerializedK.base,}};
-
-static void InitDefaultsSerializedKeyframeArray() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKeyframeArray_default_instance_;
-    new (ptr) ::SerializedKeyframeArray();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKeyframeArray::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SerializedKeyframeArray =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSerializedKeyframeArray}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframe.base,}};
-
-static void InitDefaultsSerializedFeature() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedFeature_default_instance_;
-    new (ptr) ::SerializedFeature();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedFeature::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_SerializedFeature =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsSerializedFeature}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedKeypoint.base,
-      &protobuf_osmap_2eproto::scc_info_SerializedDescriptor.base,}};
-
-static void InitDefaultsSerializedKeyframeFeatures() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKeyframeFeatures_default_instance_;
-    new (ptr) ::SerializedKeyframeFeatures();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKeyframeFeatures::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SerializedKeyframeFeatures =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSerializedKeyframeFeatures}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedFeature.base,}};
-
-static void InitDefaultsSerializedKeyframeFeaturesArray() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::_SerializedKeyframeFeaturesArray_default_instance_;
-    new (ptr) ::SerializedKeyframeFeaturesArray();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::SerializedKeyframeFeaturesArray::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_SerializedKeyframeFeaturesArray =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsSerializedKeyframeFeaturesArray}, {
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframeFeatures.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedDescriptor.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedPose.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedPosition.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKeypoint.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedK.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKArray.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedMappoint.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedMappointArray.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKeyframe.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKeyframeArray.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedFeature.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKeyframeFeatures.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_SerializedKeyframeFeaturesArray.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[13];
-
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_osmap_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedDescriptor, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedDescriptor, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedDescriptor, block_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedDescriptor, _impl_.block_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPose, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPose, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPose, element_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedPose, _impl_.element_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPose, _impl_.quantized_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPose, _impl_.quaternion_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPose, _impl_.delta_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPosition, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPosition, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPosition, x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPosition, y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedPosition, z_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedPosition, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPosition, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPosition, _impl_.z_),
+  PROTOBUF_FIELD_OFFSET(::SerializedPosition, _impl_.quantized_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeypoint, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeypoint, ptx_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeypoint, pty_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeypoint, angle_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeypoint, octave_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.ptx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.pty_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.angle_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.octave_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.quantizedptx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.quantizedpty_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeypoint, _impl_.quantizedangle_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedK, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedK, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedK, fx_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedK, fy_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedK, cx_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedK, cy_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedK, _impl_.fx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedK, _impl_.fy_),
+  PROTOBUF_FIELD_OFFSET(::SerializedK, _impl_.cx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedK, _impl_.cy_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKArray, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKArray, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKArray, k_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKArray, _impl_.k_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, position_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, visible_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, found_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappoint, briefdescriptor_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.visible_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.found_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.briefdescriptor_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.normal_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.mindistance_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.maxdistance_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappoint, _impl_.refkeyframeid_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappointArray, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedMappointArray, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedMappointArray, mappoint_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedMappointArray, _impl_.mappoint_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, pose_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, kmatrix_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, kindex_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, loopedgesids_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframe, timestamp_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.pose_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.kmatrix_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.kindex_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.loopedgesids_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.timestampdelta_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.loopedgesdeltas_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.covisibleids_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.covisibleweights_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframe, _impl_.parentid_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeArray, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeArray, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeArray, keyframe_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeArray, _impl_.keyframe_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedFeature, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedFeature, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedFeature, mappoint_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedFeature, keypoint_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedFeature, briefdescriptor_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedFeature, _impl_.mappoint_id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedFeature, _impl_.keypoint_),
+  PROTOBUF_FIELD_OFFSET(::SerializedFeature, _impl_.briefdescriptor_),
+  PROTOBUF_FIELD_OFFSET(::SerializedFeature, _impl_.descriptorresidual_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeFeatures, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeFeatures, keyframe_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeFeatures, feature_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _impl_.worddelta_),
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _impl_.wordvalue_),
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _impl_.nodedelta_),
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _impl_.nodesize_),
+  PROTOBUF_FIELD_OFFSET(::SerializedBow, _impl_.nodefeature_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeFeaturesArray, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeatures, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::SerializedKeyframeFeaturesArray, feature_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeatures, _impl_.keyframe_id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeatures, _impl_.feature_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeatures, _impl_.bow_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.keyframe_id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.ptx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.pty_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.angle_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.octave_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.mappoint_id_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.briefdescriptors_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.quantizedptx_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.quantizedpty_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.quantizedangle_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeColumnarFeatures, _impl_.bow_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeaturesArray, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeaturesArray, _impl_.feature_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeFeaturesArray, _impl_.columnarfeature_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.mappoint_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.keyframe_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.features_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.erasedmappointsids_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.erasedkeyframesids_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.mappointwatermark_),
+  PROTOBUF_FIELD_OFFSET(::SerializedJournalEntry, _impl_.keyframewatermark_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeDatabase, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeDatabase, _impl_.worddelta_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeDatabase, _impl_.nkeyframes_),
+  PROTOBUF_FIELD_OFFSET(::SerializedKeyframeDatabase, _impl_.keyframedelta_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::SerializedDescriptor)},
-  { 6, -1, sizeof(::SerializedPose)},
-  { 12, -1, sizeof(::SerializedPosition)},
-  { 20, -1, sizeof(::SerializedKeypoint)},
-  { 29, -1, sizeof(::SerializedK)},
-  { 38, -1, sizeof(::SerializedKArray)},
-  { 44, -1, sizeof(::SerializedMappoint)},
-  { 54, -1, sizeof(::SerializedMappointArray)},
-  { 60, -1, sizeof(::SerializedKeyframe)},
-  { 71, -1, sizeof(::SerializedKeyframeArray)},
-  { 77, -1, sizeof(::SerializedFeature)},
-  { 85, -1, sizeof(::SerializedKeyframeFeatures)},
-  { 92, -1, sizeof(::SerializedKeyframeFeaturesArray)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::SerializedDescriptor)},
+  { 7, -1, -1, sizeof(::SerializedPose)},
+  { 17, -1, -1, sizeof(::SerializedPosition)},
+  { 27, -1, -1, sizeof(::SerializedKeypoint)},
+  { 40, -1, -1, sizeof(::SerializedK)},
+  { 50, -1, -1, sizeof(::SerializedKArray)},
+  { 57, -1, -1, sizeof(::SerializedMappoint)},
+  { 72, -1, -1, sizeof(::SerializedMappointArray)},
+  { 79, -1, -1, sizeof(::SerializedKeyframe)},
+  { 96, -1, -1, sizeof(::SerializedKeyframeArray)},
+  { 103, -1, -1, sizeof(::SerializedFeature)},
+  { 113, -1, -1, sizeof(::SerializedBow)},
+  { 124, -1, -1, sizeof(::SerializedKeyframeFeatures)},
+  { 133, -1, -1, sizeof(::SerializedKeyframeColumnarFeatures)},
+  { 150, -1, -1, sizeof(::SerializedKeyframeFeaturesArray)},
+  { 158, -1, -1, sizeof(::SerializedJournalEntry)},
+  { 171, -1, -1, sizeof(::SerializedKeyframeDatabase)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedDescriptor_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedPose_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedPosition_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKeypoint_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedK_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKArray_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedMappoint_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedMappointArray_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKeyframe_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKeyframeArray_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedFeature_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKeyframeFeatures_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::_SerializedKeyframeFeaturesArray_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_SerializedDescriptor_default_instance_._instance,
+  &::_SerializedPose_default_instance_._instance,
+  &::_SerializedPosition_default_instance_._instance,
+  &::_SerializedKeypoint_default_instance_._instance,
+  &::_SerializedK_default_instance_._instance,
+  &::_SerializedKArray_default_instance_._instance,
+  &::_SerializedMappoint_default_instance_._instance,
+  &::_SerializedMappointArray_default_instance_._instance,
+  &::_SerializedKeyframe_default_instance_._instance,
+  &::_SerializedKeyframeArray_default_instance_._instance,
+  &::_SerializedFeature_default_instance_._instance,
+  &::_SerializedBow_default_instance_._instance,
+  &::_SerializedKeyframeFeatures_default_instance_._instance,
+  &::_SerializedKeyframeColumnarFeatures_default_instance_._instance,
+  &::_SerializedKeyframeFeaturesArray_default_instance_._instance,
+  &::_SerializedJournalEntry_default_instance_._instance,
+  &::_SerializedKeyframeDatabase_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "osmap.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 13);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\013osmap.proto\"%\n\024SerializedDescriptor\022\r\n"
-      "\005block\030\001 \003(\007\"!\n\016SerializedPose\022\017\n\007elemen"
-      "t\030\001 \003(\002\"5\n\022SerializedPosition\022\t\n\001x\030\001 \001(\002"
-      "\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"M\n\022SerializedKeyp"
-      "oint\022\013\n\003ptx\030\001 \001(\002\022\013\n\003pty\030\002 \001(\002\022\r\n\005angle\030"
-      "\003 \001(\002\022\016\n\006octave\030\004 \001(\002\"=\n\013SerializedK\022\n\n\002"
-      "fx\030\001 \001(\002\022\n\n\002fy\030\002 \001(\002\022\n\n\002cx\030\003 \001(\002\022\n\n\002cy\030\004"
-      " \001(\002\"+\n\020SerializedKArray\022\027\n\001k\030\001 \003(\0132\014.Se"
-      "rializedK\"\227\001\n\022SerializedMappoint\022\n\n\002id\030\001"
-      " \001(\r\022%\n\010position\030\002 \001(\0132\023.SerializedPosit"
-      "ion\022\017\n\007visible\030\003 \001(\002\022\r\n\005found\030\004 \001(\002\022.\n\017b"
-      "riefdescriptor\030\005 \001(\0132\025.SerializedDescrip"
-      "tor\"@\n\027SerializedMappointArray\022%\n\010mappoi"
-      "nt\030\001 \003(\0132\023.SerializedMappoint\"\227\001\n\022Serial"
-      "izedKeyframe\022\n\n\002id\030\001 \001(\r\022\035\n\004pose\030\002 \001(\0132\017"
-      ".SerializedPose\022\035\n\007kmatrix\030\003 \001(\0132\014.Seria"
-      "lizedK\022\016\n\006kindex\030\004 \001(\r\022\024\n\014loopedgesids\030\005"
-      " \003(\r\022\021\n\ttimestamp\030\006 \001(\001\"@\n\027SerializedKey"
-      "frameArray\022%\n\010keyframe\030\001 \003(\0132\023.Serialize"
-      "dKeyframe\"\177\n\021SerializedFeature\022\023\n\013mappoi"
-      "nt_id\030\002 \001(\r\022%\n\010keypoint\030\003 \001(\0132\023.Serializ"
-      "edKeypoint\022.\n\017briefdescriptor\030\004 \001(\0132\025.Se"
-      "rializedDescriptor\"V\n\032SerializedKeyframe"
-      "Features\022\023\n\013keyframe_id\030\001 \001(\r\022#\n\007feature"
-      "\030\002 \003(\0132\022.SerializedFeature\"O\n\037Serialized"
-      "KeyframeFeaturesArray\022,\n\007feature\030\001 \003(\0132\033"
-      ".SerializedKeyframeFeaturesb\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 1075);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "osmap.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_osmap_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013osmap.proto\"%\n\024SerializedDescriptor\022\r\n"
+  "\005block\030\001 \003(\007\"W\n\016SerializedPose\022\017\n\007elemen"
+  "t\030\001 \003(\002\022\021\n\tquantized\030\002 \003(\021\022\022\n\nquaternion"
+  "\030\003 \003(\002\022\r\n\005delta\030\004 \003(\021\"H\n\022SerializedPosit"
+  "ion\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\022\021\n\t"
+  "quantized\030\004 \001(\006\"\221\001\n\022SerializedKeypoint\022\013"
+  "\n\003ptx\030\001 \001(\002\022\013\n\003pty\030\002 \001(\002\022\r\n\005angle\030\003 \001(\002\022"
+  "\016\n\006octave\030\004 \001(\002\022\024\n\014quantizedptx\030\005 \001(\021\022\024\n"
+  "\014quantizedpty\030\006 \001(\021\022\026\n\016quantizedangle\030\007 "
+  "\001(\r\"=\n\013SerializedK\022\n\n\002fx\030\001 \001(\002\022\n\n\002fy\030\002 \001"
+  "(\002\022\n\n\002cx\030\003 \001(\002\022\n\n\002cy\030\004 \001(\002\"+\n\020Serialized"
+  "KArray\022\027\n\001k\030\001 \003(\0132\014.SerializedK\"\350\001\n\022Seri"
+  "alizedMappoint\022\n\n\002id\030\001 \001(\r\022%\n\010position\030\002"
+  " \001(\0132\023.SerializedPosition\022\017\n\007visible\030\003 \001"
+  "(\002\022\r\n\005found\030\004 \001(\002\022.\n\017briefdescriptor\030\005 \001"
+  "(\0132\025.SerializedDescriptor\022\016\n\006normal\030\006 \003("
+  "\002\022\023\n\013mindistance\030\007 \001(\002\022\023\n\013maxdistance\030\010 "
+  "\001(\002\022\025\n\rrefkeyframeid\030\t \001(\r\"@\n\027Serialized"
+  "MappointArray\022%\n\010mappoint\030\001 \003(\0132\023.Serial"
+  "izedMappoint\"\212\002\n\022SerializedKeyframe\022\n\n\002i"
+  "d\030\001 \001(\r\022\035\n\004pose\030\002 \001(\0132\017.SerializedPose\022\035"
+  "\n\007kmatrix\030\003 \001(\0132\014.SerializedK\022\016\n\006kindex\030"
+  "\004 \001(\r\022\024\n\014loopedgesids\030\005 \003(\r\022\021\n\ttimestamp"
+  "\030\006 \001(\001\022\026\n\016timestampdelta\030\007 \001(\022\022\027\n\017looped"
+  "gesdeltas\030\010 \003(\r\022\024\n\014covisibleids\030\t \003(\r\022\030\n"
+  "\020covisibleweights\030\n \003(\r\022\020\n\010parentid\030\013 \001("
+  "\r\"@\n\027SerializedKeyframeArray\022%\n\010keyframe"
+  "\030\001 \003(\0132\023.SerializedKeyframe\"\233\001\n\021Serializ"
+  "edFeature\022\023\n\013mappoint_id\030\002 \001(\r\022%\n\010keypoi"
+  "nt\030\003 \001(\0132\023.SerializedKeypoint\022.\n\017briefde"
+  "scriptor\030\004 \001(\0132\025.SerializedDescriptor\022\032\n"
+  "\022descriptorresidual\030\005 \001(\014\"o\n\rSerializedB"
+  "ow\022\021\n\tworddelta\030\001 \003(\r\022\021\n\twordvalue\030\002 \003(\001"
+  "\022\021\n\tnodedelta\030\003 \003(\r\022\020\n\010nodesize\030\004 \003(\r\022\023\n"
+  "\013nodefeature\030\005 \003(\r\"s\n\032SerializedKeyframe"
+  "Features\022\023\n\013keyframe_id\030\001 \001(\r\022#\n\007feature"
+  "\030\002 \003(\0132\022.SerializedFeature\022\033\n\003bow\030\003 \001(\0132"
+  "\016.SerializedBow\"\202\002\n\"SerializedKeyframeCo"
+  "lumnarFeatures\022\023\n\013keyframe_id\030\001 \001(\r\022\013\n\003p"
+  "tx\030\002 \003(\002\022\013\n\003pty\030\003 \003(\002\022\r\n\005angle\030\004 \003(\002\022\016\n\006"
+  "octave\030\005 \003(\r\022\023\n\013mappoint_id\030\006 \003(\r\022\030\n\020bri"
+  "efdescriptors\030\007 \001(\014\022\024\n\014quantizedptx\030\010 \003("
+  "\021\022\024\n\014quantizedpty\030\t \003(\021\022\026\n\016quantizedangl"
+  "e\030\n \001(\014\022\033\n\003bow\030\013 \001(\0132\016.SerializedBow\"\215\001\n"
+  "\037SerializedKeyframeFeaturesArray\022,\n\007feat"
+  "ure\030\001 \003(\0132\033.SerializedKeyframeFeatures\022<"
+  "\n\017columnarfeature\030\002 \003(\0132#.SerializedKeyf"
+  "rameColumnarFeatures\"\203\002\n\026SerializedJourn"
+  "alEntry\022%\n\010mappoint\030\001 \003(\0132\023.SerializedMa"
+  "ppoint\022%\n\010keyframe\030\002 \003(\0132\023.SerializedKey"
+  "frame\022-\n\010features\030\003 \003(\0132\033.SerializedKeyf"
+  "rameFeatures\022\032\n\022erasedmappointsids\030\004 \003(\r"
+  "\022\032\n\022erasedkeyframesids\030\005 \003(\r\022\031\n\021mappoint"
+  "watermark\030\006 \001(\r\022\031\n\021keyframewatermark\030\007 \001"
+  "(\r\"Z\n\032SerializedKeyframeDatabase\022\021\n\tword"
+  "delta\030\001 \003(\r\022\022\n\nnkeyframes\030\002 \003(\r\022\025\n\rkeyfr"
+  "amedelta\030\003 \003(\rb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_osmap_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_osmap_2eproto = {
+    false, false, 2262, descriptor_table_protodef_osmap_2eproto,
+    "osmap.proto",
+    &descriptor_table_osmap_2eproto_once, nullptr, 0, 17,
+    schemas, file_default_instances, TableStruct_osmap_2eproto::offsets,
+    file_level_metadata_osmap_2eproto, file_level_enum_descriptors_osmap_2eproto,
+    file_level_service_descriptors_osmap_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_osmap_2eproto_getter() {
+  return &descriptor_table_osmap_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_osmap_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_osmap_2eproto(&descriptor_table_osmap_2eproto);
 
 // ===================================================================
 
-void SerializedDescriptor::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedDescriptor::kBlockFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedDescriptor::_Internal {
+ public:
+};
 
-SerializedDescriptor::SerializedDescriptor()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedDescriptor.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedDescriptor)
+SerializedDescriptor::SerializedDescriptor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedDescriptor)
 }
 SerializedDescriptor::SerializedDescriptor(const SerializedDescriptor& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      block_(from.block_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedDescriptor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_){from._impl_.block_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SerializedDescriptor)
 }
 
-void SerializedDescriptor::SharedCtor() {
+inline void SerializedDescriptor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.block_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedDescriptor::~SerializedDescriptor() {
   // @@protoc_insertion_point(destructor:SerializedDescriptor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedDescriptor::SharedDtor() {
+inline void SerializedDescriptor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.block_.~RepeatedField();
 }
 
 void SerializedDescriptor::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedDescriptor::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedDescriptor& SerializedDescriptor::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedDescriptor.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SerializedDescriptor::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedDescriptor)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  block_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.block_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedDescriptor::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedDescriptor)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedDescriptor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated fixed32 block = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
-                 input, this->mutable_block())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
-                 1, 10u, input, this->mutable_block())));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_block(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 13) {
+          _internal_add_block(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr));
+          ptr += sizeof(uint32_t);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedDescriptor)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedDescriptor)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedDescriptor::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedDescriptor)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedDescriptor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedDescriptor)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated fixed32 block = 1;
-  if (this->block_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _block_cached_byte_size_));
-    ::google::protobuf::internal::WireFormatLite::WriteFixed32Array(
-      this->block().data(), this->block_size(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (this->_internal_block_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_block(), target);
   }
-  // @@protoc_insertion_point(serialize_end:SerializedDescriptor)
-}
 
-::google::protobuf::uint8* SerializedDescriptor::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedDescriptor)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated fixed32 block = 1;
-  if (this->block_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _block_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFixed32NoTagToArray(this->block_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedDescriptor)
   return target;
@@ -667,62 +746,41 @@ size_t SerializedDescriptor::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedDescriptor)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated fixed32 block = 1;
   {
-    unsigned int count = static_cast<unsigned int>(this->block_size());
+    unsigned int count = static_cast<unsigned int>(this->_internal_block_size());
     size_t data_size = 4UL * count;
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _block_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
     total_size += data_size;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedDescriptor::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedDescriptor)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedDescriptor* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedDescriptor>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedDescriptor)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedDescriptor)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedDescriptor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedDescriptor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedDescriptor::GetClassData() const { return &_class_data_; }
 
-void SerializedDescriptor::MergeFrom(const SerializedDescriptor& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedDescriptor)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  block_.MergeFrom(from.block_);
-}
+void SerializedDescriptor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedDescriptor*>(&to_msg);
+  auto& from = static_cast<const SerializedDescriptor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedDescriptor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedDescriptor::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedDescriptor)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.block_.MergeFrom(from._impl_.block_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedDescriptor::CopyFrom(const SerializedDescriptor& from) {
@@ -736,174 +794,205 @@ bool SerializedDescriptor::IsInitialized() const {
   return true;
 }
 
-void SerializedDescriptor::Swap(SerializedDescriptor* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedDescriptor::InternalSwap(SerializedDescriptor* other) {
   using std::swap;
-  block_.InternalSwap(&other->block_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.block_.InternalSwap(&other->_impl_.block_);
 }
 
-::google::protobuf::Metadata SerializedDescriptor::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedDescriptor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void SerializedPose::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedPose::kElementFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedPose::_Internal {
+ public:
+};
 
-SerializedPose::SerializedPose()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedPose.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedPose)
+SerializedPose::SerializedPose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedPose)
 }
 SerializedPose::SerializedPose(const SerializedPose& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      element_(from.element_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedPose* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){from._impl_.element_}
+    , decltype(_impl_.quantized_){from._impl_.quantized_}
+    , /*decltype(_impl_._quantized_cached_byte_size_)*/{0}
+    , decltype(_impl_.quaternion_){from._impl_.quaternion_}
+    , decltype(_impl_.delta_){from._impl_.delta_}
+    , /*decltype(_impl_._delta_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SerializedPose)
 }
 
-void SerializedPose::SharedCtor() {
+inline void SerializedPose::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.element_){arena}
+    , decltype(_impl_.quantized_){arena}
+    , /*decltype(_impl_._quantized_cached_byte_size_)*/{0}
+    , decltype(_impl_.quaternion_){arena}
+    , decltype(_impl_.delta_){arena}
+    , /*decltype(_impl_._delta_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedPose::~SerializedPose() {
   // @@protoc_insertion_point(destructor:SerializedPose)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedPose::SharedDtor() {
+inline void SerializedPose::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.element_.~RepeatedField();
+  _impl_.quantized_.~RepeatedField();
+  _impl_.quaternion_.~RepeatedField();
+  _impl_.delta_.~RepeatedField();
 }
 
 void SerializedPose::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedPose::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedPose& SerializedPose::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedPose.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SerializedPose::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedPose)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  element_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.element_.Clear();
+  _impl_.quantized_.Clear();
+  _impl_.quaternion_.Clear();
+  _impl_.delta_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedPose::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedPose)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedPose::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated float element = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, this->mutable_element())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 1, 10u, input, this->mutable_element())));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_element(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 13) {
+          _internal_add_element(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 quantized = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_quantized(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_quantized(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float quaternion = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_quaternion(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_quaternion(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 delta = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_delta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_delta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedPose)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedPose)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedPose::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedPose)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedPose::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedPose)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated float element = 1;
-  if (this->element_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _element_cached_byte_size_));
-    ::google::protobuf::internal::WireFormatLite::WriteFloatArray(
-      this->element().data(), this->element_size(), output);
+  if (this->_internal_element_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_element(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // repeated sint32 quantized = 2;
+  {
+    int byte_size = _impl_._quantized_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          2, _internal_quantized(), byte_size, target);
+    }
   }
-  // @@protoc_insertion_point(serialize_end:SerializedPose)
-}
 
-::google::protobuf::uint8* SerializedPose::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedPose)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // repeated float quaternion = 3;
+  if (this->_internal_quaternion_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_quaternion(), target);
+  }
 
-  // repeated float element = 1;
-  if (this->element_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      1,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _element_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFloatNoTagToArray(this->element_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // repeated sint32 delta = 4;
+  {
+    int byte_size = _impl_._delta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          4, _internal_delta(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedPose)
   return target;
@@ -913,62 +1002,83 @@ size_t SerializedPose::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedPose)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated float element = 1;
   {
-    unsigned int count = static_cast<unsigned int>(this->element_size());
+    unsigned int count = static_cast<unsigned int>(this->_internal_element_size());
     size_t data_size = 4UL * count;
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _element_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
     total_size += data_size;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // repeated sint32 quantized = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.quantized_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._quantized_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float quaternion = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_quaternion_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
 
-void SerializedPose::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedPose)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedPose* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedPose>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedPose)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedPose)
-    MergeFrom(*source);
+  // repeated sint32 delta = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.delta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._delta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedPose::MergeFrom(const SerializedPose& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedPose)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedPose::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedPose::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedPose::GetClassData() const { return &_class_data_; }
 
-  element_.MergeFrom(from.element_);
-}
 
-void SerializedPose::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedPose)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void SerializedPose::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedPose*>(&to_msg);
+  auto& from = static_cast<const SerializedPose&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedPose)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.element_.MergeFrom(from._impl_.element_);
+  _this->_impl_.quantized_.MergeFrom(from._impl_.quantized_);
+  _this->_impl_.quaternion_.MergeFrom(from._impl_.quaternion_);
+  _this->_impl_.delta_.MergeFrom(from._impl_.delta_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedPose::CopyFrom(const SerializedPose& from) {
@@ -982,214 +1092,198 @@ bool SerializedPose::IsInitialized() const {
   return true;
 }
 
-void SerializedPose::Swap(SerializedPose* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedPose::InternalSwap(SerializedPose* other) {
   using std::swap;
-  element_.InternalSwap(&other->element_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.element_.InternalSwap(&other->_impl_.element_);
+  _impl_.quantized_.InternalSwap(&other->_impl_.quantized_);
+  _impl_.quaternion_.InternalSwap(&other->_impl_.quaternion_);
+  _impl_.delta_.InternalSwap(&other->_impl_.delta_);
 }
 
-::google::protobuf::Metadata SerializedPose::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedPose::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void SerializedPosition::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedPosition::kXFieldNumber;
-const int SerializedPosition::kYFieldNumber;
-const int SerializedPosition::kZFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedPosition::_Internal {
+ public:
+};
 
-SerializedPosition::SerializedPosition()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedPosition.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedPosition)
+SerializedPosition::SerializedPosition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedPosition)
 }
 SerializedPosition::SerializedPosition(const SerializedPosition& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&z_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(z_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedPosition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.quantized_){}
+    , decltype(_impl_.z_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
   // @@protoc_insertion_point(copy_constructor:SerializedPosition)
 }
 
-void SerializedPosition::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
+inline void SerializedPosition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.quantized_){uint64_t{0u}}
+    , decltype(_impl_.z_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedPosition::~SerializedPosition() {
   // @@protoc_insertion_point(destructor:SerializedPosition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedPosition::SharedDtor() {
+inline void SerializedPosition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SerializedPosition::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedPosition::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const SerializedPosition& SerializedPosition::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedPosition.base);
-  return *internal_default_instance();
-}
-
-
 void SerializedPosition::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedPosition)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
-  _internal_metadata_.Clear();
-}
-
-bool SerializedPosition::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedPosition)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // float x = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &x_)));
-        } else {
-          goto handle_unusual;
-        }
-        break;
-      }
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.z_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
+const char* SerializedPosition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float x = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // float y = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &y_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float z = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &z_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // fixed64 quantized = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.quantized_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedPosition)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedPosition)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedPosition::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedPosition)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedPosition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedPosition)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float x = 1;
-  if (this->x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->x(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // float y = 2;
-  if (this->y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->y(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
   // float z = 3;
-  if (this->z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->z(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedPosition)
-}
-
-::google::protobuf::uint8* SerializedPosition::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedPosition)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // float x = 1;
-  if (this->x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->x(), target);
-  }
-
-  // float y = 2;
-  if (this->y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
   }
 
-  // float z = 3;
-  if (this->z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->z(), target);
+  // fixed64 quantized = 4;
+  if (this->_internal_quantized() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_quantized(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedPosition)
   return target;
@@ -1199,69 +1293,85 @@ size_t SerializedPosition::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedPosition)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // float x = 1;
-  if (this->x() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
   // float y = 2;
-  if (this->y() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
+  // fixed64 quantized = 4;
+  if (this->_internal_quantized() != 0) {
+    total_size += 1 + 8;
+  }
+
   // float z = 3;
-  if (this->z() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedPosition::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedPosition* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedPosition>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedPosition)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedPosition)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedPosition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedPosition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedPosition::GetClassData() const { return &_class_data_; }
+
 
-void SerializedPosition::MergeFrom(const SerializedPosition& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedPosition)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void SerializedPosition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedPosition*>(&to_msg);
+  auto& from = static_cast<const SerializedPosition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedPosition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.x() != 0) {
-    set_x(from.x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.y() != 0) {
-    set_y(from.y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-  if (from.z() != 0) {
-    set_z(from.z());
+  if (from._internal_quantized() != 0) {
+    _this->_internal_set_quantized(from._internal_quantized());
   }
-}
-
-void SerializedPosition::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedPosition)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedPosition::CopyFrom(const SerializedPosition& from) {
@@ -1275,241 +1385,252 @@ bool SerializedPosition::IsInitialized() const {
   return true;
 }
 
-void SerializedPosition::Swap(SerializedPosition* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedPosition::InternalSwap(SerializedPosition* other) {
   using std::swap;
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedPosition, _impl_.z_)
+      + sizeof(SerializedPosition::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(SerializedPosition, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata SerializedPosition::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedPosition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void SerializedKeypoint::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKeypoint::kPtxFieldNumber;
-const int SerializedKeypoint::kPtyFieldNumber;
-const int SerializedKeypoint::kAngleFieldNumber;
-const int SerializedKeypoint::kOctaveFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedKeypoint::_Internal {
+ public:
+};
 
-SerializedKeypoint::SerializedKeypoint()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKeypoint.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKeypoint)
+SerializedKeypoint::SerializedKeypoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeypoint)
 }
 SerializedKeypoint::SerializedKeypoint(const SerializedKeypoint& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&ptx_, &from.ptx_,
-    static_cast<size_t>(reinterpret_cast<char*>(&octave_) -
-    reinterpret_cast<char*>(&ptx_)) + sizeof(octave_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeypoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ptx_){}
+    , decltype(_impl_.pty_){}
+    , decltype(_impl_.angle_){}
+    , decltype(_impl_.octave_){}
+    , decltype(_impl_.quantizedptx_){}
+    , decltype(_impl_.quantizedpty_){}
+    , decltype(_impl_.quantizedangle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.ptx_, &from._impl_.ptx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.quantizedangle_) -
+    reinterpret_cast<char*>(&_impl_.ptx_)) + sizeof(_impl_.quantizedangle_));
   // @@protoc_insertion_point(copy_constructor:SerializedKeypoint)
 }
 
-void SerializedKeypoint::SharedCtor() {
-  ::memset(&ptx_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&octave_) -
-      reinterpret_cast<char*>(&ptx_)) + sizeof(octave_));
+inline void SerializedKeypoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ptx_){0}
+    , decltype(_impl_.pty_){0}
+    , decltype(_impl_.angle_){0}
+    , decltype(_impl_.octave_){0}
+    , decltype(_impl_.quantizedptx_){0}
+    , decltype(_impl_.quantizedpty_){0}
+    , decltype(_impl_.quantizedangle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedKeypoint::~SerializedKeypoint() {
   // @@protoc_insertion_point(destructor:SerializedKeypoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKeypoint::SharedDtor() {
+inline void SerializedKeypoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SerializedKeypoint::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedKeypoint::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const SerializedKeypoint& SerializedKeypoint::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKeypoint.base);
-  return *internal_default_instance();
-}
-
-
 void SerializedKeypoint::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedKeypoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&ptx_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&octave_) -
-      reinterpret_cast<char*>(&ptx_)) + sizeof(octave_));
-  _internal_metadata_.Clear();
-}
-
-bool SerializedKeypoint::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKeypoint)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.ptx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.quantizedangle_) -
+      reinterpret_cast<char*>(&_impl_.ptx_)) + sizeof(_impl_.quantizedangle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeypoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // float ptx = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &ptx_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.ptx_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float pty = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &pty_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.pty_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float angle = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &angle_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.angle_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float octave = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u /* 37 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &octave_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.octave_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // sint32 quantizedptx = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.quantizedptx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint32 quantizedpty = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.quantizedpty_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 quantizedangle = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.quantizedangle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKeypoint)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKeypoint)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedKeypoint::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKeypoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedKeypoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeypoint)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float ptx = 1;
-  if (this->ptx() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->ptx(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ptx = this->_internal_ptx();
+  uint32_t raw_ptx;
+  memcpy(&raw_ptx, &tmp_ptx, sizeof(tmp_ptx));
+  if (raw_ptx != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_ptx(), target);
   }
 
   // float pty = 2;
-  if (this->pty() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->pty(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pty = this->_internal_pty();
+  uint32_t raw_pty;
+  memcpy(&raw_pty, &tmp_pty, sizeof(tmp_pty));
+  if (raw_pty != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_pty(), target);
   }
 
   // float angle = 3;
-  if (this->angle() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->angle(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_angle = this->_internal_angle();
+  uint32_t raw_angle;
+  memcpy(&raw_angle, &tmp_angle, sizeof(tmp_angle));
+  if (raw_angle != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_angle(), target);
   }
 
   // float octave = 4;
-  if (this->octave() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->octave(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_octave = this->_internal_octave();
+  uint32_t raw_octave;
+  memcpy(&raw_octave, &tmp_octave, sizeof(tmp_octave));
+  if (raw_octave != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_octave(), target);
   }
-  // @@protoc_insertion_point(serialize_end:SerializedKeypoint)
-}
-
-::google::protobuf::uint8* SerializedKeypoint::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeypoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // float ptx = 1;
-  if (this->ptx() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->ptx(), target);
-  }
-
-  // float pty = 2;
-  if (this->pty() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->pty(), target);
+  // sint32 quantizedptx = 5;
+  if (this->_internal_quantizedptx() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(5, this->_internal_quantizedptx(), target);
   }
 
-  // float angle = 3;
-  if (this->angle() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->angle(), target);
+  // sint32 quantizedpty = 6;
+  if (this->_internal_quantizedpty() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt32ToArray(6, this->_internal_quantizedpty(), target);
   }
 
-  // float octave = 4;
-  if (this->octave() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->octave(), target);
+  // uint32 quantizedangle = 7;
+  if (this->_internal_quantizedangle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_quantizedangle(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedKeypoint)
   return target;
@@ -1519,77 +1640,117 @@ size_t SerializedKeypoint::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedKeypoint)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // float ptx = 1;
-  if (this->ptx() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ptx = this->_internal_ptx();
+  uint32_t raw_ptx;
+  memcpy(&raw_ptx, &tmp_ptx, sizeof(tmp_ptx));
+  if (raw_ptx != 0) {
     total_size += 1 + 4;
   }
 
   // float pty = 2;
-  if (this->pty() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pty = this->_internal_pty();
+  uint32_t raw_pty;
+  memcpy(&raw_pty, &tmp_pty, sizeof(tmp_pty));
+  if (raw_pty != 0) {
     total_size += 1 + 4;
   }
 
   // float angle = 3;
-  if (this->angle() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_angle = this->_internal_angle();
+  uint32_t raw_angle;
+  memcpy(&raw_angle, &tmp_angle, sizeof(tmp_angle));
+  if (raw_angle != 0) {
     total_size += 1 + 4;
   }
 
   // float octave = 4;
-  if (this->octave() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_octave = this->_internal_octave();
+  uint32_t raw_octave;
+  memcpy(&raw_octave, &tmp_octave, sizeof(tmp_octave));
+  if (raw_octave != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // sint32 quantizedptx = 5;
+  if (this->_internal_quantizedptx() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_quantizedptx());
+  }
+
+  // sint32 quantizedpty = 6;
+  if (this->_internal_quantizedpty() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt32SizePlusOne(this->_internal_quantizedpty());
+  }
 
-void SerializedKeypoint::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKeypoint)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKeypoint* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKeypoint>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKeypoint)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKeypoint)
-    MergeFrom(*source);
+  // uint32 quantizedangle = 7;
+  if (this->_internal_quantizedangle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_quantizedangle());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKeypoint::MergeFrom(const SerializedKeypoint& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeypoint)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeypoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeypoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeypoint::GetClassData() const { return &_class_data_; }
+
+
+void SerializedKeypoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeypoint*>(&to_msg);
+  auto& from = static_cast<const SerializedKeypoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeypoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.ptx() != 0) {
-    set_ptx(from.ptx());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ptx = from._internal_ptx();
+  uint32_t raw_ptx;
+  memcpy(&raw_ptx, &tmp_ptx, sizeof(tmp_ptx));
+  if (raw_ptx != 0) {
+    _this->_internal_set_ptx(from._internal_ptx());
   }
-  if (from.pty() != 0) {
-    set_pty(from.pty());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_pty = from._internal_pty();
+  uint32_t raw_pty;
+  memcpy(&raw_pty, &tmp_pty, sizeof(tmp_pty));
+  if (raw_pty != 0) {
+    _this->_internal_set_pty(from._internal_pty());
   }
-  if (from.angle() != 0) {
-    set_angle(from.angle());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_angle = from._internal_angle();
+  uint32_t raw_angle;
+  memcpy(&raw_angle, &tmp_angle, sizeof(tmp_angle));
+  if (raw_angle != 0) {
+    _this->_internal_set_angle(from._internal_angle());
   }
-  if (from.octave() != 0) {
-    set_octave(from.octave());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_octave = from._internal_octave();
+  uint32_t raw_octave;
+  memcpy(&raw_octave, &tmp_octave, sizeof(tmp_octave));
+  if (raw_octave != 0) {
+    _this->_internal_set_octave(from._internal_octave());
   }
-}
-
-void SerializedKeypoint::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKeypoint)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_quantizedptx() != 0) {
+    _this->_internal_set_quantizedptx(from._internal_quantizedptx());
+  }
+  if (from._internal_quantizedpty() != 0) {
+    _this->_internal_set_quantizedpty(from._internal_quantizedpty());
+  }
+  if (from._internal_quantizedangle() != 0) {
+    _this->_internal_set_quantizedangle(from._internal_quantizedangle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedKeypoint::CopyFrom(const SerializedKeypoint& from) {
@@ -1603,242 +1764,204 @@ bool SerializedKeypoint::IsInitialized() const {
   return true;
 }
 
-void SerializedKeypoint::Swap(SerializedKeypoint* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedKeypoint::InternalSwap(SerializedKeypoint* other) {
   using std::swap;
-  swap(ptx_, other->ptx_);
-  swap(pty_, other->pty_);
-  swap(angle_, other->angle_);
-  swap(octave_, other->octave_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedKeypoint, _impl_.quantizedangle_)
+      + sizeof(SerializedKeypoint::_impl_.quantizedangle_)
+      - PROTOBUF_FIELD_OFFSET(SerializedKeypoint, _impl_.ptx_)>(
+          reinterpret_cast<char*>(&_impl_.ptx_),
+          reinterpret_cast<char*>(&other->_impl_.ptx_));
 }
 
-::google::protobuf::Metadata SerializedKeypoint::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeypoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void SerializedK::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedK::kFxFieldNumber;
-const int SerializedK::kFyFieldNumber;
-const int SerializedK::kCxFieldNumber;
-const int SerializedK::kCyFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedK::_Internal {
+ public:
+};
 
-SerializedK::SerializedK()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedK.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedK)
+SerializedK::SerializedK(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedK)
 }
 SerializedK::SerializedK(const SerializedK& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&fx_, &from.fx_,
-    static_cast<size_t>(reinterpret_cast<char*>(&cy_) -
-    reinterpret_cast<char*>(&fx_)) + sizeof(cy_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedK* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.fx_){}
+    , decltype(_impl_.fy_){}
+    , decltype(_impl_.cx_){}
+    , decltype(_impl_.cy_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.fx_, &from._impl_.fx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cy_) -
+    reinterpret_cast<char*>(&_impl_.fx_)) + sizeof(_impl_.cy_));
   // @@protoc_insertion_point(copy_constructor:SerializedK)
 }
 
-void SerializedK::SharedCtor() {
-  ::memset(&fx_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&cy_) -
-      reinterpret_cast<char*>(&fx_)) + sizeof(cy_));
+inline void SerializedK::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.fx_){0}
+    , decltype(_impl_.fy_){0}
+    , decltype(_impl_.cx_){0}
+    , decltype(_impl_.cy_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedK::~SerializedK() {
   // @@protoc_insertion_point(destructor:SerializedK)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedK::SharedDtor() {
+inline void SerializedK::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void SerializedK::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedK::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedK& SerializedK::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedK.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SerializedK::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedK)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&fx_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&cy_) -
-      reinterpret_cast<char*>(&fx_)) + sizeof(cy_));
-  _internal_metadata_.Clear();
-}
-
-bool SerializedK::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedK)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.fx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cy_) -
+      reinterpret_cast<char*>(&_impl_.fx_)) + sizeof(_impl_.cy_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedK::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // float fx = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &fx_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.fx_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float fy = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &fy_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.fy_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float cx = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &cx_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.cx_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float cy = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u /* 37 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &cy_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.cy_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedK)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedK)
-  return false;
-#undef DO_
-}
-
-void SerializedK::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedK)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // float fx = 1;
-  if (this->fx() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->fx(), output);
-  }
-
-  // float fy = 2;
-  if (this->fy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->fy(), output);
-  }
-
-  // float cx = 3;
-  if (this->cx() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->cx(), output);
-  }
-
-  // float cy = 4;
-  if (this->cy() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->cy(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedK)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SerializedK::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SerializedK::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:SerializedK)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float fx = 1;
-  if (this->fx() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->fx(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fx = this->_internal_fx();
+  uint32_t raw_fx;
+  memcpy(&raw_fx, &tmp_fx, sizeof(tmp_fx));
+  if (raw_fx != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_fx(), target);
   }
 
   // float fy = 2;
-  if (this->fy() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->fy(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fy = this->_internal_fy();
+  uint32_t raw_fy;
+  memcpy(&raw_fy, &tmp_fy, sizeof(tmp_fy));
+  if (raw_fy != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_fy(), target);
   }
 
   // float cx = 3;
-  if (this->cx() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->cx(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cx = this->_internal_cx();
+  uint32_t raw_cx;
+  memcpy(&raw_cx, &tmp_cx, sizeof(tmp_cx));
+  if (raw_cx != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_cx(), target);
   }
 
   // float cy = 4;
-  if (this->cy() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->cy(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cy = this->_internal_cy();
+  uint32_t raw_cy;
+  memcpy(&raw_cy, &tmp_cy, sizeof(tmp_cy));
+  if (raw_cy != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_cy(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedK)
   return target;
@@ -1848,77 +1971,93 @@ size_t SerializedK::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedK)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // float fx = 1;
-  if (this->fx() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fx = this->_internal_fx();
+  uint32_t raw_fx;
+  memcpy(&raw_fx, &tmp_fx, sizeof(tmp_fx));
+  if (raw_fx != 0) {
     total_size += 1 + 4;
   }
 
   // float fy = 2;
-  if (this->fy() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fy = this->_internal_fy();
+  uint32_t raw_fy;
+  memcpy(&raw_fy, &tmp_fy, sizeof(tmp_fy));
+  if (raw_fy != 0) {
     total_size += 1 + 4;
   }
 
   // float cx = 3;
-  if (this->cx() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cx = this->_internal_cx();
+  uint32_t raw_cx;
+  memcpy(&raw_cx, &tmp_cx, sizeof(tmp_cx));
+  if (raw_cx != 0) {
     total_size += 1 + 4;
   }
 
   // float cy = 4;
-  if (this->cy() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cy = this->_internal_cy();
+  uint32_t raw_cy;
+  memcpy(&raw_cy, &tmp_cy, sizeof(tmp_cy));
+  if (raw_cy != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedK::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedK)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedK* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedK>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedK)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedK)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedK::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedK::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedK::GetClassData() const { return &_class_data_; }
 
-void SerializedK::MergeFrom(const SerializedK& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedK)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.fx() != 0) {
-    set_fx(from.fx());
-  }
-  if (from.fy() != 0) {
-    set_fy(from.fy());
-  }
-  if (from.cx() != 0) {
-    set_cx(from.cx());
-  }
-  if (from.cy() != 0) {
-    set_cy(from.cy());
-  }
-}
+void SerializedK::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedK*>(&to_msg);
+  auto& from = static_cast<const SerializedK&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedK)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedK::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedK)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fx = from._internal_fx();
+  uint32_t raw_fx;
+  memcpy(&raw_fx, &tmp_fx, sizeof(tmp_fx));
+  if (raw_fx != 0) {
+    _this->_internal_set_fx(from._internal_fx());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_fy = from._internal_fy();
+  uint32_t raw_fy;
+  memcpy(&raw_fy, &tmp_fy, sizeof(tmp_fy));
+  if (raw_fy != 0) {
+    _this->_internal_set_fy(from._internal_fy());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cx = from._internal_cx();
+  uint32_t raw_cx;
+  memcpy(&raw_cx, &tmp_cx, sizeof(tmp_cx));
+  if (raw_cx != 0) {
+    _this->_internal_set_cx(from._internal_cx());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cy = from._internal_cy();
+  uint32_t raw_cy;
+  memcpy(&raw_cy, &tmp_cy, sizeof(tmp_cy));
+  if (raw_cy != 0) {
+    _this->_internal_set_cy(from._internal_cy());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedK::CopyFrom(const SerializedK& from) {
@@ -1932,165 +2071,143 @@ bool SerializedK::IsInitialized() const {
   return true;
 }
 
-void SerializedK::Swap(SerializedK* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedK::InternalSwap(SerializedK* other) {
   using std::swap;
-  swap(fx_, other->fx_);
-  swap(fy_, other->fy_);
-  swap(cx_, other->cx_);
-  swap(cy_, other->cy_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedK, _impl_.cy_)
+      + sizeof(SerializedK::_impl_.cy_)
+      - PROTOBUF_FIELD_OFFSET(SerializedK, _impl_.fx_)>(
+          reinterpret_cast<char*>(&_impl_.fx_),
+          reinterpret_cast<char*>(&other->_impl_.fx_));
 }
 
-::google::protobuf::Metadata SerializedK::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedK::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void SerializedKArray::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKArray::kKFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedKArray::_Internal {
+ public:
+};
 
-SerializedKArray::SerializedKArray()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKArray.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKArray)
+SerializedKArray::SerializedKArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKArray)
 }
 SerializedKArray::SerializedKArray(const SerializedKArray& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      k_(from.k_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKArray* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.k_){from._impl_.k_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SerializedKArray)
 }
 
-void SerializedKArray::SharedCtor() {
+inline void SerializedKArray::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.k_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedKArray::~SerializedKArray() {
   // @@protoc_insertion_point(destructor:SerializedKArray)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKArray::SharedDtor() {
+inline void SerializedKArray::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.k_.~RepeatedPtrField();
 }
 
 void SerializedKArray::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* SerializedKArray::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedKArray& SerializedKArray::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKArray.base);
-  return *internal_default_instance();
-}
-
 
 void SerializedKArray::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedKArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  k_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.k_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedKArray::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKArray)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedKArray::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .SerializedK k = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_k()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_k(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKArray)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKArray)
-  return false;
-#undef DO_
-}
-
-void SerializedKArray::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .SerializedK k = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->k_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->k(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedKArray)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SerializedKArray::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SerializedKArray::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:SerializedKArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .SerializedK k = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->k_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->k(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_k_size()); i < n; i++) {
+    const auto& repfield = this->_internal_k(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedKArray)
   return target;
@@ -2100,57 +2217,37 @@ size_t SerializedKArray::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedKArray)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .SerializedK k = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->k_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->k(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_k_size();
+  for (const auto& msg : this->_impl_.k_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKArray::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKArray* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKArray>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKArray)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKArray)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKArray::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKArray::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKArray::GetClassData() const { return &_class_data_; }
 
-void SerializedKArray::MergeFrom(const SerializedKArray& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  k_.MergeFrom(from.k_);
-}
+void SerializedKArray::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKArray*>(&to_msg);
+  auto& from = static_cast<const SerializedKArray&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKArray)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedKArray::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKArray)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.k_.MergeFrom(from._impl_.k_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedKArray::CopyFrom(const SerializedKArray& from) {
@@ -2164,290 +2261,311 @@ bool SerializedKArray::IsInitialized() const {
   return true;
 }
 
-void SerializedKArray::Swap(SerializedKArray* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedKArray::InternalSwap(SerializedKArray* other) {
   using std::swap;
-  CastToBase(&k_)->InternalSwap(CastToBase(&other->k_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.k_.InternalSwap(&other->_impl_.k_);
 }
 
-::google::protobuf::Metadata SerializedKArray::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKArray::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[5]);
 }
 
-
 // ===================================================================
 
-void SerializedMappoint::InitAsDefaultInstance() {
-  ::_SerializedMappoint_default_instance_._instance.get_mutable()->position_ = const_cast< ::SerializedPosition*>(
-      ::SerializedPosition::internal_default_instance());
-  ::_SerializedMappoint_default_instance_._instance.get_mutable()->briefdescriptor_ = const_cast< ::SerializedDescriptor*>(
-      ::SerializedDescriptor::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedMappoint::kIdFieldNumber;
-const int SerializedMappoint::kPositionFieldNumber;
-const int SerializedMappoint::kVisibleFieldNumber;
-const int SerializedMappoint::kFoundFieldNumber;
-const int SerializedMappoint::kBriefdescriptorFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SerializedMappoint::SerializedMappoint()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedMappoint.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedMappoint)
+class SerializedMappoint::_Internal {
+ public:
+  static const ::SerializedPosition& position(const SerializedMappoint* msg);
+  static const ::SerializedDescriptor& briefdescriptor(const SerializedMappoint* msg);
+};
+
+const ::SerializedPosition&
+SerializedMappoint::_Internal::position(const SerializedMappoint* msg) {
+  return *msg->_impl_.position_;
+}
+const ::SerializedDescriptor&
+SerializedMappoint::_Internal::briefdescriptor(const SerializedMappoint* msg) {
+  return *msg->_impl_.briefdescriptor_;
+}
+SerializedMappoint::SerializedMappoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedMappoint)
 }
 SerializedMappoint::SerializedMappoint(const SerializedMappoint& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_position()) {
-    position_ = new ::SerializedPosition(*from.position_);
-  } else {
-    position_ = NULL;
-  }
-  if (from.has_briefdescriptor()) {
-    briefdescriptor_ = new ::SerializedDescriptor(*from.briefdescriptor_);
-  } else {
-    briefdescriptor_ = NULL;
-  }
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&found_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(found_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedMappoint* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.normal_){from._impl_.normal_}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.briefdescriptor_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.visible_){}
+    , decltype(_impl_.found_){}
+    , decltype(_impl_.mindistance_){}
+    , decltype(_impl_.maxdistance_){}
+    , decltype(_impl_.refkeyframeid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_position()) {
+    _this->_impl_.position_ = new ::SerializedPosition(*from._impl_.position_);
+  }
+  if (from._internal_has_briefdescriptor()) {
+    _this->_impl_.briefdescriptor_ = new ::SerializedDescriptor(*from._impl_.briefdescriptor_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.refkeyframeid_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.refkeyframeid_));
   // @@protoc_insertion_point(copy_constructor:SerializedMappoint)
 }
 
-void SerializedMappoint::SharedCtor() {
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&found_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(found_));
+inline void SerializedMappoint::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.normal_){arena}
+    , decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.briefdescriptor_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.visible_){0}
+    , decltype(_impl_.found_){0}
+    , decltype(_impl_.mindistance_){0}
+    , decltype(_impl_.maxdistance_){0}
+    , decltype(_impl_.refkeyframeid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedMappoint::~SerializedMappoint() {
   // @@protoc_insertion_point(destructor:SerializedMappoint)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedMappoint::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
-  if (this != internal_default_instance()) delete briefdescriptor_;
+inline void SerializedMappoint::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.normal_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.briefdescriptor_;
 }
 
 void SerializedMappoint::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* SerializedMappoint::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedMappoint& SerializedMappoint::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedMappoint.base);
-  return *internal_default_instance();
-}
-
 
 void SerializedMappoint::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedMappoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
-  }
-  position_ = NULL;
-  if (GetArenaNoVirtual() == NULL && briefdescriptor_ != NULL) {
-    delete briefdescriptor_;
-  }
-  briefdescriptor_ = NULL;
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&found_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(found_));
-  _internal_metadata_.Clear();
-}
-
-bool SerializedMappoint::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedMappoint)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.normal_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.briefdescriptor_ != nullptr) {
+    delete _impl_.briefdescriptor_;
+  }
+  _impl_.briefdescriptor_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.refkeyframeid_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.refkeyframeid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedMappoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedPosition position = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_position()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float visible = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &visible_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float found = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(37u /* 37 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &found_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.found_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedDescriptor briefdescriptor = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_briefdescriptor()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_briefdescriptor(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // repeated float normal = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_normal(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 53) {
+          _internal_add_normal(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float mindistance = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.mindistance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float maxdistance = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _impl_.maxdistance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 refkeyframeid = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.refkeyframeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedMappoint)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedMappoint)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedMappoint::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedMappoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedMappoint::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedMappoint)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 id = 1;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->id(), output);
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
   }
 
   // .SerializedPosition position = 2;
-  if (this->has_position()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_position(), output);
+  if (this->_internal_has_position()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // float visible = 3;
-  if (this->visible() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->visible(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_visible = this->_internal_visible();
+  uint32_t raw_visible;
+  memcpy(&raw_visible, &tmp_visible, sizeof(tmp_visible));
+  if (raw_visible != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_visible(), target);
   }
 
   // float found = 4;
-  if (this->found() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->found(), output);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_found = this->_internal_found();
+  uint32_t raw_found;
+  memcpy(&raw_found, &tmp_found, sizeof(tmp_found));
+  if (raw_found != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_found(), target);
   }
 
   // .SerializedDescriptor briefdescriptor = 5;
-  if (this->has_briefdescriptor()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->_internal_briefdescriptor(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedMappoint)
-}
-
-::google::protobuf::uint8* SerializedMappoint::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedMappoint)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 id = 1;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->id(), target);
+  if (this->_internal_has_briefdescriptor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::briefdescriptor(this),
+        _Internal::briefdescriptor(this).GetCachedSize(), target, stream);
   }
 
-  // .SerializedPosition position = 2;
-  if (this->has_position()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_position(), deterministic, target);
+  // repeated float normal = 6;
+  if (this->_internal_normal_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_normal(), target);
   }
 
-  // float visible = 3;
-  if (this->visible() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->visible(), target);
+  // float mindistance = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mindistance = this->_internal_mindistance();
+  uint32_t raw_mindistance;
+  memcpy(&raw_mindistance, &tmp_mindistance, sizeof(tmp_mindistance));
+  if (raw_mindistance != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_mindistance(), target);
   }
 
-  // float found = 4;
-  if (this->found() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->found(), target);
+  // float maxdistance = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxdistance = this->_internal_maxdistance();
+  uint32_t raw_maxdistance;
+  memcpy(&raw_maxdistance, &tmp_maxdistance, sizeof(tmp_maxdistance));
+  if (raw_maxdistance != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_maxdistance(), target);
   }
 
-  // .SerializedDescriptor briefdescriptor = 5;
-  if (this->has_briefdescriptor()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->_internal_briefdescriptor(), deterministic, target);
+  // uint32 refkeyframeid = 9;
+  if (this->_internal_refkeyframeid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_refkeyframeid(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedMappoint)
   return target;
@@ -2457,95 +2575,147 @@ size_t SerializedMappoint::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedMappoint)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float normal = 6;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_normal_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
   }
+
   // .SerializedPosition position = 2;
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *position_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.position_);
   }
 
   // .SerializedDescriptor briefdescriptor = 5;
-  if (this->has_briefdescriptor()) {
+  if (this->_internal_has_briefdescriptor()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *briefdescriptor_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.briefdescriptor_);
   }
 
   // uint32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
 
   // float visible = 3;
-  if (this->visible() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_visible = this->_internal_visible();
+  uint32_t raw_visible;
+  memcpy(&raw_visible, &tmp_visible, sizeof(tmp_visible));
+  if (raw_visible != 0) {
     total_size += 1 + 4;
   }
 
   // float found = 4;
-  if (this->found() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_found = this->_internal_found();
+  uint32_t raw_found;
+  memcpy(&raw_found, &tmp_found, sizeof(tmp_found));
+  if (raw_found != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // float mindistance = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mindistance = this->_internal_mindistance();
+  uint32_t raw_mindistance;
+  memcpy(&raw_mindistance, &tmp_mindistance, sizeof(tmp_mindistance));
+  if (raw_mindistance != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float maxdistance = 8;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxdistance = this->_internal_maxdistance();
+  uint32_t raw_maxdistance;
+  memcpy(&raw_maxdistance, &tmp_maxdistance, sizeof(tmp_maxdistance));
+  if (raw_maxdistance != 0) {
+    total_size += 1 + 4;
+  }
 
-void SerializedMappoint::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedMappoint)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedMappoint* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedMappoint>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedMappoint)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedMappoint)
-    MergeFrom(*source);
+  // uint32 refkeyframeid = 9;
+  if (this->_internal_refkeyframeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_refkeyframeid());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedMappoint::MergeFrom(const SerializedMappoint& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedMappoint)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedMappoint::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedMappoint::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedMappoint::GetClassData() const { return &_class_data_; }
+
+
+void SerializedMappoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedMappoint*>(&to_msg);
+  auto& from = static_cast<const SerializedMappoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedMappoint)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    mutable_position()->::SerializedPosition::MergeFrom(from.position());
+  _this->_impl_.normal_.MergeFrom(from._impl_.normal_);
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::SerializedPosition::MergeFrom(
+        from._internal_position());
+  }
+  if (from._internal_has_briefdescriptor()) {
+    _this->_internal_mutable_briefdescriptor()->::SerializedDescriptor::MergeFrom(
+        from._internal_briefdescriptor());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-  if (from.has_briefdescriptor()) {
-    mutable_briefdescriptor()->::SerializedDescriptor::MergeFrom(from.briefdescriptor());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_visible = from._internal_visible();
+  uint32_t raw_visible;
+  memcpy(&raw_visible, &tmp_visible, sizeof(tmp_visible));
+  if (raw_visible != 0) {
+    _this->_internal_set_visible(from._internal_visible());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_found = from._internal_found();
+  uint32_t raw_found;
+  memcpy(&raw_found, &tmp_found, sizeof(tmp_found));
+  if (raw_found != 0) {
+    _this->_internal_set_found(from._internal_found());
   }
-  if (from.visible() != 0) {
-    set_visible(from.visible());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_mindistance = from._internal_mindistance();
+  uint32_t raw_mindistance;
+  memcpy(&raw_mindistance, &tmp_mindistance, sizeof(tmp_mindistance));
+  if (raw_mindistance != 0) {
+    _this->_internal_set_mindistance(from._internal_mindistance());
   }
-  if (from.found() != 0) {
-    set_found(from.found());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_maxdistance = from._internal_maxdistance();
+  uint32_t raw_maxdistance;
+  memcpy(&raw_maxdistance, &tmp_maxdistance, sizeof(tmp_maxdistance));
+  if (raw_maxdistance != 0) {
+    _this->_internal_set_maxdistance(from._internal_maxdistance());
   }
+  if (from._internal_refkeyframeid() != 0) {
+    _this->_internal_set_refkeyframeid(from._internal_refkeyframeid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SerializedMappoint::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedMappoint)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void SerializedMappoint::CopyFrom(const SerializedMappoint& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:SerializedMappoint)
+void SerializedMappoint::CopyFrom(const SerializedMappoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedMappoint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
@@ -2555,166 +2725,144 @@ bool SerializedMappoint::IsInitialized() const {
   return true;
 }
 
-void SerializedMappoint::Swap(SerializedMappoint* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedMappoint::InternalSwap(SerializedMappoint* other) {
   using std::swap;
-  swap(position_, other->position_);
-  swap(briefdescriptor_, other->briefdescriptor_);
-  swap(id_, other->id_);
-  swap(visible_, other->visible_);
-  swap(found_, other->found_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.normal_.InternalSwap(&other->_impl_.normal_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedMappoint, _impl_.refkeyframeid_)
+      + sizeof(SerializedMappoint::_impl_.refkeyframeid_)
+      - PROTOBUF_FIELD_OFFSET(SerializedMappoint, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
-::google::protobuf::Metadata SerializedMappoint::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedMappoint::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void SerializedMappointArray::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedMappointArray::kMappointFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedMappointArray::_Internal {
+ public:
+};
 
-SerializedMappointArray::SerializedMappointArray()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedMappointArray.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedMappointArray)
+SerializedMappointArray::SerializedMappointArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedMappointArray)
 }
 SerializedMappointArray::SerializedMappointArray(const SerializedMappointArray& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      mappoint_(from.mappoint_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedMappointArray* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mappoint_){from._impl_.mappoint_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SerializedMappointArray)
 }
 
-void SerializedMappointArray::SharedCtor() {
+inline void SerializedMappointArray::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mappoint_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedMappointArray::~SerializedMappointArray() {
   // @@protoc_insertion_point(destructor:SerializedMappointArray)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedMappointArray::SharedDtor() {
+inline void SerializedMappointArray::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mappoint_.~RepeatedPtrField();
 }
 
 void SerializedMappointArray::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedMappointArray::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedMappointArray& SerializedMappointArray::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedMappointArray.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SerializedMappointArray::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedMappointArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  mappoint_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.mappoint_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedMappointArray::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedMappointArray)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedMappointArray::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .SerializedMappoint mappoint = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_mappoint()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_mappoint(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedMappointArray)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedMappointArray)
-  return false;
-#undef DO_
-}
-
-void SerializedMappointArray::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedMappointArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .SerializedMappoint mappoint = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->mappoint_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->mappoint(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedMappointArray)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SerializedMappointArray::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SerializedMappointArray::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:SerializedMappointArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .SerializedMappoint mappoint = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->mappoint_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->mappoint(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_mappoint_size()); i < n; i++) {
+    const auto& repfield = this->_internal_mappoint(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedMappointArray)
   return target;
@@ -2724,57 +2872,37 @@ size_t SerializedMappointArray::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedMappointArray)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .SerializedMappoint mappoint = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->mappoint_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->mappoint(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_mappoint_size();
+  for (const auto& msg : this->_impl_.mappoint_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedMappointArray::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedMappointArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedMappointArray* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedMappointArray>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedMappointArray)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedMappointArray)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedMappointArray::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedMappointArray::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedMappointArray::GetClassData() const { return &_class_data_; }
 
-void SerializedMappointArray::MergeFrom(const SerializedMappointArray& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedMappointArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  mappoint_.MergeFrom(from.mappoint_);
-}
+void SerializedMappointArray::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedMappointArray*>(&to_msg);
+  auto& from = static_cast<const SerializedMappointArray&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedMappointArray)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedMappointArray::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedMappointArray)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.mappoint_.MergeFrom(from._impl_.mappoint_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedMappointArray::CopyFrom(const SerializedMappointArray& from) {
@@ -2788,336 +2916,367 @@ bool SerializedMappointArray::IsInitialized() const {
   return true;
 }
 
-void SerializedMappointArray::Swap(SerializedMappointArray* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedMappointArray::InternalSwap(SerializedMappointArray* other) {
   using std::swap;
-  CastToBase(&mappoint_)->InternalSwap(CastToBase(&other->mappoint_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.mappoint_.InternalSwap(&other->_impl_.mappoint_);
 }
 
-::google::protobuf::Metadata SerializedMappointArray::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedMappointArray::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void SerializedKeyframe::InitAsDefaultInstance() {
-  ::_SerializedKeyframe_default_instance_._instance.get_mutable()->pose_ = const_cast< ::SerializedPose*>(
-      ::SerializedPose::internal_default_instance());
-  ::_SerializedKeyframe_default_instance_._instance.get_mutable()->kmatrix_ = const_cast< ::SerializedK*>(
-      ::SerializedK::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKeyframe::kIdFieldNumber;
-const int SerializedKeyframe::kPoseFieldNumber;
-const int SerializedKeyframe::kKmatrixFieldNumber;
-const int SerializedKeyframe::kKindexFieldNumber;
-const int SerializedKeyframe::kLoopedgesidsFieldNumber;
-const int SerializedKeyframe::kTimestampFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SerializedKeyframe::SerializedKeyframe()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframe.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKeyframe)
+class SerializedKeyframe::_Internal {
+ public:
+  static const ::SerializedPose& pose(const SerializedKeyframe* msg);
+  static const ::SerializedK& kmatrix(const SerializedKeyframe* msg);
+};
+
+const ::SerializedPose&
+SerializedKeyframe::_Internal::pose(const SerializedKeyframe* msg) {
+  return *msg->_impl_.pose_;
+}
+const ::SerializedK&
+SerializedKeyframe::_Internal::kmatrix(const SerializedKeyframe* msg) {
+  return *msg->_impl_.kmatrix_;
+}
+SerializedKeyframe::SerializedKeyframe(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframe)
 }
 SerializedKeyframe::SerializedKeyframe(const SerializedKeyframe& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      loopedgesids_(from.loopedgesids_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_pose()) {
-    pose_ = new ::SerializedPose(*from.pose_);
-  } else {
-    pose_ = NULL;
-  }
-  if (from.has_kmatrix()) {
-    kmatrix_ = new ::SerializedK(*from.kmatrix_);
-  } else {
-    kmatrix_ = NULL;
-  }
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframe* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.loopedgesids_){from._impl_.loopedgesids_}
+    , /*decltype(_impl_._loopedgesids_cached_byte_size_)*/{0}
+    , decltype(_impl_.loopedgesdeltas_){from._impl_.loopedgesdeltas_}
+    , /*decltype(_impl_._loopedgesdeltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.covisibleids_){from._impl_.covisibleids_}
+    , /*decltype(_impl_._covisibleids_cached_byte_size_)*/{0}
+    , decltype(_impl_.covisibleweights_){from._impl_.covisibleweights_}
+    , /*decltype(_impl_._covisibleweights_cached_byte_size_)*/{0}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.kmatrix_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.kindex_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.timestampdelta_){}
+    , decltype(_impl_.parentid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_pose()) {
+    _this->_impl_.pose_ = new ::SerializedPose(*from._impl_.pose_);
+  }
+  if (from._internal_has_kmatrix()) {
+    _this->_impl_.kmatrix_ = new ::SerializedK(*from._impl_.kmatrix_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parentid_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.parentid_));
   // @@protoc_insertion_point(copy_constructor:SerializedKeyframe)
 }
 
-void SerializedKeyframe::SharedCtor() {
-  ::memset(&pose_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&pose_)) + sizeof(timestamp_));
+inline void SerializedKeyframe::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.loopedgesids_){arena}
+    , /*decltype(_impl_._loopedgesids_cached_byte_size_)*/{0}
+    , decltype(_impl_.loopedgesdeltas_){arena}
+    , /*decltype(_impl_._loopedgesdeltas_cached_byte_size_)*/{0}
+    , decltype(_impl_.covisibleids_){arena}
+    , /*decltype(_impl_._covisibleids_cached_byte_size_)*/{0}
+    , decltype(_impl_.covisibleweights_){arena}
+    , /*decltype(_impl_._covisibleweights_cached_byte_size_)*/{0}
+    , decltype(_impl_.pose_){nullptr}
+    , decltype(_impl_.kmatrix_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.kindex_){0u}
+    , decltype(_impl_.timestamp_){0}
+    , decltype(_impl_.timestampdelta_){int64_t{0}}
+    , decltype(_impl_.parentid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedKeyframe::~SerializedKeyframe() {
   // @@protoc_insertion_point(destructor:SerializedKeyframe)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKeyframe::SharedDtor() {
-  if (this != internal_default_instance()) delete pose_;
-  if (this != internal_default_instance()) delete kmatrix_;
+inline void SerializedKeyframe::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.loopedgesids_.~RepeatedField();
+  _impl_.loopedgesdeltas_.~RepeatedField();
+  _impl_.covisibleids_.~RepeatedField();
+  _impl_.covisibleweights_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.pose_;
+  if (this != internal_default_instance()) delete _impl_.kmatrix_;
 }
 
 void SerializedKeyframe::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedKeyframe::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const SerializedKeyframe& SerializedKeyframe::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKeyframe.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SerializedKeyframe::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedKeyframe)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  loopedgesids_.Clear();
-  if (GetArenaNoVirtual() == NULL && pose_ != NULL) {
-    delete pose_;
-  }
-  pose_ = NULL;
-  if (GetArenaNoVirtual() == NULL && kmatrix_ != NULL) {
-    delete kmatrix_;
-  }
-  kmatrix_ = NULL;
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
-  _internal_metadata_.Clear();
-}
-
-bool SerializedKeyframe::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKeyframe)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.loopedgesids_.Clear();
+  _impl_.loopedgesdeltas_.Clear();
+  _impl_.covisibleids_.Clear();
+  _impl_.covisibleweights_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.pose_ != nullptr) {
+    delete _impl_.pose_;
+  }
+  _impl_.pose_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.kmatrix_ != nullptr) {
+    delete _impl_.kmatrix_;
+  }
+  _impl_.kmatrix_ = nullptr;
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.parentid_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.parentid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeyframe::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedPose pose = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_pose()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pose(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedK kmatrix = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_kmatrix()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_kmatrix(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 kindex = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &kindex_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.kindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 loopedgesids = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_loopedgesids())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 42u, input, this->mutable_loopedgesids())));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_loopedgesids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_loopedgesids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // double timestamp = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(49u /* 49 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
-                 input, &timestamp_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // sint64 timestampdelta = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timestampdelta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // repeated uint32 loopedgesdeltas = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_loopedgesdeltas(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_loopedgesdeltas(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 covisibleids = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_covisibleids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_covisibleids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 covisibleweights = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_covisibleweights(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_covisibleweights(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 parentid = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.parentid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKeyframe)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKeyframe)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedKeyframe::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKeyframe)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedKeyframe::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframe)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 id = 1;
-  if (this->id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->id(), output);
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
   }
 
   // .SerializedPose pose = 2;
-  if (this->has_pose()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_pose(), output);
+  if (this->_internal_has_pose()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pose(this),
+        _Internal::pose(this).GetCachedSize(), target, stream);
   }
 
   // .SerializedK kmatrix = 3;
-  if (this->has_kmatrix()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_kmatrix(), output);
+  if (this->_internal_has_kmatrix()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::kmatrix(this),
+        _Internal::kmatrix(this).GetCachedSize(), target, stream);
   }
 
   // uint32 kindex = 4;
-  if (this->kindex() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->kindex(), output);
+  if (this->_internal_kindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_kindex(), target);
   }
 
   // repeated uint32 loopedgesids = 5;
-  if (this->loopedgesids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(5, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _loopedgesids_cached_byte_size_));
-  }
-  for (int i = 0, n = this->loopedgesids_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->loopedgesids(i), output);
+  {
+    int byte_size = _impl_._loopedgesids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_loopedgesids(), byte_size, target);
+    }
   }
 
   // double timestamp = 6;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->timestamp(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedKeyframe)
-}
-
-::google::protobuf::uint8* SerializedKeyframe::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframe)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 id = 1;
-  if (this->id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->id(), target);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timestamp = this->_internal_timestamp();
+  uint64_t raw_timestamp;
+  memcpy(&raw_timestamp, &tmp_timestamp, sizeof(tmp_timestamp));
+  if (raw_timestamp != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_timestamp(), target);
   }
 
-  // .SerializedPose pose = 2;
-  if (this->has_pose()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_pose(), deterministic, target);
+  // sint64 timestampdelta = 7;
+  if (this->_internal_timestampdelta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteSInt64ToArray(7, this->_internal_timestampdelta(), target);
   }
 
-  // .SerializedK kmatrix = 3;
-  if (this->has_kmatrix()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_kmatrix(), deterministic, target);
+  // repeated uint32 loopedgesdeltas = 8;
+  {
+    int byte_size = _impl_._loopedgesdeltas_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          8, _internal_loopedgesdeltas(), byte_size, target);
+    }
   }
 
-  // uint32 kindex = 4;
-  if (this->kindex() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->kindex(), target);
+  // repeated uint32 covisibleids = 9;
+  {
+    int byte_size = _impl_._covisibleids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          9, _internal_covisibleids(), byte_size, target);
+    }
   }
 
-  // repeated uint32 loopedgesids = 5;
-  if (this->loopedgesids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      5,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _loopedgesids_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->loopedgesids_, target);
+  // repeated uint32 covisibleweights = 10;
+  {
+    int byte_size = _impl_._covisibleweights_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          10, _internal_covisibleweights(), byte_size, target);
+    }
   }
 
-  // double timestamp = 6;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->timestamp(), target);
+  // uint32 parentid = 11;
+  if (this->_internal_parentid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_parentid(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframe)
   return target;
@@ -3127,110 +3286,159 @@ size_t SerializedKeyframe::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedKeyframe)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 loopedgesids = 5;
   {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->loopedgesids_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.loopedgesids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._loopedgesids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 loopedgesdeltas = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.loopedgesdeltas_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._loopedgesdeltas_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 covisibleids = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.covisibleids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._covisibleids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 covisibleweights = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.covisibleweights_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _loopedgesids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._covisibleweights_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // .SerializedPose pose = 2;
-  if (this->has_pose()) {
+  if (this->_internal_has_pose()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *pose_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pose_);
   }
 
   // .SerializedK kmatrix = 3;
-  if (this->has_kmatrix()) {
+  if (this->_internal_has_kmatrix()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *kmatrix_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.kmatrix_);
   }
 
   // uint32 id = 1;
-  if (this->id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->id());
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
 
   // uint32 kindex = 4;
-  if (this->kindex() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->kindex());
+  if (this->_internal_kindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_kindex());
   }
 
   // double timestamp = 6;
-  if (this->timestamp() != 0) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timestamp = this->_internal_timestamp();
+  uint64_t raw_timestamp;
+  memcpy(&raw_timestamp, &tmp_timestamp, sizeof(tmp_timestamp));
+  if (raw_timestamp != 0) {
     total_size += 1 + 8;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // sint64 timestampdelta = 7;
+  if (this->_internal_timestampdelta() != 0) {
+    total_size += ::_pbi::WireFormatLite::SInt64SizePlusOne(this->_internal_timestampdelta());
+  }
 
-void SerializedKeyframe::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKeyframe)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKeyframe* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKeyframe>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKeyframe)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKeyframe)
-    MergeFrom(*source);
+  // uint32 parentid = 11;
+  if (this->_internal_parentid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parentid());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKeyframe::MergeFrom(const SerializedKeyframe& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframe)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframe::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframe::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframe::GetClassData() const { return &_class_data_; }
+
+
+void SerializedKeyframe::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframe*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframe&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframe)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  loopedgesids_.MergeFrom(from.loopedgesids_);
-  if (from.has_pose()) {
-    mutable_pose()->::SerializedPose::MergeFrom(from.pose());
+  _this->_impl_.loopedgesids_.MergeFrom(from._impl_.loopedgesids_);
+  _this->_impl_.loopedgesdeltas_.MergeFrom(from._impl_.loopedgesdeltas_);
+  _this->_impl_.covisibleids_.MergeFrom(from._impl_.covisibleids_);
+  _this->_impl_.covisibleweights_.MergeFrom(from._impl_.covisibleweights_);
+  if (from._internal_has_pose()) {
+    _this->_internal_mutable_pose()->::SerializedPose::MergeFrom(
+        from._internal_pose());
   }
-  if (from.has_kmatrix()) {
-    mutable_kmatrix()->::SerializedK::MergeFrom(from.kmatrix());
+  if (from._internal_has_kmatrix()) {
+    _this->_internal_mutable_kmatrix()->::SerializedK::MergeFrom(
+        from._internal_kmatrix());
   }
-  if (from.id() != 0) {
-    set_id(from.id());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
-  if (from.kindex() != 0) {
-    set_kindex(from.kindex());
+  if (from._internal_kindex() != 0) {
+    _this->_internal_set_kindex(from._internal_kindex());
   }
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_timestamp = from._internal_timestamp();
+  uint64_t raw_timestamp;
+  memcpy(&raw_timestamp, &tmp_timestamp, sizeof(tmp_timestamp));
+  if (raw_timestamp != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
-}
-
-void SerializedKeyframe::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKeyframe)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_timestampdelta() != 0) {
+    _this->_internal_set_timestampdelta(from._internal_timestampdelta());
+  }
+  if (from._internal_parentid() != 0) {
+    _this->_internal_set_parentid(from._internal_parentid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedKeyframe::CopyFrom(const SerializedKeyframe& from) {
@@ -3244,167 +3452,147 @@ bool SerializedKeyframe::IsInitialized() const {
   return true;
 }
 
-void SerializedKeyframe::Swap(SerializedKeyframe* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedKeyframe::InternalSwap(SerializedKeyframe* other) {
   using std::swap;
-  loopedgesids_.InternalSwap(&other->loopedgesids_);
-  swap(pose_, other->pose_);
-  swap(kmatrix_, other->kmatrix_);
-  swap(id_, other->id_);
-  swap(kindex_, other->kindex_);
-  swap(timestamp_, other->timestamp_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.loopedgesids_.InternalSwap(&other->_impl_.loopedgesids_);
+  _impl_.loopedgesdeltas_.InternalSwap(&other->_impl_.loopedgesdeltas_);
+  _impl_.covisibleids_.InternalSwap(&other->_impl_.covisibleids_);
+  _impl_.covisibleweights_.InternalSwap(&other->_impl_.covisibleweights_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedKeyframe, _impl_.parentid_)
+      + sizeof(SerializedKeyframe::_impl_.parentid_)
+      - PROTOBUF_FIELD_OFFSET(SerializedKeyframe, _impl_.pose_)>(
+          reinterpret_cast<char*>(&_impl_.pose_),
+          reinterpret_cast<char*>(&other->_impl_.pose_));
 }
 
-::google::protobuf::Metadata SerializedKeyframe::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframe::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void SerializedKeyframeArray::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKeyframeArray::kKeyframeFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class SerializedKeyframeArray::_Internal {
+ public:
+};
 
-SerializedKeyframeArray::SerializedKeyframeArray()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframeArray.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKeyframeArray)
+SerializedKeyframeArray::SerializedKeyframeArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframeArray)
 }
 SerializedKeyframeArray::SerializedKeyframeArray(const SerializedKeyframeArray& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      keyframe_(from.keyframe_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframeArray* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keyframe_){from._impl_.keyframe_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SerializedKeyframeArray)
 }
 
-void SerializedKeyframeArray::SharedCtor() {
+inline void SerializedKeyframeArray::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keyframe_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SerializedKeyframeArray::~SerializedKeyframeArray() {
   // @@protoc_insertion_point(destructor:SerializedKeyframeArray)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKeyframeArray::SharedDtor() {
+inline void SerializedKeyframeArray::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keyframe_.~RepeatedPtrField();
 }
 
 void SerializedKeyframeArray::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedKeyframeArray::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const SerializedKeyframeArray& SerializedKeyframeArray::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKeyframeArray.base);
-  return *internal_default_instance();
-}
-
-
 void SerializedKeyframeArray::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedKeyframeArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  keyframe_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.keyframe_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedKeyframeArray::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKeyframeArray)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedKeyframeArray::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .SerializedKeyframe keyframe = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_keyframe()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keyframe(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKeyframeArray)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKeyframeArray)
-  return false;
-#undef DO_
-}
-
-void SerializedKeyframeArray::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKeyframeArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .SerializedKeyframe keyframe = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->keyframe_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->keyframe(static_cast<int>(i)),
-      output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedKeyframeArray)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* SerializedKeyframeArray::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* SerializedKeyframeArray::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .SerializedKeyframe keyframe = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->keyframe_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->keyframe(static_cast<int>(i)), deterministic, target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keyframe_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keyframe(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeArray)
   return target;
@@ -3414,57 +3602,37 @@ size_t SerializedKeyframeArray::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeArray)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .SerializedKeyframe keyframe = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->keyframe_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->keyframe(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_keyframe_size();
+  for (const auto& msg : this->_impl_.keyframe_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKeyframeArray::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKeyframeArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKeyframeArray* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKeyframeArray>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKeyframeArray)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKeyframeArray)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframeArray::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframeArray::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframeArray::GetClassData() const { return &_class_data_; }
 
-void SerializedKeyframeArray::MergeFrom(const SerializedKeyframeArray& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  keyframe_.MergeFrom(from.keyframe_);
-}
+void SerializedKeyframeArray::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframeArray*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframeArray&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeArray)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedKeyframeArray::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKeyframeArray)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.keyframe_.MergeFrom(from._impl_.keyframe_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedKeyframeArray::CopyFrom(const SerializedKeyframeArray& from) {
@@ -3478,236 +3646,222 @@ bool SerializedKeyframeArray::IsInitialized() const {
   return true;
 }
 
-void SerializedKeyframeArray::Swap(SerializedKeyframeArray* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedKeyframeArray::InternalSwap(SerializedKeyframeArray* other) {
   using std::swap;
-  CastToBase(&keyframe_)->InternalSwap(CastToBase(&other->keyframe_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keyframe_.InternalSwap(&other->_impl_.keyframe_);
 }
 
-::google::protobuf::Metadata SerializedKeyframeArray::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframeArray::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void SerializedFeature::InitAsDefaultInstance() {
-  ::_SerializedFeature_default_instance_._instance.get_mutable()->keypoint_ = const_cast< ::SerializedKeypoint*>(
-      ::SerializedKeypoint::internal_default_instance());
-  ::_SerializedFeature_default_instance_._instance.get_mutable()->briefdescriptor_ = const_cast< ::SerializedDescriptor*>(
-      ::SerializedDescriptor::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedFeature::kMappointIdFieldNumber;
-const int SerializedFeature::kKeypointFieldNumber;
-const int SerializedFeature::kBriefdescriptorFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SerializedFeature::SerializedFeature()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedFeature.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedFeature)
+class SerializedFeature::_Internal {
+ public:
+  static const ::SerializedKeypoint& keypoint(const SerializedFeature* msg);
+  static const ::SerializedDescriptor& briefdescriptor(const SerializedFeature* msg);
+};
+
+const ::SerializedKeypoint&
+SerializedFeature::_Internal::keypoint(const SerializedFeature* msg) {
+  return *msg->_impl_.keypoint_;
+}
+const ::SerializedDescriptor&
+SerializedFeature::_Internal::briefdescriptor(const SerializedFeature* msg) {
+  return *msg->_impl_.briefdescriptor_;
+}
+SerializedFeature::SerializedFeature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedFeature)
 }
 SerializedFeature::SerializedFeature(const SerializedFeature& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_keypoint()) {
-    keypoint_ = new ::SerializedKeypoint(*from.keypoint_);
-  } else {
-    keypoint_ = NULL;
-  }
-  if (from.has_briefdescriptor()) {
-    briefdescriptor_ = new ::SerializedDescriptor(*from.briefdescriptor_);
-  } else {
-    briefdescriptor_ = NULL;
-  }
-  mappoint_id_ = from.mappoint_id_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedFeature* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.descriptorresidual_){}
+    , decltype(_impl_.keypoint_){nullptr}
+    , decltype(_impl_.briefdescriptor_){nullptr}
+    , decltype(_impl_.mappoint_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.descriptorresidual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.descriptorresidual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_descriptorresidual().empty()) {
+    _this->_impl_.descriptorresidual_.Set(from._internal_descriptorresidual(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_keypoint()) {
+    _this->_impl_.keypoint_ = new ::SerializedKeypoint(*from._impl_.keypoint_);
+  }
+  if (from._internal_has_briefdescriptor()) {
+    _this->_impl_.briefdescriptor_ = new ::SerializedDescriptor(*from._impl_.briefdescriptor_);
+  }
+  _this->_impl_.mappoint_id_ = from._impl_.mappoint_id_;
   // @@protoc_insertion_point(copy_constructor:SerializedFeature)
 }
 
-void SerializedFeature::SharedCtor() {
-  ::memset(&keypoint_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&mappoint_id_) -
-      reinterpret_cast<char*>(&keypoint_)) + sizeof(mappoint_id_));
+inline void SerializedFeature::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.descriptorresidual_){}
+    , decltype(_impl_.keypoint_){nullptr}
+    , decltype(_impl_.briefdescriptor_){nullptr}
+    , decltype(_impl_.mappoint_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.descriptorresidual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.descriptorresidual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SerializedFeature::~SerializedFeature() {
   // @@protoc_insertion_point(destructor:SerializedFeature)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedFeature::SharedDtor() {
-  if (this != internal_default_instance()) delete keypoint_;
-  if (this != internal_default_instance()) delete briefdescriptor_;
+inline void SerializedFeature::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.descriptorresidual_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.keypoint_;
+  if (this != internal_default_instance()) delete _impl_.briefdescriptor_;
 }
 
 void SerializedFeature::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedFeature::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const SerializedFeature& SerializedFeature::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedFeature.base);
-  return *internal_default_instance();
-}
-
-
 void SerializedFeature::Clear() {
 // @@protoc_insertion_point(message_clear_start:SerializedFeature)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && keypoint_ != NULL) {
-    delete keypoint_;
+  _impl_.descriptorresidual_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.keypoint_ != nullptr) {
+    delete _impl_.keypoint_;
   }
-  keypoint_ = NULL;
-  if (GetArenaNoVirtual() == NULL && briefdescriptor_ != NULL) {
-    delete briefdescriptor_;
+  _impl_.keypoint_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.briefdescriptor_ != nullptr) {
+    delete _impl_.briefdescriptor_;
   }
-  briefdescriptor_ = NULL;
-  mappoint_id_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.briefdescriptor_ = nullptr;
+  _impl_.mappoint_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool SerializedFeature::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedFeature)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* SerializedFeature::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 mappoint_id = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &mappoint_id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.mappoint_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedKeypoint keypoint = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_keypoint()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_keypoint(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .SerializedDescriptor briefdescriptor = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_briefdescriptor()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_briefdescriptor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes descriptorresidual = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_descriptorresidual();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedFeature)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedFeature)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedFeature::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedFeature)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedFeature::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedFeature)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 mappoint_id = 2;
-  if (this->mappoint_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->mappoint_id(), output);
+  if (this->_internal_mappoint_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_mappoint_id(), target);
   }
 
   // .SerializedKeypoint keypoint = 3;
-  if (this->has_keypoint()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_keypoint(), output);
+  if (this->_internal_has_keypoint()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::keypoint(this),
+        _Internal::keypoint(this).GetCachedSize(), target, stream);
   }
 
   // .SerializedDescriptor briefdescriptor = 4;
-  if (this->has_briefdescriptor()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->_internal_briefdescriptor(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:SerializedFeature)
-}
-
-::google::protobuf::uint8* SerializedFeature::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedFeature)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 mappoint_id = 2;
-  if (this->mappoint_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->mappoint_id(), target);
-  }
-
-  // .SerializedKeypoint keypoint = 3;
-  if (this->has_keypoint()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_keypoint(), deterministic, target);
+  if (this->_internal_has_briefdescriptor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::briefdescriptor(this),
+        _Internal::briefdescriptor(this).GetCachedSize(), target, stream);
   }
 
-  // .SerializedDescriptor briefdescriptor = 4;
-  if (this->has_briefdescriptor()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->_internal_briefdescriptor(), deterministic, target);
+  // bytes descriptorresidual = 5;
+  if (!this->_internal_descriptorresidual().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_descriptorresidual(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SerializedFeature)
   return target;
@@ -3717,75 +3871,69 @@ size_t SerializedFeature::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SerializedFeature)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes descriptorresidual = 5;
+  if (!this->_internal_descriptorresidual().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_descriptorresidual());
   }
+
   // .SerializedKeypoint keypoint = 3;
-  if (this->has_keypoint()) {
+  if (this->_internal_has_keypoint()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *keypoint_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.keypoint_);
   }
 
   // .SerializedDescriptor briefdescriptor = 4;
-  if (this->has_briefdescriptor()) {
+  if (this->_internal_has_briefdescriptor()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *briefdescriptor_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.briefdescriptor_);
   }
 
   // uint32 mappoint_id = 2;
-  if (this->mappoint_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->mappoint_id());
+  if (this->_internal_mappoint_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mappoint_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedFeature::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedFeature)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedFeature* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedFeature>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedFeature)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedFeature)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedFeature::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedFeature::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedFeature::GetClassData() const { return &_class_data_; }
 
-void SerializedFeature::MergeFrom(const SerializedFeature& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedFeature)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void SerializedFeature::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedFeature*>(&to_msg);
+  auto& from = static_cast<const SerializedFeature&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedFeature)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_keypoint()) {
-    mutable_keypoint()->::SerializedKeypoint::MergeFrom(from.keypoint());
+  if (!from._internal_descriptorresidual().empty()) {
+    _this->_internal_set_descriptorresidual(from._internal_descriptorresidual());
   }
-  if (from.has_briefdescriptor()) {
-    mutable_briefdescriptor()->::SerializedDescriptor::MergeFrom(from.briefdescriptor());
+  if (from._internal_has_keypoint()) {
+    _this->_internal_mutable_keypoint()->::SerializedKeypoint::MergeFrom(
+        from._internal_keypoint());
   }
-  if (from.mappoint_id() != 0) {
-    set_mappoint_id(from.mappoint_id());
+  if (from._internal_has_briefdescriptor()) {
+    _this->_internal_mutable_briefdescriptor()->::SerializedDescriptor::MergeFrom(
+        from._internal_briefdescriptor());
   }
-}
-
-void SerializedFeature::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedFeature)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_mappoint_id() != 0) {
+    _this->_internal_set_mappoint_id(from._internal_mappoint_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SerializedFeature::CopyFrom(const SerializedFeature& from) {
@@ -3799,564 +3947,2186 @@ bool SerializedFeature::IsInitialized() const {
   return true;
 }
 
-void SerializedFeature::Swap(SerializedFeature* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void SerializedFeature::InternalSwap(SerializedFeature* other) {
   using std::swap;
-  swap(keypoint_, other->keypoint_);
-  swap(briefdescriptor_, other->briefdescriptor_);
-  swap(mappoint_id_, other->mappoint_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.descriptorresidual_, lhs_arena,
+      &other->_impl_.descriptorresidual_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedFeature, _impl_.mappoint_id_)
+      + sizeof(SerializedFeature::_impl_.mappoint_id_)
+      - PROTOBUF_FIELD_OFFSET(SerializedFeature, _impl_.keypoint_)>(
+          reinterpret_cast<char*>(&_impl_.keypoint_),
+          reinterpret_cast<char*>(&other->_impl_.keypoint_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedFeature::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[10]);
 }
 
-::google::protobuf::Metadata SerializedFeature::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void SerializedKeyframeFeatures::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKeyframeFeatures::kKeyframeIdFieldNumber;
-const int SerializedKeyframeFeatures::kFeatureFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SerializedKeyframeFeatures::SerializedKeyframeFeatures()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframeFeatures.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKeyframeFeatures)
-}
-SerializedKeyframeFeatures::SerializedKeyframeFeatures(const SerializedKeyframeFeatures& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      feature_(from.feature_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  keyframe_id_ = from.keyframe_id_;
-  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeFeatures)
-}
+class SerializedBow::_Internal {
+ public:
+};
 
-void SerializedKeyframeFeatures::SharedCtor() {
-  keyframe_id_ = 0u;
+SerializedBow::SerializedBow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedBow)
+}
+SerializedBow::SerializedBow(const SerializedBow& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedBow* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.worddelta_){from._impl_.worddelta_}
+    , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.wordvalue_){from._impl_.wordvalue_}
+    , decltype(_impl_.nodedelta_){from._impl_.nodedelta_}
+    , /*decltype(_impl_._nodedelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodesize_){from._impl_.nodesize_}
+    , /*decltype(_impl_._nodesize_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodefeature_){from._impl_.nodefeature_}
+    , /*decltype(_impl_._nodefeature_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:SerializedBow)
+}
+
+inline void SerializedBow::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.worddelta_){arena}
+    , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.wordvalue_){arena}
+    , decltype(_impl_.nodedelta_){arena}
+    , /*decltype(_impl_._nodedelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodesize_){arena}
+    , /*decltype(_impl_._nodesize_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodefeature_){arena}
+    , /*decltype(_impl_._nodefeature_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-SerializedKeyframeFeatures::~SerializedKeyframeFeatures() {
-  // @@protoc_insertion_point(destructor:SerializedKeyframeFeatures)
+SerializedBow::~SerializedBow() {
+  // @@protoc_insertion_point(destructor:SerializedBow)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKeyframeFeatures::SharedDtor() {
-}
-
-void SerializedKeyframeFeatures::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedKeyframeFeatures::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+inline void SerializedBow::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.worddelta_.~RepeatedField();
+  _impl_.wordvalue_.~RepeatedField();
+  _impl_.nodedelta_.~RepeatedField();
+  _impl_.nodesize_.~RepeatedField();
+  _impl_.nodefeature_.~RepeatedField();
 }
 
-const SerializedKeyframeFeatures& SerializedKeyframeFeatures::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKeyframeFeatures.base);
-  return *internal_default_instance();
+void SerializedBow::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void SerializedKeyframeFeatures::Clear() {
-// @@protoc_insertion_point(message_clear_start:SerializedKeyframeFeatures)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void SerializedBow::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedBow)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  feature_.Clear();
-  keyframe_id_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool SerializedKeyframeFeatures::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKeyframeFeatures)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 keyframe_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &keyframe_id_)));
-        } else {
+  _impl_.worddelta_.Clear();
+  _impl_.wordvalue_.Clear();
+  _impl_.nodedelta_.Clear();
+  _impl_.nodesize_.Clear();
+  _impl_.nodefeature_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedBow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 worddelta = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_worddelta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_worddelta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated .SerializedFeature feature = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_feature()));
-        } else {
+        continue;
+      // repeated double wordvalue = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_wordvalue(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 17) {
+          _internal_add_wordvalue(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 nodedelta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodedelta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_nodedelta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 nodesize = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodesize(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_nodesize(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 nodefeature = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodefeature(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_nodefeature(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKeyframeFeatures)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKeyframeFeatures)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedKeyframeFeatures::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKeyframeFeatures)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedBow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedBow)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 keyframe_id = 1;
-  if (this->keyframe_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->keyframe_id(), output);
-  }
+  // repeated uint32 worddelta = 1;
+  {
+    int byte_size = _impl_._worddelta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_worddelta(), byte_size, target);
+    }
+  }
+
+  // repeated double wordvalue = 2;
+  if (this->_internal_wordvalue_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_wordvalue(), target);
+  }
+
+  // repeated uint32 nodedelta = 3;
+  {
+    int byte_size = _impl_._nodedelta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_nodedelta(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 nodesize = 4;
+  {
+    int byte_size = _impl_._nodesize_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_nodesize(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 nodefeature = 5;
+  {
+    int byte_size = _impl_._nodefeature_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_nodefeature(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedBow)
+  return target;
+}
+
+size_t SerializedBow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedBow)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 worddelta = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.worddelta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._worddelta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double wordvalue = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_wordvalue_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint32 nodedelta = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nodedelta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodedelta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 nodesize = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nodesize_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodesize_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 nodefeature = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nodefeature_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodefeature_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedBow::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedBow::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedBow::GetClassData() const { return &_class_data_; }
+
+
+void SerializedBow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedBow*>(&to_msg);
+  auto& from = static_cast<const SerializedBow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedBow)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.worddelta_.MergeFrom(from._impl_.worddelta_);
+  _this->_impl_.wordvalue_.MergeFrom(from._impl_.wordvalue_);
+  _this->_impl_.nodedelta_.MergeFrom(from._impl_.nodedelta_);
+  _this->_impl_.nodesize_.MergeFrom(from._impl_.nodesize_);
+  _this->_impl_.nodefeature_.MergeFrom(from._impl_.nodefeature_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SerializedBow::CopyFrom(const SerializedBow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedBow)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SerializedBow::IsInitialized() const {
+  return true;
+}
+
+void SerializedBow::InternalSwap(SerializedBow* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.worddelta_.InternalSwap(&other->_impl_.worddelta_);
+  _impl_.wordvalue_.InternalSwap(&other->_impl_.wordvalue_);
+  _impl_.nodedelta_.InternalSwap(&other->_impl_.nodedelta_);
+  _impl_.nodesize_.InternalSwap(&other->_impl_.nodesize_);
+  _impl_.nodefeature_.InternalSwap(&other->_impl_.nodefeature_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedBow::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[11]);
+}
+
+// ===================================================================
+
+class SerializedKeyframeFeatures::_Internal {
+ public:
+  static const ::SerializedBow& bow(const SerializedKeyframeFeatures* msg);
+};
+
+const ::SerializedBow&
+SerializedKeyframeFeatures::_Internal::bow(const SerializedKeyframeFeatures* msg) {
+  return *msg->_impl_.bow_;
+}
+SerializedKeyframeFeatures::SerializedKeyframeFeatures(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframeFeatures)
+}
+SerializedKeyframeFeatures::SerializedKeyframeFeatures(const SerializedKeyframeFeatures& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframeFeatures* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.feature_){from._impl_.feature_}
+    , decltype(_impl_.bow_){nullptr}
+    , decltype(_impl_.keyframe_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_bow()) {
+    _this->_impl_.bow_ = new ::SerializedBow(*from._impl_.bow_);
+  }
+  _this->_impl_.keyframe_id_ = from._impl_.keyframe_id_;
+  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeFeatures)
+}
+
+inline void SerializedKeyframeFeatures::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.feature_){arena}
+    , decltype(_impl_.bow_){nullptr}
+    , decltype(_impl_.keyframe_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SerializedKeyframeFeatures::~SerializedKeyframeFeatures() {
+  // @@protoc_insertion_point(destructor:SerializedKeyframeFeatures)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SerializedKeyframeFeatures::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.feature_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.bow_;
+}
+
+void SerializedKeyframeFeatures::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SerializedKeyframeFeatures::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedKeyframeFeatures)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.feature_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.bow_ != nullptr) {
+    delete _impl_.bow_;
+  }
+  _impl_.bow_ = nullptr;
+  _impl_.keyframe_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeyframeFeatures::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 keyframe_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.keyframe_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SerializedFeature feature = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_feature(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .SerializedBow bow = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bow(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SerializedKeyframeFeatures::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeFeatures)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 keyframe_id = 1;
+  if (this->_internal_keyframe_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_keyframe_id(), target);
+  }
+
+  // repeated .SerializedFeature feature = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_feature_size()); i < n; i++) {
+    const auto& repfield = this->_internal_feature(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .SerializedBow bow = 3;
+  if (this->_internal_has_bow()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::bow(this),
+        _Internal::bow(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeFeatures)
+  return target;
+}
+
+size_t SerializedKeyframeFeatures::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeFeatures)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SerializedFeature feature = 2;
+  total_size += 1UL * this->_internal_feature_size();
+  for (const auto& msg : this->_impl_.feature_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .SerializedBow bow = 3;
+  if (this->_internal_has_bow()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bow_);
+  }
+
+  // uint32 keyframe_id = 1;
+  if (this->_internal_keyframe_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_keyframe_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframeFeatures::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframeFeatures::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframeFeatures::GetClassData() const { return &_class_data_; }
+
+
+void SerializedKeyframeFeatures::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframeFeatures*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframeFeatures&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeFeatures)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.feature_.MergeFrom(from._impl_.feature_);
+  if (from._internal_has_bow()) {
+    _this->_internal_mutable_bow()->::SerializedBow::MergeFrom(
+        from._internal_bow());
+  }
+  if (from._internal_keyframe_id() != 0) {
+    _this->_internal_set_keyframe_id(from._internal_keyframe_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SerializedKeyframeFeatures::CopyFrom(const SerializedKeyframeFeatures& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeFeatures)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SerializedKeyframeFeatures::IsInitialized() const {
+  return true;
+}
+
+void SerializedKeyframeFeatures::InternalSwap(SerializedKeyframeFeatures* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.feature_.InternalSwap(&other->_impl_.feature_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedKeyframeFeatures, _impl_.keyframe_id_)
+      + sizeof(SerializedKeyframeFeatures::_impl_.keyframe_id_)
+      - PROTOBUF_FIELD_OFFSET(SerializedKeyframeFeatures, _impl_.bow_)>(
+          reinterpret_cast<char*>(&_impl_.bow_),
+          reinterpret_cast<char*>(&other->_impl_.bow_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframeFeatures::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[12]);
+}
+
+// ===================================================================
+
+class SerializedKeyframeColumnarFeatures::_Internal {
+ public:
+  static const ::SerializedBow& bow(const SerializedKeyframeColumnarFeatures* msg);
+};
+
+const ::SerializedBow&
+SerializedKeyframeColumnarFeatures::_Internal::bow(const SerializedKeyframeColumnarFeatures* msg) {
+  return *msg->_impl_.bow_;
+}
+SerializedKeyframeColumnarFeatures::SerializedKeyframeColumnarFeatures(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframeColumnarFeatures)
+}
+SerializedKeyframeColumnarFeatures::SerializedKeyframeColumnarFeatures(const SerializedKeyframeColumnarFeatures& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframeColumnarFeatures* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ptx_){from._impl_.ptx_}
+    , decltype(_impl_.pty_){from._impl_.pty_}
+    , decltype(_impl_.angle_){from._impl_.angle_}
+    , decltype(_impl_.octave_){from._impl_.octave_}
+    , /*decltype(_impl_._octave_cached_byte_size_)*/{0}
+    , decltype(_impl_.mappoint_id_){from._impl_.mappoint_id_}
+    , /*decltype(_impl_._mappoint_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantizedptx_){from._impl_.quantizedptx_}
+    , /*decltype(_impl_._quantizedptx_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantizedpty_){from._impl_.quantizedpty_}
+    , /*decltype(_impl_._quantizedpty_cached_byte_size_)*/{0}
+    , decltype(_impl_.briefdescriptors_){}
+    , decltype(_impl_.quantizedangle_){}
+    , decltype(_impl_.bow_){nullptr}
+    , decltype(_impl_.keyframe_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.briefdescriptors_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.briefdescriptors_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_briefdescriptors().empty()) {
+    _this->_impl_.briefdescriptors_.Set(from._internal_briefdescriptors(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.quantizedangle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.quantizedangle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_quantizedangle().empty()) {
+    _this->_impl_.quantizedangle_.Set(from._internal_quantizedangle(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_bow()) {
+    _this->_impl_.bow_ = new ::SerializedBow(*from._impl_.bow_);
+  }
+  _this->_impl_.keyframe_id_ = from._impl_.keyframe_id_;
+  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeColumnarFeatures)
+}
+
+inline void SerializedKeyframeColumnarFeatures::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ptx_){arena}
+    , decltype(_impl_.pty_){arena}
+    , decltype(_impl_.angle_){arena}
+    , decltype(_impl_.octave_){arena}
+    , /*decltype(_impl_._octave_cached_byte_size_)*/{0}
+    , decltype(_impl_.mappoint_id_){arena}
+    , /*decltype(_impl_._mappoint_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantizedptx_){arena}
+    , /*decltype(_impl_._quantizedptx_cached_byte_size_)*/{0}
+    , decltype(_impl_.quantizedpty_){arena}
+    , /*decltype(_impl_._quantizedpty_cached_byte_size_)*/{0}
+    , decltype(_impl_.briefdescriptors_){}
+    , decltype(_impl_.quantizedangle_){}
+    , decltype(_impl_.bow_){nullptr}
+    , decltype(_impl_.keyframe_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.briefdescriptors_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.briefdescriptors_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.quantizedangle_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.quantizedangle_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SerializedKeyframeColumnarFeatures::~SerializedKeyframeColumnarFeatures() {
+  // @@protoc_insertion_point(destructor:SerializedKeyframeColumnarFeatures)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SerializedKeyframeColumnarFeatures::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ptx_.~RepeatedField();
+  _impl_.pty_.~RepeatedField();
+  _impl_.angle_.~RepeatedField();
+  _impl_.octave_.~RepeatedField();
+  _impl_.mappoint_id_.~RepeatedField();
+  _impl_.quantizedptx_.~RepeatedField();
+  _impl_.quantizedpty_.~RepeatedField();
+  _impl_.briefdescriptors_.Destroy();
+  _impl_.quantizedangle_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.bow_;
+}
+
+void SerializedKeyframeColumnarFeatures::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SerializedKeyframeColumnarFeatures::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedKeyframeColumnarFeatures)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ptx_.Clear();
+  _impl_.pty_.Clear();
+  _impl_.angle_.Clear();
+  _impl_.octave_.Clear();
+  _impl_.mappoint_id_.Clear();
+  _impl_.quantizedptx_.Clear();
+  _impl_.quantizedpty_.Clear();
+  _impl_.briefdescriptors_.ClearToEmpty();
+  _impl_.quantizedangle_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.bow_ != nullptr) {
+    delete _impl_.bow_;
+  }
+  _impl_.bow_ = nullptr;
+  _impl_.keyframe_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeyframeColumnarFeatures::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 keyframe_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.keyframe_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float ptx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_ptx(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 21) {
+          _internal_add_ptx(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float pty = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_pty(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_pty(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float angle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_angle(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_angle(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 octave = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_octave(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_octave(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 mappoint_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_mappoint_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_mappoint_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes briefdescriptors = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_briefdescriptors();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 quantizedptx = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_quantizedptx(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_quantizedptx(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint32 quantizedpty = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt32Parser(_internal_mutable_quantizedpty(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_quantizedpty(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes quantizedangle = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_quantizedangle();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .SerializedBow bow = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bow(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SerializedKeyframeColumnarFeatures::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeColumnarFeatures)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 keyframe_id = 1;
+  if (this->_internal_keyframe_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_keyframe_id(), target);
+  }
+
+  // repeated float ptx = 2;
+  if (this->_internal_ptx_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_ptx(), target);
+  }
+
+  // repeated float pty = 3;
+  if (this->_internal_pty_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_pty(), target);
+  }
+
+  // repeated float angle = 4;
+  if (this->_internal_angle_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_angle(), target);
+  }
+
+  // repeated uint32 octave = 5;
+  {
+    int byte_size = _impl_._octave_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_octave(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 mappoint_id = 6;
+  {
+    int byte_size = _impl_._mappoint_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_mappoint_id(), byte_size, target);
+    }
+  }
+
+  // bytes briefdescriptors = 7;
+  if (!this->_internal_briefdescriptors().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_briefdescriptors(), target);
+  }
+
+  // repeated sint32 quantizedptx = 8;
+  {
+    int byte_size = _impl_._quantizedptx_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          8, _internal_quantizedptx(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 quantizedpty = 9;
+  {
+    int byte_size = _impl_._quantizedpty_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          9, _internal_quantizedpty(), byte_size, target);
+    }
+  }
+
+  // bytes quantizedangle = 10;
+  if (!this->_internal_quantizedangle().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        10, this->_internal_quantizedangle(), target);
+  }
+
+  // .SerializedBow bow = 11;
+  if (this->_internal_has_bow()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::bow(this),
+        _Internal::bow(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeColumnarFeatures)
+  return target;
+}
+
+size_t SerializedKeyframeColumnarFeatures::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeColumnarFeatures)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated float ptx = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_ptx_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float pty = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_pty_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float angle = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_angle_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated uint32 octave = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.octave_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._octave_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 mappoint_id = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.mappoint_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._mappoint_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 quantizedptx = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.quantizedptx_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._quantizedptx_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated sint32 quantizedpty = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      SInt32Size(this->_impl_.quantizedpty_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._quantizedpty_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // bytes briefdescriptors = 7;
+  if (!this->_internal_briefdescriptors().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_briefdescriptors());
+  }
+
+  // bytes quantizedangle = 10;
+  if (!this->_internal_quantizedangle().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_quantizedangle());
+  }
+
+  // .SerializedBow bow = 11;
+  if (this->_internal_has_bow()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bow_);
+  }
+
+  // uint32 keyframe_id = 1;
+  if (this->_internal_keyframe_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_keyframe_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframeColumnarFeatures::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframeColumnarFeatures::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframeColumnarFeatures::GetClassData() const { return &_class_data_; }
+
+
+void SerializedKeyframeColumnarFeatures::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframeColumnarFeatures*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframeColumnarFeatures&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeColumnarFeatures)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ptx_.MergeFrom(from._impl_.ptx_);
+  _this->_impl_.pty_.MergeFrom(from._impl_.pty_);
+  _this->_impl_.angle_.MergeFrom(from._impl_.angle_);
+  _this->_impl_.octave_.MergeFrom(from._impl_.octave_);
+  _this->_impl_.mappoint_id_.MergeFrom(from._impl_.mappoint_id_);
+  _this->_impl_.quantizedptx_.MergeFrom(from._impl_.quantizedptx_);
+  _this->_impl_.quantizedpty_.MergeFrom(from._impl_.quantizedpty_);
+  if (!from._internal_briefdescriptors().empty()) {
+    _this->_internal_set_briefdescriptors(from._internal_briefdescriptors());
+  }
+  if (!from._internal_quantizedangle().empty()) {
+    _this->_internal_set_quantizedangle(from._internal_quantizedangle());
+  }
+  if (from._internal_has_bow()) {
+    _this->_internal_mutable_bow()->::SerializedBow::MergeFrom(
+        from._internal_bow());
+  }
+  if (from._internal_keyframe_id() != 0) {
+    _this->_internal_set_keyframe_id(from._internal_keyframe_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SerializedKeyframeColumnarFeatures::CopyFrom(const SerializedKeyframeColumnarFeatures& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeColumnarFeatures)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SerializedKeyframeColumnarFeatures::IsInitialized() const {
+  return true;
+}
+
+void SerializedKeyframeColumnarFeatures::InternalSwap(SerializedKeyframeColumnarFeatures* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ptx_.InternalSwap(&other->_impl_.ptx_);
+  _impl_.pty_.InternalSwap(&other->_impl_.pty_);
+  _impl_.angle_.InternalSwap(&other->_impl_.angle_);
+  _impl_.octave_.InternalSwap(&other->_impl_.octave_);
+  _impl_.mappoint_id_.InternalSwap(&other->_impl_.mappoint_id_);
+  _impl_.quantizedptx_.InternalSwap(&other->_impl_.quantizedptx_);
+  _impl_.quantizedpty_.InternalSwap(&other->_impl_.quantizedpty_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.briefdescriptors_, lhs_arena,
+      &other->_impl_.briefdescriptors_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.quantizedangle_, lhs_arena,
+      &other->_impl_.quantizedangle_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedKeyframeColumnarFeatures, _impl_.keyframe_id_)
+      + sizeof(SerializedKeyframeColumnarFeatures::_impl_.keyframe_id_)
+      - PROTOBUF_FIELD_OFFSET(SerializedKeyframeColumnarFeatures, _impl_.bow_)>(
+          reinterpret_cast<char*>(&_impl_.bow_),
+          reinterpret_cast<char*>(&other->_impl_.bow_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframeColumnarFeatures::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[13]);
+}
 
-  // repeated .SerializedFeature feature = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->feature_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->feature(static_cast<int>(i)),
-      output);
-  }
+// ===================================================================
+
+class SerializedKeyframeFeaturesArray::_Internal {
+ public:
+};
+
+SerializedKeyframeFeaturesArray::SerializedKeyframeFeaturesArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframeFeaturesArray)
+}
+SerializedKeyframeFeaturesArray::SerializedKeyframeFeaturesArray(const SerializedKeyframeFeaturesArray& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframeFeaturesArray* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.feature_){from._impl_.feature_}
+    , decltype(_impl_.columnarfeature_){from._impl_.columnarfeature_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeFeaturesArray)
+}
+
+inline void SerializedKeyframeFeaturesArray::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.feature_){arena}
+    , decltype(_impl_.columnarfeature_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+SerializedKeyframeFeaturesArray::~SerializedKeyframeFeaturesArray() {
+  // @@protoc_insertion_point(destructor:SerializedKeyframeFeaturesArray)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(serialize_end:SerializedKeyframeFeatures)
+  SharedDtor();
 }
 
-::google::protobuf::uint8* SerializedKeyframeFeatures::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeFeatures)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+inline void SerializedKeyframeFeaturesArray::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.feature_.~RepeatedPtrField();
+  _impl_.columnarfeature_.~RepeatedPtrField();
+}
+
+void SerializedKeyframeFeaturesArray::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SerializedKeyframeFeaturesArray::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedKeyframeFeaturesArray)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // uint32 keyframe_id = 1;
-  if (this->keyframe_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->keyframe_id(), target);
+  _impl_.feature_.Clear();
+  _impl_.columnarfeature_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeyframeFeaturesArray::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .SerializedKeyframeFeatures feature = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_feature(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SerializedKeyframeColumnarFeatures columnarfeature = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_columnarfeature(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SerializedKeyframeFeaturesArray::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeFeaturesArray)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .SerializedKeyframeFeatures feature = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_feature_size()); i < n; i++) {
+    const auto& repfield = this->_internal_feature(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated .SerializedFeature feature = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->feature_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->feature(static_cast<int>(i)), deterministic, target);
+  // repeated .SerializedKeyframeColumnarFeatures columnarfeature = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_columnarfeature_size()); i < n; i++) {
+    const auto& repfield = this->_internal_columnarfeature(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeFeatures)
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeFeaturesArray)
   return target;
 }
 
-size_t SerializedKeyframeFeatures::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeFeatures)
+size_t SerializedKeyframeFeaturesArray::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeFeaturesArray)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SerializedKeyframeFeatures feature = 1;
+  total_size += 1UL * this->_internal_feature_size();
+  for (const auto& msg : this->_impl_.feature_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated .SerializedFeature feature = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->feature_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->feature(static_cast<int>(i)));
-    }
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // uint32 keyframe_id = 1;
-  if (this->keyframe_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->keyframe_id());
+  // repeated .SerializedKeyframeColumnarFeatures columnarfeature = 2;
+  total_size += 1UL * this->_internal_columnarfeature_size();
+  for (const auto& msg : this->_impl_.columnarfeature_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKeyframeFeatures::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKeyframeFeatures)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKeyframeFeatures* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKeyframeFeatures>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKeyframeFeatures)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKeyframeFeatures)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframeFeaturesArray::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframeFeaturesArray::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframeFeaturesArray::GetClassData() const { return &_class_data_; }
 
-void SerializedKeyframeFeatures::MergeFrom(const SerializedKeyframeFeatures& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeFeatures)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  feature_.MergeFrom(from.feature_);
-  if (from.keyframe_id() != 0) {
-    set_keyframe_id(from.keyframe_id());
-  }
-}
+void SerializedKeyframeFeaturesArray::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframeFeaturesArray*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframeFeaturesArray&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeFeaturesArray)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SerializedKeyframeFeatures::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKeyframeFeatures)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.feature_.MergeFrom(from._impl_.feature_);
+  _this->_impl_.columnarfeature_.MergeFrom(from._impl_.columnarfeature_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SerializedKeyframeFeatures::CopyFrom(const SerializedKeyframeFeatures& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeFeatures)
+void SerializedKeyframeFeaturesArray::CopyFrom(const SerializedKeyframeFeaturesArray& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeFeaturesArray)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SerializedKeyframeFeatures::IsInitialized() const {
+bool SerializedKeyframeFeaturesArray::IsInitialized() const {
   return true;
 }
 
-void SerializedKeyframeFeatures::Swap(SerializedKeyframeFeatures* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void SerializedKeyframeFeatures::InternalSwap(SerializedKeyframeFeatures* other) {
+void SerializedKeyframeFeaturesArray::InternalSwap(SerializedKeyframeFeaturesArray* other) {
   using std::swap;
-  CastToBase(&feature_)->InternalSwap(CastToBase(&other->feature_));
-  swap(keyframe_id_, other->keyframe_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.feature_.InternalSwap(&other->_impl_.feature_);
+  _impl_.columnarfeature_.InternalSwap(&other->_impl_.columnarfeature_);
 }
 
-::google::protobuf::Metadata SerializedKeyframeFeatures::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframeFeaturesArray::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void SerializedKeyframeFeaturesArray::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int SerializedKeyframeFeaturesArray::kFeatureFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-SerializedKeyframeFeaturesArray::SerializedKeyframeFeaturesArray()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_osmap_2eproto::scc_info_SerializedKeyframeFeaturesArray.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:SerializedKeyframeFeaturesArray)
-}
-SerializedKeyframeFeaturesArray::SerializedKeyframeFeaturesArray(const SerializedKeyframeFeaturesArray& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      feature_(from.feature_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeFeaturesArray)
-}
+class SerializedJournalEntry::_Internal {
+ public:
+};
 
-void SerializedKeyframeFeaturesArray::SharedCtor() {
+SerializedJournalEntry::SerializedJournalEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedJournalEntry)
+}
+SerializedJournalEntry::SerializedJournalEntry(const SerializedJournalEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedJournalEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mappoint_){from._impl_.mappoint_}
+    , decltype(_impl_.keyframe_){from._impl_.keyframe_}
+    , decltype(_impl_.features_){from._impl_.features_}
+    , decltype(_impl_.erasedmappointsids_){from._impl_.erasedmappointsids_}
+    , /*decltype(_impl_._erasedmappointsids_cached_byte_size_)*/{0}
+    , decltype(_impl_.erasedkeyframesids_){from._impl_.erasedkeyframesids_}
+    , /*decltype(_impl_._erasedkeyframesids_cached_byte_size_)*/{0}
+    , decltype(_impl_.mappointwatermark_){}
+    , decltype(_impl_.keyframewatermark_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.mappointwatermark_, &from._impl_.mappointwatermark_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.keyframewatermark_) -
+    reinterpret_cast<char*>(&_impl_.mappointwatermark_)) + sizeof(_impl_.keyframewatermark_));
+  // @@protoc_insertion_point(copy_constructor:SerializedJournalEntry)
+}
+
+inline void SerializedJournalEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mappoint_){arena}
+    , decltype(_impl_.keyframe_){arena}
+    , decltype(_impl_.features_){arena}
+    , decltype(_impl_.erasedmappointsids_){arena}
+    , /*decltype(_impl_._erasedmappointsids_cached_byte_size_)*/{0}
+    , decltype(_impl_.erasedkeyframesids_){arena}
+    , /*decltype(_impl_._erasedkeyframesids_cached_byte_size_)*/{0}
+    , decltype(_impl_.mappointwatermark_){0u}
+    , decltype(_impl_.keyframewatermark_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-SerializedKeyframeFeaturesArray::~SerializedKeyframeFeaturesArray() {
-  // @@protoc_insertion_point(destructor:SerializedKeyframeFeaturesArray)
+SerializedJournalEntry::~SerializedJournalEntry() {
+  // @@protoc_insertion_point(destructor:SerializedJournalEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SerializedKeyframeFeaturesArray::SharedDtor() {
-}
-
-void SerializedKeyframeFeaturesArray::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* SerializedKeyframeFeaturesArray::descriptor() {
-  ::protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+inline void SerializedJournalEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.mappoint_.~RepeatedPtrField();
+  _impl_.keyframe_.~RepeatedPtrField();
+  _impl_.features_.~RepeatedPtrField();
+  _impl_.erasedmappointsids_.~RepeatedField();
+  _impl_.erasedkeyframesids_.~RepeatedField();
 }
 
-const SerializedKeyframeFeaturesArray& SerializedKeyframeFeaturesArray::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_osmap_2eproto::scc_info_SerializedKeyframeFeaturesArray.base);
-  return *internal_default_instance();
+void SerializedJournalEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void SerializedKeyframeFeaturesArray::Clear() {
-// @@protoc_insertion_point(message_clear_start:SerializedKeyframeFeaturesArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void SerializedJournalEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedJournalEntry)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  feature_.Clear();
-  _internal_metadata_.Clear();
-}
-
-bool SerializedKeyframeFeaturesArray::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:SerializedKeyframeFeaturesArray)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .SerializedKeyframeFeatures feature = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_feature()));
-        } else {
+  _impl_.mappoint_.Clear();
+  _impl_.keyframe_.Clear();
+  _impl_.features_.Clear();
+  _impl_.erasedmappointsids_.Clear();
+  _impl_.erasedkeyframesids_.Clear();
+  ::memset(&_impl_.mappointwatermark_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.keyframewatermark_) -
+      reinterpret_cast<char*>(&_impl_.mappointwatermark_)) + sizeof(_impl_.keyframewatermark_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedJournalEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .SerializedMappoint mappoint = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_mappoint(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .SerializedKeyframe keyframe = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_keyframe(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // repeated .SerializedKeyframeFeatures features = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_features(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 erasedmappointsids = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_erasedmappointsids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_erasedmappointsids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 erasedkeyframesids = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_erasedkeyframesids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_erasedkeyframesids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 mappointwatermark = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.mappointwatermark_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 keyframewatermark = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.keyframewatermark_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:SerializedKeyframeFeaturesArray)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:SerializedKeyframeFeaturesArray)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void SerializedKeyframeFeaturesArray::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:SerializedKeyframeFeaturesArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* SerializedJournalEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedJournalEntry)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .SerializedKeyframeFeatures feature = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->feature_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->feature(static_cast<int>(i)),
-      output);
+  // repeated .SerializedMappoint mappoint = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_mappoint_size()); i < n; i++) {
+    const auto& repfield = this->_internal_mappoint(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // repeated .SerializedKeyframe keyframe = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_keyframe_size()); i < n; i++) {
+    const auto& repfield = this->_internal_keyframe(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:SerializedKeyframeFeaturesArray)
-}
 
-::google::protobuf::uint8* SerializedKeyframeFeaturesArray::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeFeaturesArray)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // repeated .SerializedKeyframeFeatures features = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_features_size()); i < n; i++) {
+    const auto& repfield = this->_internal_features(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
 
-  // repeated .SerializedKeyframeFeatures feature = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->feature_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->feature(static_cast<int>(i)), deterministic, target);
+  // repeated uint32 erasedmappointsids = 4;
+  {
+    int byte_size = _impl_._erasedmappointsids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_erasedmappointsids(), byte_size, target);
+    }
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // repeated uint32 erasedkeyframesids = 5;
+  {
+    int byte_size = _impl_._erasedkeyframesids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_erasedkeyframesids(), byte_size, target);
+    }
   }
-  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeFeaturesArray)
+
+  // uint32 mappointwatermark = 6;
+  if (this->_internal_mappointwatermark() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_mappointwatermark(), target);
+  }
+
+  // uint32 keyframewatermark = 7;
+  if (this->_internal_keyframewatermark() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_keyframewatermark(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedJournalEntry)
   return target;
 }
 
-size_t SerializedKeyframeFeaturesArray::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeFeaturesArray)
+size_t SerializedJournalEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedJournalEntry)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .SerializedMappoint mappoint = 1;
+  total_size += 1UL * this->_internal_mappoint_size();
+  for (const auto& msg : this->_impl_.mappoint_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  // repeated .SerializedKeyframeFeatures feature = 1;
+
+  // repeated .SerializedKeyframe keyframe = 2;
+  total_size += 1UL * this->_internal_keyframe_size();
+  for (const auto& msg : this->_impl_.keyframe_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .SerializedKeyframeFeatures features = 3;
+  total_size += 1UL * this->_internal_features_size();
+  for (const auto& msg : this->_impl_.features_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 erasedmappointsids = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.erasedmappointsids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._erasedmappointsids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 erasedkeyframesids = 5;
   {
-    unsigned int count = static_cast<unsigned int>(this->feature_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->feature(static_cast<int>(i)));
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.erasedkeyframesids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._erasedkeyframesids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint32 mappointwatermark = 6;
+  if (this->_internal_mappointwatermark() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mappointwatermark());
+  }
 
-void SerializedKeyframeFeaturesArray::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SerializedKeyframeFeaturesArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SerializedKeyframeFeaturesArray* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const SerializedKeyframeFeaturesArray>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SerializedKeyframeFeaturesArray)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SerializedKeyframeFeaturesArray)
-    MergeFrom(*source);
+  // uint32 keyframewatermark = 7;
+  if (this->_internal_keyframewatermark() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_keyframewatermark());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SerializedKeyframeFeaturesArray::MergeFrom(const SerializedKeyframeFeaturesArray& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeFeaturesArray)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedJournalEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedJournalEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedJournalEntry::GetClassData() const { return &_class_data_; }
+
+
+void SerializedJournalEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedJournalEntry*>(&to_msg);
+  auto& from = static_cast<const SerializedJournalEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedJournalEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  feature_.MergeFrom(from.feature_);
+  _this->_impl_.mappoint_.MergeFrom(from._impl_.mappoint_);
+  _this->_impl_.keyframe_.MergeFrom(from._impl_.keyframe_);
+  _this->_impl_.features_.MergeFrom(from._impl_.features_);
+  _this->_impl_.erasedmappointsids_.MergeFrom(from._impl_.erasedmappointsids_);
+  _this->_impl_.erasedkeyframesids_.MergeFrom(from._impl_.erasedkeyframesids_);
+  if (from._internal_mappointwatermark() != 0) {
+    _this->_internal_set_mappointwatermark(from._internal_mappointwatermark());
+  }
+  if (from._internal_keyframewatermark() != 0) {
+    _this->_internal_set_keyframewatermark(from._internal_keyframewatermark());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SerializedKeyframeFeaturesArray::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SerializedKeyframeFeaturesArray)
+void SerializedJournalEntry::CopyFrom(const SerializedJournalEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedJournalEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void SerializedKeyframeFeaturesArray::CopyFrom(const SerializedKeyframeFeaturesArray& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeFeaturesArray)
+bool SerializedJournalEntry::IsInitialized() const {
+  return true;
+}
+
+void SerializedJournalEntry::InternalSwap(SerializedJournalEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.mappoint_.InternalSwap(&other->_impl_.mappoint_);
+  _impl_.keyframe_.InternalSwap(&other->_impl_.keyframe_);
+  _impl_.features_.InternalSwap(&other->_impl_.features_);
+  _impl_.erasedmappointsids_.InternalSwap(&other->_impl_.erasedmappointsids_);
+  _impl_.erasedkeyframesids_.InternalSwap(&other->_impl_.erasedkeyframesids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SerializedJournalEntry, _impl_.keyframewatermark_)
+      + sizeof(SerializedJournalEntry::_impl_.keyframewatermark_)
+      - PROTOBUF_FIELD_OFFSET(SerializedJournalEntry, _impl_.mappointwatermark_)>(
+          reinterpret_cast<char*>(&_impl_.mappointwatermark_),
+          reinterpret_cast<char*>(&other->_impl_.mappointwatermark_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedJournalEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[15]);
+}
+
+// ===================================================================
+
+class SerializedKeyframeDatabase::_Internal {
+ public:
+};
+
+SerializedKeyframeDatabase::SerializedKeyframeDatabase(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SerializedKeyframeDatabase)
+}
+SerializedKeyframeDatabase::SerializedKeyframeDatabase(const SerializedKeyframeDatabase& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SerializedKeyframeDatabase* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.worddelta_){from._impl_.worddelta_}
+    , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nkeyframes_){from._impl_.nkeyframes_}
+    , /*decltype(_impl_._nkeyframes_cached_byte_size_)*/{0}
+    , decltype(_impl_.keyframedelta_){from._impl_.keyframedelta_}
+    , /*decltype(_impl_._keyframedelta_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:SerializedKeyframeDatabase)
+}
+
+inline void SerializedKeyframeDatabase::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.worddelta_){arena}
+    , /*decltype(_impl_._worddelta_cached_byte_size_)*/{0}
+    , decltype(_impl_.nkeyframes_){arena}
+    , /*decltype(_impl_._nkeyframes_cached_byte_size_)*/{0}
+    , decltype(_impl_.keyframedelta_){arena}
+    , /*decltype(_impl_._keyframedelta_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SerializedKeyframeDatabase::~SerializedKeyframeDatabase() {
+  // @@protoc_insertion_point(destructor:SerializedKeyframeDatabase)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SerializedKeyframeDatabase::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.worddelta_.~RepeatedField();
+  _impl_.nkeyframes_.~RepeatedField();
+  _impl_.keyframedelta_.~RepeatedField();
+}
+
+void SerializedKeyframeDatabase::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SerializedKeyframeDatabase::Clear() {
+// @@protoc_insertion_point(message_clear_start:SerializedKeyframeDatabase)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.worddelta_.Clear();
+  _impl_.nkeyframes_.Clear();
+  _impl_.keyframedelta_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SerializedKeyframeDatabase::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 worddelta = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_worddelta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_worddelta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 nkeyframes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nkeyframes(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_nkeyframes(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 keyframedelta = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_keyframedelta(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_keyframedelta(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SerializedKeyframeDatabase::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SerializedKeyframeDatabase)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 worddelta = 1;
+  {
+    int byte_size = _impl_._worddelta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_worddelta(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 nkeyframes = 2;
+  {
+    int byte_size = _impl_._nkeyframes_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_nkeyframes(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 keyframedelta = 3;
+  {
+    int byte_size = _impl_._keyframedelta_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_keyframedelta(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SerializedKeyframeDatabase)
+  return target;
+}
+
+size_t SerializedKeyframeDatabase::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SerializedKeyframeDatabase)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 worddelta = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.worddelta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._worddelta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 nkeyframes = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nkeyframes_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nkeyframes_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 keyframedelta = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.keyframedelta_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._keyframedelta_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SerializedKeyframeDatabase::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SerializedKeyframeDatabase::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SerializedKeyframeDatabase::GetClassData() const { return &_class_data_; }
+
+
+void SerializedKeyframeDatabase::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SerializedKeyframeDatabase*>(&to_msg);
+  auto& from = static_cast<const SerializedKeyframeDatabase&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SerializedKeyframeDatabase)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.worddelta_.MergeFrom(from._impl_.worddelta_);
+  _this->_impl_.nkeyframes_.MergeFrom(from._impl_.nkeyframes_);
+  _this->_impl_.keyframedelta_.MergeFrom(from._impl_.keyframedelta_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SerializedKeyframeDatabase::CopyFrom(const SerializedKeyframeDatabase& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SerializedKeyframeDatabase)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SerializedKeyframeFeaturesArray::IsInitialized() const {
+bool SerializedKeyframeDatabase::IsInitialized() const {
   return true;
 }
 
-void SerializedKeyframeFeaturesArray::Swap(SerializedKeyframeFeaturesArray* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void SerializedKeyframeFeaturesArray::InternalSwap(SerializedKeyframeFeaturesArray* other) {
+void SerializedKeyframeDatabase::InternalSwap(SerializedKeyframeDatabase* other) {
   using std::swap;
-  CastToBase(&feature_)->InternalSwap(CastToBase(&other->feature_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.worddelta_.InternalSwap(&other->_impl_.worddelta_);
+  _impl_.nkeyframes_.InternalSwap(&other->_impl_.nkeyframes_);
+  _impl_.keyframedelta_.InternalSwap(&other->_impl_.keyframedelta_);
 }
 
-::google::protobuf::Metadata SerializedKeyframeFeaturesArray::GetMetadata() const {
-  protobuf_osmap_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_osmap_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SerializedKeyframeDatabase::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_osmap_2eproto_getter, &descriptor_table_osmap_2eproto_once,
+      file_level_metadata_osmap_2eproto[16]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedDescriptor* Arena::CreateMaybeMessage< ::SerializedDescriptor >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedDescriptor >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::SerializedDescriptor*
+Arena::CreateMaybeMessage< ::SerializedDescriptor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedDescriptor >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SerializedPose*
+Arena::CreateMaybeMessage< ::SerializedPose >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedPose >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SerializedPosition*
+Arena::CreateMaybeMessage< ::SerializedPosition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedPosition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SerializedKeypoint*
+Arena::CreateMaybeMessage< ::SerializedKeypoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeypoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SerializedK*
+Arena::CreateMaybeMessage< ::SerializedK >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedK >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedPose* Arena::CreateMaybeMessage< ::SerializedPose >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedPose >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKArray*
+Arena::CreateMaybeMessage< ::SerializedKArray >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKArray >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedPosition* Arena::CreateMaybeMessage< ::SerializedPosition >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedPosition >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedMappoint*
+Arena::CreateMaybeMessage< ::SerializedMappoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedMappoint >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKeypoint* Arena::CreateMaybeMessage< ::SerializedKeypoint >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKeypoint >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedMappointArray*
+Arena::CreateMaybeMessage< ::SerializedMappointArray >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedMappointArray >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedK* Arena::CreateMaybeMessage< ::SerializedK >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedK >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframe*
+Arena::CreateMaybeMessage< ::SerializedKeyframe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframe >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKArray* Arena::CreateMaybeMessage< ::SerializedKArray >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKArray >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframeArray*
+Arena::CreateMaybeMessage< ::SerializedKeyframeArray >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframeArray >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedMappoint* Arena::CreateMaybeMessage< ::SerializedMappoint >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedMappoint >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedFeature*
+Arena::CreateMaybeMessage< ::SerializedFeature >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedFeature >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedMappointArray* Arena::CreateMaybeMessage< ::SerializedMappointArray >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedMappointArray >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedBow*
+Arena::CreateMaybeMessage< ::SerializedBow >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedBow >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKeyframe* Arena::CreateMaybeMessage< ::SerializedKeyframe >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKeyframe >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframeFeatures*
+Arena::CreateMaybeMessage< ::SerializedKeyframeFeatures >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframeFeatures >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKeyframeArray* Arena::CreateMaybeMessage< ::SerializedKeyframeArray >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKeyframeArray >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframeColumnarFeatures*
+Arena::CreateMaybeMessage< ::SerializedKeyframeColumnarFeatures >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframeColumnarFeatures >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedFeature* Arena::CreateMaybeMessage< ::SerializedFeature >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedFeature >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframeFeaturesArray*
+Arena::CreateMaybeMessage< ::SerializedKeyframeFeaturesArray >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframeFeaturesArray >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKeyframeFeatures* Arena::CreateMaybeMessage< ::SerializedKeyframeFeatures >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKeyframeFeatures >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedJournalEntry*
+Arena::CreateMaybeMessage< ::SerializedJournalEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedJournalEntry >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::SerializedKeyframeFeaturesArray* Arena::CreateMaybeMessage< ::SerializedKeyframeFeaturesArray >(Arena* arena) {
-  return Arena::CreateInternal< ::SerializedKeyframeFeaturesArray >(arena);
+template<> PROTOBUF_NOINLINE ::SerializedKeyframeDatabase*
+Arena::CreateMaybeMessage< ::SerializedKeyframeDatabase >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SerializedKeyframeDatabase >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>